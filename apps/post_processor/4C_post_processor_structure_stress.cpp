@@ -13,6 +13,7 @@
 #include "4C_post_common.hpp"
 #include "4C_post_processor_single_field_writers.hpp"
 #include "4C_post_writer_base.hpp"
+#include "4C_utils_shared_memory_parallel.hpp"
 
 #include <Teuchos_ParameterList.hpp>
 
@@ -20,6 +21,88 @@
 
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  /*--------------------------------------------------------------------*
+   * compute eigenvalues and eigenvectors of the symmetric stress tensors
+   * stored in the first numrows rows of stress (xx, yy, zz, xy, yz, xz).
+   * The rows are independent of each other and are processed
+   * thread-parallel.
+   *--------------------------------------------------------------------*/
+  void compute_eigen_stresses(const Core::LinAlg::MultiVector<double>& stress, const int numrows,
+      const bool threedim,
+      std::vector<std::shared_ptr<Core::LinAlg::MultiVector<double>>>& eigen_val_vec)
+  {
+    // extract raw column pointers up front, since the column views of a multi vector are created
+    // lazily and must not be requested concurrently
+    double** s = nullptr;
+    stress.ExtractView(&s);
+    std::vector<double**> e(eigen_val_vec.size(), nullptr);
+    for (std::size_t k = 0; k < eigen_val_vec.size(); ++k) eigen_val_vec[k]->ExtractView(&e[k]);
+
+    // the three-dimensional case
+    if (threedim)
+    {
+      Core::Utils::parallel_for(numrows, Core::Utils::max_threads(),
+          [&](int i)
+          {
+            Core::LinAlg::SerialDenseMatrix eigenvec(3, 3);
+            Core::LinAlg::SerialDenseVector eigenval(3);
+
+            eigenvec(0, 0) = s[0][i];
+            eigenvec(0, 1) = s[3][i];
+            eigenvec(0, 2) = s[5][i];
+            eigenvec(1, 0) = eigenvec(0, 1);
+            eigenvec(1, 1) = s[1][i];
+            eigenvec(1, 2) = s[4][i];
+            eigenvec(2, 0) = eigenvec(0, 2);
+            eigenvec(2, 1) = eigenvec(1, 2);
+            eigenvec(2, 2) = s[2][i];
+
+            Core::LinAlg::symmetric_eigen_problem(eigenvec, eigenval, true);
+
+            for (int d = 0; d < 3; ++d)
+            {
+              e[d][0][i] = eigenval(d);
+              for (int c = 0; c < 3; ++c) e[d + 3][c][i] = eigenvec(c, d);
+            }
+          },
+          256);
+    }
+    // the two-dimensional case
+    else
+    {
+      Core::Utils::parallel_for(numrows, Core::Utils::max_threads(),
+          [&](int i)
+          {
+            Core::LinAlg::SerialDenseMatrix eigenvec(2, 2);
+            Core::LinAlg::SerialDenseVector eigenval(2);
+
+            eigenvec(0, 0) = s[0][i];
+            eigenvec(0, 1) = s[3][i];
+            eigenvec(1, 0) = eigenvec(0, 1);
+            eigenvec(1, 1) = s[1][i];
+
+            Core::LinAlg::symmetric_eigen_problem(eigenvec, eigenval, true);
+
+            e[0][0][i] = eigenval(0);
+            e[1][0][i] = eigenval(1);
+            e[2][0][i] = 0.0;
+            e[3][0][i] = eigenvec(0, 0);
+            e[3][1][i] = eigenvec(1, 0);
+            e[3][2][i] = 0.0;
+            e[4][0][i] = eigenvec(0, 1);
+            e[4][1][i] = eigenvec(1, 1);
+            e[4][2][i] = 0.0;
+            e[5][0][i] = 0.0;
+            e[5][1][i] = 0.0;
+            e[5][2][i] = 0.0;
+          },
+          256);
+    }
+  }
+}  // namespace
+
 /*----------------------------------------------------------------------*/
 /*----------------------------------------------------------------------*/
 void StructureFilter::post_stress(const std::string groupname, const std::string stresstype)
@@ -421,66 +504,8 @@ struct WriteNodalEigenStressStep : public SpecialFieldInterface
     for (int i = 3; i < 6; ++i)
       nodal_eigen_val_vec[i] = std::make_shared<Core::LinAlg::MultiVector<double>>(*noderowmap, 3);
 
-    const int numnodes = dis->num_my_row_nodes();
-    bool threedim = true;
-    if (result.field()->problem()->num_dim() == 2) threedim = false;
-
-    // the three-dimensional case
-    if (threedim)
-    {
-      for (int i = 0; i < numnodes; ++i)
-      {
-        Core::LinAlg::SerialDenseMatrix eigenvec(3, 3);
-        Core::LinAlg::SerialDenseVector eigenval(3);
-
-        eigenvec(0, 0) = ((nodal_stress(0)))[i];
-        eigenvec(0, 1) = ((nodal_stress(3)))[i];
-        eigenvec(0, 2) = ((nodal_stress(5)))[i];
-        eigenvec(1, 0) = eigenvec(0, 1);
-        eigenvec(1, 1) = ((nodal_stress(1)))[i];
-        eigenvec(1, 2) = ((nodal_stress(4)))[i];
-        eigenvec(2, 0) = eigenvec(0, 2);
-        eigenvec(2, 1) = eigenvec(1, 2);
-        eigenvec(2, 2) = ((nodal_stress(2)))[i];
-
-        Core::LinAlg::symmetric_eigen_problem(eigenvec, eigenval, true);
-
-        for (int d = 0; d < 3; ++d)
-        {
-          (((*nodal_eigen_val_vec[d])(0)))[i] = eigenval(d);
-          for (int e = 0; e < 3; ++e) (((*nodal_eigen_val_vec[d + 3])(e)))[i] = eigenvec(e, d);
-        }
-      }
-    }
-    // the two-dimensional case
-    else
-    {
-      for (int i = 0; i < numnodes; ++i)
-      {
-        Core::LinAlg::SerialDenseMatrix eigenvec(2, 2);
-        Core::LinAlg::SerialDenseVector eigenval(2);
-
-        eigenvec(0, 0) = ((nodal_stress(0)))[i];
-        eigenvec(0, 1) = ((nodal_stress(3)))[i];
-        eigenvec(1, 0) = eigenvec(0, 1);
-        eigenvec(1, 1) = ((nodal_stress(1)))[i];
-
-        Core::LinAlg::symmetric_eigen_problem(eigenvec, eigenval, true);
-
-        (((*nodal_eigen_val_vec[0])(0)))[i] = eigenval(0);
-        (((*nodal_eigen_val_vec[1])(0)))[i] = eigenval(1);
-        (((*nodal_eigen_val_vec[2])(0)))[i] = 0.0;
-        (((*nodal_eigen_val_vec[3])(0)))[i] = eigenvec(0, 0);
-        (((*nodal_eigen_val_vec[3])(1)))[i] = eigenvec(1, 0);
-        (((*nodal_eigen_val_vec[3])(2)))[i] = 0.0;
-        (((*nodal_eigen_val_vec[4])(0)))[i] = eigenvec(0, 1);
-        (((*nodal_eigen_val_vec[4])(1)))[i] = eigenvec(1, 1);
-        (((*nodal_eigen_val_vec[4])(2)))[i] = 0.0;
-        (((*nodal_eigen_val_vec[5])(0)))[i] = 0.0;
-        (((*nodal_eigen_val_vec[5])(1)))[i] = 0.0;
-        (((*nodal_eigen_val_vec[5])(2)))[i] = 0.0;
-      }
-    }
+    const bool threedim = result.field()->problem()->num_dim() != 2;
+    compute_eigen_stresses(nodal_stress, dis->num_my_row_nodes(), threedim, nodal_eigen_val_vec);
 
     for (int i = 0; i < 3; ++i)
       filter_.get_writer().write_nodal_result_step(
@@ -538,66 +563,9 @@ struct WriteElementCenterEigenStressStep : public SpecialFieldInterface
       nodal_eigen_val_vec[i] =
           std::make_shared<Core::LinAlg::MultiVector<double>>(*(dis->element_row_map()), 3);
 
-    const int numnodes = dis->num_my_row_nodes();
-    bool threedim = true;
-    if (result.field()->problem()->num_dim() == 2) threedim = false;
-
-    // the three-dimensional case
-    if (threedim)
-    {
-      for (int i = 0; i < dis->num_my_row_elements(); ++i)
-      {
-        Core::LinAlg::SerialDenseMatrix eigenvec(3, 3);
-        Core::LinAlg::SerialDenseVector eigenval(3);
-
-        eigenvec(0, 0) = ((element_stress(0)))[i];
-        eigenvec(0, 1) = ((element_stress(3)))[i];
-        eigenvec(0, 2) = ((element_stress(5)))[i];
-        eigenvec(1, 0) = eigenvec(0, 1);
-        eigenvec(1, 1) = ((element_stress(1)))[i];
-        eigenvec(1, 2) = ((element_stress(4)))[i];
-        eigenvec(2, 0) = eigenvec(0, 2);
-        eigenvec(2, 1) = eigenvec(1, 2);
-        eigenvec(2, 2) = ((element_stress(2)))[i];
-
-        Core::LinAlg::symmetric_eigen_problem(eigenvec, eigenval, true);
-
-        for (int d = 0; d < 3; ++d)
-        {
-          (((*nodal_eigen_val_vec[d])(0)))[i] = eigenval(d);
-          for (int e = 0; e < 3; ++e) (((*nodal_eigen_val_vec[d + 3])(e)))[i] = eigenvec(e, d);
-        }
-      }
-    }
-    // the two-dimensional case
-    else
-    {
-      for (int i = 0; i < numnodes; ++i)
-      {
-        Core::LinAlg::SerialDenseMatrix eigenvec(2, 2);
-        Core::LinAlg::SerialDenseVector eigenval(2);
-
-        eigenvec(0, 0) = ((element_stress(0)))[i];
-        eigenvec(0, 1) = ((element_stress(3)))[i];
-        eigenvec(1, 0) = eigenvec(0, 1);
-        eigenvec(1, 1) = ((element_stress(1)))[i];
-
-        Core::LinAlg::symmetric_eigen_problem(eigenvec, eigenval, true);
-
-        (((*nodal_eigen_val_vec[0])(0)))[i] = eigenval(0);
-        (((*nodal_eigen_val_vec[1])(0)))[i] = eigenval(1);
-        (((*nodal_eigen_val_vec[2])(0)))[i] = 0.0;
-        (((*nodal_eigen_val_vec[3])(0)))[i] = eigenvec(0, 0);
-        (((*nodal_eigen_val_vec[3])(1)))[i] = eigenvec(1, 0);
-        (((*nodal_eigen_val_vec[3])(2)))[i] = 0.0;
-        (((*nodal_eigen_val_vec[4])(0)))[i] = eigenvec(0, 1);
-        (((*nodal_eigen_val_vec[4])(1)))[i] = eigenvec(1, 1);
-        (((*nodal_eigen_val_vec[4])(2)))[i] = 0.0;
-        (((*nodal_eigen_val_vec[5])(0)))[i] = 0.0;
-        (((*nodal_eigen_val_vec[5])(1)))[i] = 0.0;
-        (((*nodal_eigen_val_vec[5])(2)))[i] = 0.0;
-      }
-    }
+    const bool threedim = result.field()->problem()->num_dim() != 2;
+    compute_eigen_stresses(
+        element_stress, dis->num_my_row_elements(), threedim, nodal_eigen_val_vec);
 
     for (int i = 0; i < 3; ++i)
       filter_.get_writer().write_element_result_step(
@@ -0,0 +1,15 @@
+# This file is part of 4C multiphysics licensed under the
+# GNU Lesser General Public License v3.0 or later.
+#
+# See the LICENSE.md file in the top-level for license information.
+#
+# SPDX-License-Identifier: LGPL-3.0-or-later
+
+find_package(LZ4 REQUIRED)
+
+if(LZ4_FOUND)
+  message(STATUS "LZ4 include directory: ${LZ4_INCLUDE_DIR}")
+  message(STATUS "LZ4 library directory: ${LZ4_LIBRARY}")
+
+  target_link_libraries(four_c_all_enabled_external_dependencies INTERFACE lz4::lz4)
+endif()
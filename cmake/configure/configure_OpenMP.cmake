@@ -0,0 +1,14 @@
+# This file is part of 4C multiphysics licensed under the
+# GNU Lesser General Public License v3.0 or later.
+#
+# See the LICENSE.md file in the top-level for license information.
+#
+# SPDX-License-Identifier: LGPL-3.0-or-later
+
+find_package(OpenMP REQUIRED COMPONENTS CXX)
+
+if(OpenMP_CXX_FOUND)
+  message(STATUS "OpenMP version: ${OpenMP_CXX_VERSION}")
+
+  target_link_libraries(four_c_all_enabled_external_dependencies INTERFACE OpenMP::OpenMP_CXX)
+endif()
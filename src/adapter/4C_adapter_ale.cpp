@@ -190,7 +190,8 @@ void Adapter::AleBaseAlgorithm::setup_ale(
                coupling == fsi_iter_stagg_NLCG or coupling == fsi_iter_stagg_Newton_FD or
                coupling == fsi_iter_stagg_Newton_I or coupling == fsi_iter_stagg_RRE or
                coupling == fsi_iter_stagg_fixed_rel_param or
-               coupling == fsi_iter_stagg_steep_desc or coupling == fsi_iter_stagg_steep_desc_force)
+               coupling == fsi_iter_stagg_steep_desc or
+               coupling == fsi_iter_stagg_steep_desc_force or coupling == fsi_iter_stagg_IQNILS)
       {
         ale_ = std::make_shared<Adapter::AleFluidWrapper>(ale);
       }
@@ -222,7 +223,8 @@ void Adapter::AleBaseAlgorithm::setup_ale(
                coupling == fsi_iter_stagg_NLCG or coupling == fsi_iter_stagg_Newton_FD or
                coupling == fsi_iter_stagg_Newton_I or coupling == fsi_iter_stagg_RRE or
                coupling == fsi_iter_stagg_fixed_rel_param or
-               coupling == fsi_iter_stagg_steep_desc or coupling == fsi_iter_stagg_steep_desc_force)
+               coupling == fsi_iter_stagg_steep_desc or
+               coupling == fsi_iter_stagg_steep_desc_force or coupling == fsi_iter_stagg_IQNILS)
       {
         ale_ = std::make_shared<Adapter::AleFluidWrapper>(ale);
       }
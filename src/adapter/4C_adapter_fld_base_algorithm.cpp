@@ -674,6 +674,7 @@ void Adapter::FluidBaseAlgorithm::setup_fluid(const Teuchos::ParameterList& prbd
         }
         else if (coupling == fsi_iter_stagg_fixed_rel_param or
                  coupling == fsi_iter_stagg_AITKEN_rel_param or
+                 coupling == fsi_iter_stagg_IQNILS or
                  coupling == fsi_iter_stagg_steep_desc or
                  coupling == fsi_iter_stagg_CHEB_rel_param or
                  coupling == fsi_iter_stagg_AITKEN_rel_force or
@@ -69,6 +69,8 @@ ALE::Ale::Ale(std::shared_ptr<Core::FE::Discretization> actdis,
       initialdisp_(Teuchos::getIntegralValue<Inpar::ALE::InitialDisp>(*params, "INITIALDISP")),
       startfuncno_(params->get<int>("STARTFUNCNO"))
 {
+  discret_->set_num_evaluation_threads(params_->get<int>("NUM_EVALUATION_THREADS"));
+
   const Epetra_Map* dofrowmap = discret_->dof_row_map();
 
   dispn_ = Core::LinAlg::create_vector(*dofrowmap, true);
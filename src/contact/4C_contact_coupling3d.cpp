@@ -1111,13 +1111,13 @@ void CONTACT::Coupling3dManager::integrate_coupling(
       // create Coupling3d object and push back
       coupling().push_back(std::make_shared<Coupling3d>(
           idiscret_, dim_, false, imortar_, slave_element(), master_element(m)));
+    }
 
-      // do coupling
-      coupling()[m]->evaluate_coupling();
+    // do coupling
+    Mortar::Coupling3d::evaluate_couplings(coupling());
 
-      // store number of intcells
-      ncells_ += (int)(coupling()[m]->cells()).size();
-    }
+    // store number of intcells
+    for (const auto& coup : coupling()) ncells_ += (int)(coup->cells()).size();
 
     // special treatment of boundary elements
     consistent_dual_shape();
@@ -1310,16 +1310,19 @@ void CONTACT::Coupling3dQuadManager::integrate_coupling(
         {
           coupling().push_back(std::make_shared<Coupling3dQuad>(discret(), n_dim(), true, params(),
               slave_element(), *master_elements()[m], *sauxelements[i], *mauxelements[m][j]));
-
-          coupling()[coupling().size() - 1]->evaluate_coupling();
-
-          // increase counter of slave/master integration pairs and intcells
-          smintpairs_ += 1;
-          intcells_ += (int)coupling()[coupling().size() - 1]->cells().size();
         }  // for maux
       }    // for saux
     }      // for m
 
+    Mortar::Coupling3d::evaluate_couplings(coupling());
+
+    // increase counter of slave/master integration pairs and intcells
+    for (const auto& coup : coupling())
+    {
+      smintpairs_ += 1;
+      intcells_ += (int)coup->cells().size();
+    }
+
     consistent_dual_shape();
 
     // integrate cells
@@ -1275,30 +1275,9 @@ void CONTACT::Interface::initialize()
       if (!node) FOUR_C_THROW("Cannot find node with gid %", gid);
       Node* cnode = dynamic_cast<Node*>(node);
 
-      // reset derivative maps of normal vector
-      for (auto& j : cnode->data().get_deriv_n())
-      {
-        j.clear();
-      }
-      (cnode->data().get_deriv_n()).resize(0, 0);
-
-      // reset derivative maps of tangent vectors
-      for (auto& j : cnode->data().get_deriv_txi())
-      {
-        j.clear();
-      }
-      (cnode->data().get_deriv_txi()).resize(0, 0);
-      for (auto& j : cnode->data().get_deriv_teta())
-      {
-        j.clear();
-      }
-      (cnode->data().get_deriv_teta()).resize(0, 0);
-
-      for (auto& j : cnode->data().get_deriv_tangent())
-      {
-        j.clear();
-      }
-      (cnode->data().get_deriv_tangent()).resize(0, 0);
+      // reset derivative maps of normal and tangent vectors
+      cnode->data().clear_deriv_normal();
+      cnode->data().clear_deriv_tangent();
     }
   }
 
@@ -1326,24 +1305,8 @@ void CONTACT::Interface::initialize()
     cnode->mo_data().get_dltl().clear();
     cnode->mo_data().get_mltl().clear();
 
-    // reset derivative maps of normal vector
-    for (auto& j : cnode->data().get_deriv_n())
-    {
-      j.clear();
-    }
-    (cnode->data().get_deriv_n()).resize(0, 0);
-
-    // reset derivative maps of tangent vectors
-    for (auto& j : cnode->data().get_deriv_txi())
-    {
-      j.clear();
-    }
-    (cnode->data().get_deriv_txi()).resize(0, 0);
-    for (auto& j : cnode->data().get_deriv_teta())
-    {
-      j.clear();
-    }
-    (cnode->data().get_deriv_teta()).resize(0, 0);
+    // reset derivative maps of normal and tangent vectors
+    cnode->data().clear_deriv_normal();
 
     // reset derivative map of Mortar matrices
     (cnode->data().get_deriv_d()).clear();
@@ -4795,12 +4758,7 @@ void CONTACT::Interface::set_cpp_normal(Mortar::Node& snode, double* normal,
   //    cnode.MoData().n()[2] << std::endl;
 
   // prepare nodal storage maps for derivative
-  if ((int)cnode.data().get_deriv_n().size() == 0)
-    cnode.data().get_deriv_n().resize(3, normallin[0].size() * 3);
-  if ((int)cnode.data().get_deriv_txi().size() == 0)
-    cnode.data().get_deriv_txi().resize(3, normallin[0].size() * 3);
-  if ((int)cnode.data().get_deriv_teta().size() == 0)
-    cnode.data().get_deriv_teta().resize(3, normallin[0].size() * 3);
+  cnode.data().reserve_deriv_normal(normallin[0].size() * 3);
 
   // init tangent length
   double ltxi = -1.0;
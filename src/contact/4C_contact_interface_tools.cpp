@@ -4313,18 +4313,8 @@ void CONTACT::Interface::fd_check_tang_lm_deriv()
         node->data().teta()[j] = 0.0;
       }
 
-      // reset derivative maps of normal vector
-      for (int j = 0; j < (int)((node->data().get_deriv_n()).size()); ++j)
-        (node->data().get_deriv_n())[j].clear();
-      (node->data().get_deriv_n()).resize(0, 0);
-
-      // reset derivative maps of tangent vectors
-      for (int j = 0; j < (int)((node->data().get_deriv_txi()).size()); ++j)
-        (node->data().get_deriv_txi())[j].clear();
-      (node->data().get_deriv_txi()).resize(0, 0);
-      for (int j = 0; j < (int)((node->data().get_deriv_teta()).size()); ++j)
-        (node->data().get_deriv_teta())[j].clear();
-      (node->data().get_deriv_teta()).resize(0, 0);
+      // reset derivative maps of normal and tangent vectors
+      node->data().clear_deriv_normal();
 
       // reset nodal Mortar maps
       node->mo_data().get_d().clear();
@@ -4515,18 +4505,8 @@ void CONTACT::Interface::fd_check_tang_lm_deriv()
         node->data().teta()[j] = 0.0;
       }
 
-      // reset derivative maps of normal vector
-      for (int j = 0; j < (int)((node->data().get_deriv_n()).size()); ++j)
-        (node->data().get_deriv_n())[j].clear();
-      (node->data().get_deriv_n()).resize(0, 0);
-
-      // reset derivative maps of tangent vectors
-      for (int j = 0; j < (int)((node->data().get_deriv_txi()).size()); ++j)
-        (node->data().get_deriv_txi())[j].clear();
-      (node->data().get_deriv_txi()).resize(0, 0);
-      for (int j = 0; j < (int)((node->data().get_deriv_teta()).size()); ++j)
-        (node->data().get_deriv_teta())[j].clear();
-      (node->data().get_deriv_teta()).resize(0, 0);
+      // reset derivative maps of normal and tangent vectors
+      node->data().clear_deriv_normal();
 
       // reset nodal Mortar maps
       node->mo_data().get_d().clear();
@@ -4716,18 +4696,8 @@ void CONTACT::Interface::fd_check_tang_lm_deriv()
       node->data().teta()[j] = 0.0;
     }
 
-    // reset derivative maps of normal vector
-    for (int j = 0; j < (int)((node->data().get_deriv_n()).size()); ++j)
-      (node->data().get_deriv_n())[j].clear();
-    (node->data().get_deriv_n()).resize(0, 0);
-
-    // reset derivative maps of tangent vectors
-    for (int j = 0; j < (int)((node->data().get_deriv_txi()).size()); ++j)
-      (node->data().get_deriv_txi())[j].clear();
-    (node->data().get_deriv_txi()).resize(0, 0);
-    for (int j = 0; j < (int)((node->data().get_deriv_teta()).size()); ++j)
-      (node->data().get_deriv_teta())[j].clear();
-    (node->data().get_deriv_teta()).resize(0, 0);
+    // reset derivative maps of normal and tangent vectors
+    node->data().clear_deriv_normal();
 
     // reset nodal Mortar maps
     node->mo_data().get_d().clear();
@@ -55,6 +55,51 @@ CONTACT::NodeDataContainer::NodeDataContainer()
   return;
 }
 
+namespace
+{
+  void clear_derivatives(std::vector<Core::Gen::Pairedvector<int, double>>& deriv)
+  {
+    for (auto& component : deriv) component.clear();
+  }
+
+  void reserve_derivatives(
+      std::vector<Core::Gen::Pairedvector<int, double>>& deriv, std::size_t capacity)
+  {
+    if (deriv.size() < 3) deriv.resize(3);
+    for (auto& component : deriv)
+      if (component.capacity() < capacity) component.resize(capacity);
+  }
+}  // namespace
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void CONTACT::NodeDataContainer::clear_deriv_normal()
+{
+  clear_derivatives(derivn_);
+  clear_derivatives(derivtxi_);
+  clear_derivatives(derivteta_);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void CONTACT::NodeDataContainer::reserve_deriv_normal(std::size_t capacity)
+{
+  reserve_derivatives(derivn_, capacity);
+  reserve_derivatives(derivtxi_, capacity);
+  reserve_derivatives(derivteta_, capacity);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void CONTACT::NodeDataContainer::clear_deriv_tangent() { clear_derivatives(derivEdge_); }
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void CONTACT::NodeDataContainer::reserve_deriv_tangent(std::size_t capacity)
+{
+  reserve_derivatives(derivEdge_, capacity);
+}
+
 /*----------------------------------------------------------------------*
  |  Pack data                                                  (public) |
  |                                                            mgit 02/10|
@@ -755,10 +800,8 @@ void CONTACT::Node::build_averaged_edge_tangent()
   //**************************************************
   typedef Core::Gen::Pairedvector<int, double>::const_iterator _CI;
 
-  for (int j = 0; j < (int)((data().get_deriv_tangent()).size()); ++j)
-    (data().get_deriv_tangent())[j].clear();
-  (data().get_deriv_tangent()).resize(0, 0);
-  if ((int)data().get_deriv_tangent().size() == 0) data().get_deriv_tangent().resize(3, 2 * 100);
+  data().clear_deriv_tangent();
+  data().reserve_deriv_tangent(2 * 100);
 
   std::vector<Core::Gen::Pairedvector<int, double>> lint(3, 100);  // added all sizes
   if (n1 != nullptr)
@@ -965,9 +1008,7 @@ void CONTACT::Node::deriv_averaged_normal(
   Core::Elements::Element** adjeles = elements();
 
   // prepare nodal storage maps for derivative
-  if ((int)data().get_deriv_n().size() == 0) data().get_deriv_n().resize(3, linsize_);
-  if ((int)data().get_deriv_txi().size() == 0) data().get_deriv_txi().resize(3, linsize_);
-  if ((int)data().get_deriv_teta().size() == 0) data().get_deriv_teta().resize(3, linsize_);
+  data().reserve_deriv_normal(linsize_);
 
   // loop over all adjacent elements
   for (int i = 0; i < nseg; ++i)
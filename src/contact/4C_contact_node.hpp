@@ -144,6 +144,28 @@ namespace CONTACT
       return derivEdge_;
     }
 
+    /*!
+     \brief Clear the 'DerivN', 'DerivTxi' and 'DerivTeta' maps for a new evaluation
+
+     The maps are refilled in every Newton iteration. They keep their memory, such that this
+     does not cause any (de)allocation. Once reserved, the maps keep their 3 components and only
+     the entries of each component are removed, i.e. the components are empty() afterwards but
+     the size() of the vector of components does not drop to 0.
+     */
+    void clear_deriv_normal();
+
+    /*!
+     \brief Make sure the 'DerivN', 'DerivTxi' and 'DerivTeta' maps have 3 components which
+     can hold at least @p capacity entries each
+     */
+    void reserve_deriv_normal(std::size_t capacity);
+
+    //! Same as clear_deriv_normal() for the 'DerivTangent' maps of edge nodes
+    void clear_deriv_tangent();
+
+    //! Same as reserve_deriv_normal() for the 'DerivTangent' maps of edge nodes
+    void reserve_deriv_tangent(std::size_t capacity);
+
     /*!
      \brief Return the 'DerivTxi' map (vector) of this node
 
@@ -3857,18 +3857,8 @@ void Wear::WearInterface::initialize()
     cnode->mo_data().get_m().clear();
     cnode->mo_data().get_mmod().clear();
 
-    // reset derivative maps of normal vector
-    for (int j = 0; j < (int)((cnode->data().get_deriv_n()).size()); ++j)
-      (cnode->data().get_deriv_n())[j].clear();
-    (cnode->data().get_deriv_n()).resize(0, 0);
-
-    // reset derivative maps of tangent vectors
-    for (int j = 0; j < (int)((cnode->data().get_deriv_txi()).size()); ++j)
-      (cnode->data().get_deriv_txi())[j].clear();
-    (cnode->data().get_deriv_txi()).resize(0, 0);
-    for (int j = 0; j < (int)((cnode->data().get_deriv_teta()).size()); ++j)
-      (cnode->data().get_deriv_teta())[j].clear();
-    (cnode->data().get_deriv_teta()).resize(0, 0);
+    // reset derivative maps of normal and tangent vectors
+    cnode->data().clear_deriv_normal();
 
     // reset derivative map of Mortar matrices
     (cnode->data().get_deriv_d()).clear();
@@ -208,6 +208,9 @@ void Core::Communication::Exporter::construct_exporter()
   std::copy(target_map().MyGlobalElements(),
       target_map().MyGlobalElements() + target_map().NumMyElements(), std::back_inserter(sendbuff));
 
+  // procs that own data I want, these are the ones I receive from
+  std::vector<bool> isrecvneighbor(num_proc(), false);
+
   for (int proc = 0; proc < num_proc(); ++proc)
   {
     int recvsizes[2];
@@ -218,7 +221,7 @@ void Core::Communication::Exporter::construct_exporter()
     std::vector<int> recvbuff(recvsize);
     if (proc == my_pid()) std::copy(sendbuff.begin(), sendbuff.end(), recvbuff.data());
     get_comm().Broadcast(recvbuff.data(), recvsize, proc);
-    // const int* have = recvbuff.data();            // this is what proc has
+    const int* have = recvbuff.data();          // this is what proc has
     const int* want = &recvbuff[recvsizes[0]];  // this is what proc needs
 
     // Loop what proc wants and what I have (send_plan)
@@ -233,9 +236,30 @@ void Core::Communication::Exporter::construct_exporter()
           send_plan()[proc].insert(lid);
         }
       }
+
+      // Loop what proc has and what I want (receive neighbors)
+      for (int i = 0; i < recvsizes[0] and !isrecvneighbor[proc]; ++i)
+        if (target_map().MyGID(have[i])) isrecvneighbor[proc] = true;
     }
     get_comm().Barrier();
   }
+
+  // Keep the order of the ring exchange such that objects received from several procs are
+  // unpacked in the same sequence as before
+  for (int i = 0; i < num_proc() - 1; ++i)
+  {
+    const int tproc = (my_pid() + 1 + i) % num_proc();
+    const int sproc = (my_pid() - 1 - i + num_proc()) % num_proc();
+    if (!send_plan()[tproc].empty()) sendneighbors_.push_back(tproc);
+    if (isrecvneighbor[sproc]) recvneighbors_.push_back(sproc);
+  }
+
+  sendblocks_.resize(sendneighbors_.size());
+  sendgids_.resize(sendneighbors_.size());
+  sendsizes_.resize(2 * sendneighbors_.size());
+  recvblocks_.resize(recvneighbors_.size());
+  recvgids_.resize(recvneighbors_.size());
+  recvsizes_.resize(2 * recvneighbors_.size());
 }
 
 void Core::Communication::Exporter::generic_export(ExporterHelper& helper)
@@ -245,86 +269,85 @@ void Core::Communication::Exporter::generic_export(ExporterHelper& helper)
 
   helper.pre_export_test(this);
 
-  //------------------------------------------------ do the send/recv loop
-  for (int i = 0; i < num_proc() - 1; ++i)
+  const int numsend = static_cast<int>(sendneighbors_.size());
+  const int numrecv = static_cast<int>(recvneighbors_.size());
+
+  // without neighbors (e.g. on a serial communicator) there is nothing to communicate
+  const Epetra_MpiComm* comm = nullptr;
+  if (numsend > 0 or numrecv > 0)
+  {
+    comm = dynamic_cast<const Epetra_MpiComm*>(&(get_comm()));
+    if (!comm) FOUR_C_THROW("Comm() is not a Epetra_MpiComm\n");
+  }
+
+  //---------------------------------------- post receives for the message sizes
+  recvrequests_.resize(2 * numrecv);
+  for (int k = 0; k < numrecv; ++k)
+  {
+    MPI_Irecv(&recvsizes_[2 * k], 2, MPI_INT, recvneighbors_[k], 1, comm->Comm(),
+        &recvrequests_[k]);
+  }
+
+  //------------------------------------------------ pack and send to all send neighbors
+  sendrequests_.resize(3 * numsend);
+  for (int k = 0; k < numsend; ++k)
   {
-    int tproc = my_pid() + 1 + i;
-    int sproc = my_pid() - 1 - i;
-    if (tproc < 0) tproc += num_proc();
-    if (sproc < 0) sproc += num_proc();
-    if (tproc > num_proc() - 1) tproc -= num_proc();
-    if (sproc > num_proc() - 1) sproc -= num_proc();
-    // cout << "Proc " << MyPID() << " tproc " << tproc << " sproc " << sproc << endl;
-    // fflush(stdout);
-
-    //------------------------------------------------ do sending to tproc
-    // gather all objects to be send
-    Core::Communication::PackBuffer sendblock;
-    std::vector<int> sendgid;
-    sendgid.reserve(send_plan()[tproc].size());
+    const int tproc = sendneighbors_[k];
+
+    // clearing keeps the capacity of the buffers from previous exports
+    std::vector<char>& sendblock = sendblocks_[k]();
+    std::vector<int>& sendgid = sendgids_[k];
+    sendblock.clear();
+    sendgid.clear();
 
     for (int lid : send_plan()[tproc])
     {
       const int gid = source_map().GID(lid);
-      if (helper.pack_object(gid, sendblock)) sendgid.push_back(gid);
+      if (helper.pack_object(gid, sendblocks_[k])) sendgid.push_back(gid);
     }
 
-    // send tproc no. of chars tproc must receive
-    std::vector<int> snmessages(2);
-    snmessages[0] = sendblock().size();
-    snmessages[1] = sendgid.size();
-
-    MPI_Request sizerequest;
-    i_send(my_pid(), tproc, snmessages.data(), 2, 1, sizerequest);
+    // send tproc no. of chars and gids tproc must receive
+    sendsizes_[2 * k] = sendblock.size();
+    sendsizes_[2 * k + 1] = sendgid.size();
+    i_send(my_pid(), tproc, &sendsizes_[2 * k], 2, 1, sendrequests_[3 * k]);
 
     // do the sending of the objects
-    MPI_Request sendrequest;
-    i_send(my_pid(), tproc, sendblock().data(), sendblock().size(), 2, sendrequest);
-
-    MPI_Request sendgidrequest;
-    i_send(my_pid(), tproc, sendgid.data(), sendgid.size(), 3, sendgidrequest);
-
-    //---------------------------------------- do the receiving from sproc
-    // receive how many messages I will receive from sproc
-    std::vector<int> rnmessages(2);
-    int source = sproc;
-    int length = 0;
-    int tag = 1;
-    // do a blocking specific receive
-    receive(source, tag, rnmessages, length);
-    if (length != 2 or tag != 1) FOUR_C_THROW("Messages got mixed up");
-
-    // receive the objects
-    std::vector<char> recvblock(rnmessages[0]);
-    tag = 2;
-    receive_any(source, tag, recvblock, length);
-    if (tag != 2) FOUR_C_THROW("Messages got mixed up");
-
-    // receive the gids
-    std::vector<int> recvgid(rnmessages[1]);
-    tag = 3;
-    receive_any(source, tag, recvgid, length);
-    if (tag != 3) FOUR_C_THROW("Messages got mixed up");
+    i_send(my_pid(), tproc, sendblock.data(), sendblock.size(), 2, sendrequests_[3 * k + 1]);
+    i_send(my_pid(), tproc, sendgid.data(), sendgid.size(), 3, sendrequests_[3 * k + 2]);
+  }
+
+  //---------------------------------------- receive the objects with exactly sized buffers
+  if (numrecv > 0) MPI_Waitall(numrecv, recvrequests_.data(), MPI_STATUSES_IGNORE);
+
+  for (int k = 0; k < numrecv; ++k)
+  {
+    const int sproc = recvneighbors_[k];
+    recvblocks_[k].resize(recvsizes_[2 * k]);
+    recvgids_[k].resize(recvsizes_[2 * k + 1]);
+    MPI_Irecv(recvblocks_[k].data(), recvsizes_[2 * k], MPI_CHAR, sproc, 2, comm->Comm(),
+        &recvrequests_[2 * k]);
+    MPI_Irecv(recvgids_[k].data(), recvsizes_[2 * k + 1], MPI_INT, sproc, 3, comm->Comm(),
+        &recvrequests_[2 * k + 1]);
+  }
+
+  if (numrecv > 0) MPI_Waitall(2 * numrecv, recvrequests_.data(), MPI_STATUSES_IGNORE);
 
+  for (int k = 0; k < numrecv; ++k)
+  {
     int j = 0;
 
-    UnpackBuffer buffer(recvblock);
+    UnpackBuffer buffer(recvblocks_[k]);
     while (!buffer.at_end())
     {
-      int gid = recvgid[j];
+      int gid = recvgids_[k][j];
       helper.unpack_object(gid, buffer);
       j += 1;
     }
-
-    //----------------------------------- do waiting for messages to tproc to leave
-    wait(sizerequest);
-    wait(sendrequest);
-    wait(sendgidrequest);
-
-    // make sure we do not get mixed up messages as we use wild card receives here
-    get_comm().Barrier();
   }
 
+  //----------------------------------- do waiting for messages to neighbors to leave
+  if (numsend > 0) MPI_Waitall(3 * numsend, sendrequests_.data(), MPI_STATUSES_IGNORE);
+
   helper.post_export_cleanup(this);
 }
 
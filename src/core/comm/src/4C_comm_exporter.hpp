@@ -437,6 +437,9 @@ namespace Core::Communication
    private:
     /*!
     \brief Do initialization of the exporter
+
+    Builds the send plan as well as the lists of procs this proc sends to and receives from.
+    These are computed once and reused by every export with this exporter.
     */
     void construct_exporter();
 
@@ -456,6 +459,10 @@ namespace Core::Communication
 
     /*!
     \brief generic export algorithm that delegates the specific pack/unpack to a helper
+
+    Only the neighbors known from construct_exporter() are contacted. The message sizes are
+    exchanged first so that all data is received with exactly sized, non-blocking receives into
+    buffers that keep their capacity from one export to the next.
      */
     void generic_export(ExporterHelper& helper);
 
@@ -474,6 +481,30 @@ namespace Core::Communication
     int numproc_;
     //! sending information
     std::vector<std::set<int>> sendplan_;
+    //! procs I send data to, i.e. procs with a non-empty send plan
+    std::vector<int> sendneighbors_;
+    //! procs I receive data from, ordered as in the former ring exchange
+    std::vector<int> recvneighbors_;
+
+    //! @name Buffers that are reused across exports with the same plan
+    //@{
+    //! packed objects per send neighbor
+    std::vector<PackBuffer> sendblocks_;
+    //! gids of the packed objects per send neighbor
+    std::vector<std::vector<int>> sendgids_;
+    //! no. of chars and no. of gids per send neighbor
+    std::vector<int> sendsizes_;
+    //! received objects per receive neighbor
+    std::vector<std::vector<char>> recvblocks_;
+    //! gids of the received objects per receive neighbor
+    std::vector<std::vector<int>> recvgids_;
+    //! no. of chars and no. of gids per receive neighbor
+    std::vector<int> recvsizes_;
+    //! pending send requests
+    std::vector<MPI_Request> sendrequests_;
+    //! pending receive requests
+    std::vector<MPI_Request> recvrequests_;
+    //@}
 
     /// Internal helper class for Exporter that encapsulates packing and unpacking
     /*!
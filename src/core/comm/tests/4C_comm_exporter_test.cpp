@@ -0,0 +1,101 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_comm_exporter.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+
+#include <Epetra_Map.h>
+#include <Epetra_MpiComm.h>
+#include <Epetra_SerialComm.h>
+
+
+namespace
+{
+  using namespace FourC;
+
+  TEST(Exporter, RepeatedExportWithSamePlan)
+  {
+    Epetra_MpiComm comm(MPI_COMM_WORLD);
+
+    // at least two procs required
+    ASSERT_GT(Core::Communication::num_mpi_ranks(comm), 1);
+
+    const int myPID = Core::Communication::my_mpi_rank(comm);
+    const int numProc = Core::Communication::num_mpi_ranks(comm);
+    constexpr int num_gids_per_proc = 5;
+
+    // every proc owns a contiguous block of gids and wants the block of its right neighbor
+    std::vector<int> source_gids, target_gids;
+    for (int i = 0; i < num_gids_per_proc; ++i)
+    {
+      source_gids.push_back(myPID * num_gids_per_proc + i);
+      target_gids.push_back(((myPID + 1) % numProc) * num_gids_per_proc + i);
+    }
+    const Epetra_Map source_map(-1, source_gids.size(), source_gids.data(), 0, comm);
+    const Epetra_Map target_map(-1, target_gids.size(), target_gids.data(), 0, comm);
+
+    Core::Communication::Exporter exporter(source_map, target_map, comm);
+
+    // the same exporter is reused with data of changing size
+    for (int step = 0; step < 3; ++step)
+    {
+      std::map<int, double> scalars;
+      std::map<int, std::vector<int>> vectors;
+      for (const int gid : source_gids)
+      {
+        scalars[gid] = gid + 0.5 * step;
+        vectors[gid] = std::vector<int>(gid % 3 + step, gid);
+      }
+
+      exporter.do_export(scalars);
+      exporter.do_export(vectors);
+
+      ASSERT_EQ(scalars.size(), target_gids.size());
+      ASSERT_EQ(vectors.size(), target_gids.size());
+      for (const int gid : target_gids)
+      {
+        EXPECT_DOUBLE_EQ(scalars.at(gid), gid + 0.5 * step);
+        EXPECT_EQ(vectors.at(gid), std::vector<int>(gid % 3 + step, gid));
+      }
+    }
+  }
+
+  TEST(Exporter, SerialCommKeepsTargetObjects)
+  {
+    Epetra_SerialComm comm;
+
+    const std::vector<int> source_gids = {0, 1, 2, 3, 4};
+    const std::vector<int> target_gids = {1, 3};
+    const Epetra_Map source_map(-1, source_gids.size(), source_gids.data(), 0, comm);
+    const Epetra_Map target_map(-1, target_gids.size(), target_gids.data(), 0, comm);
+
+    Core::Communication::Exporter exporter(source_map, target_map, comm);
+
+    std::map<int, double> scalars;
+    std::map<int, std::vector<int>> vectors;
+    for (const int gid : source_gids)
+    {
+      scalars[gid] = gid + 0.5;
+      vectors[gid] = std::vector<int>(gid + 1, gid);
+    }
+
+    // there are no neighbors to communicate with, only objects not in the target map are removed
+    exporter.do_export(scalars);
+    exporter.do_export(vectors);
+
+    ASSERT_EQ(scalars.size(), target_gids.size());
+    ASSERT_EQ(vectors.size(), target_gids.size());
+    for (const int gid : target_gids)
+    {
+      EXPECT_DOUBLE_EQ(scalars.at(gid), gid + 0.5);
+      EXPECT_EQ(vectors.at(gid), std::vector<int>(gid + 1, gid));
+    }
+  }
+}  // namespace
@@ -29,7 +29,13 @@ FOUR_C_NAMESPACE_OPEN
  *----------------------------------------------------------------------*/
 Core::FE::Discretization::Discretization(
     const std::string& name, std::shared_ptr<Epetra_Comm> comm, unsigned int n_dim)
-    : name_(name), comm_(comm), writer_(nullptr), filled_(false), havedof_(false), n_dim_(n_dim)
+    : name_(name),
+      comm_(comm),
+      writer_(nullptr),
+      filled_(false),
+      havedof_(false),
+      num_evaluation_threads_(1),
+      n_dim_(n_dim)
 {
   dofsets_.emplace_back(std::make_shared<Core::DOFSets::DofSet>());
 }
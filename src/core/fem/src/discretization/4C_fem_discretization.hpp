@@ -1723,6 +1723,39 @@ namespace Core::FE
             Core::LinAlg::SerialDenseVector&, Core::LinAlg::SerialDenseVector&,
             Core::LinAlg::SerialDenseVector&)>& element_action);
 
+    /*!
+    \brief Set the number of threads used for the element loop of evaluate()
+
+    With more than one thread, the column elements are distributed dynamically among the threads
+    of this rank. Every thread evaluates into its own location array and element matrices and
+    vectors. If the AssembleStrategy allows concurrent assembly, the elements are processed one
+    color of element_colors() at a time and assemble without locking. Otherwise, the
+    contributions are passed to the AssembleStrategy one element at a time under a lock, so the
+    strategy and the global objects never see concurrent calls.
+
+    \note The element action (and thus Element::evaluate() for the default overloads) must be
+    thread-safe, i.e., it must not modify shared data such as the parameter list. Without
+    concurrent assembly, the summation order into the global objects is not deterministic with
+    more than one thread.
+
+    \note The number of threads is bounded by the available threads. Without OpenMP support, the
+    element loop is always executed serially.
+    */
+    void set_num_evaluation_threads(int num_threads);
+
+    /// Number of threads used for the element loop of evaluate()
+    [[nodiscard]] int num_evaluation_threads() const { return num_evaluation_threads_; }
+
+    /*!
+    \brief Coloring of the column elements of this rank
+
+    Each entry holds the local column ids of the elements of one color. Elements of the same
+    color do not share any node and thus never contribute to the same rows. The coloring is built
+    on the first call after fill_complete() and dropped whenever the discretization is reset,
+    e.g. on redistribution.
+    */
+    const std::vector<std::vector<int>>& element_colors();
+
     /// Call elements to evaluate
     /*!
       Abbreviated evaluate() call that always assembles one matrix and
@@ -2118,6 +2151,11 @@ namespace Core::FE
     */
     virtual void build_element_to_element_pointers();
 
+    /*!
+    \brief Color the column elements greedily such that elements of one color share no node
+    */
+    void build_element_colors();
+
     /*!
     \brief Build the geometry of surfaces belonging to the structure-fluid
     volume coupling condition -> this is special since an associated volume
@@ -2229,6 +2267,9 @@ namespace Core::FE
     //! Flag indicating whether degrees of freedom where assigned
     bool havedof_;
 
+    //! Number of threads used for the element loop of evaluate()
+    int num_evaluation_threads_;
+
 
     //! @name Elements
     //! @{
@@ -2245,6 +2286,9 @@ namespace Core::FE
     //! Vector of pointers to column elements for faster access
     std::vector<Core::Elements::Element*> elecolptr_;
 
+    //! Local column ids of the elements of each color (built on demand)
+    std::vector<std::vector<int>> element_colors_;
+
     //! Map of elements
     std::map<int, std::shared_ptr<Core::Elements::Element>> element_;
 
@@ -19,11 +19,26 @@
 #include "4C_utils_exceptions.hpp"
 #include "4C_utils_function_manager.hpp"
 #include "4C_utils_function_of_time.hpp"
+#include "4C_utils_shared_memory_parallel.hpp"
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <algorithm>
+#include <mutex>
+
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  /*!
+   * Number of elements a thread takes at once in the threaded element loop. Element costs differ
+   * (e.g., material nonlinearity, element technology), so the elements are handed out dynamically.
+   * A few elements per chunk keep the scheduling overhead small compared to one element
+   * evaluation, while still balancing the load within one color.
+   */
+  constexpr int element_loop_chunk_size = 8;
+}  // namespace
+
 /*----------------------------------------------------------------------*
  |  evaluate (public)                                        mwgee 12/06|
  *----------------------------------------------------------------------*/
@@ -51,8 +66,7 @@ void Core::FE::Discretization::evaluate(
           Core::LinAlg::SerialDenseVector& elevec3)
       {
         const int err =
-            ele.evaluate(params, *this, la, strategy.elematrix1(), strategy.elematrix2(),
-                strategy.elevector1(), strategy.elevector2(), strategy.elevector3());
+            ele.evaluate(params, *this, la, elemat1, elemat2, elevec1, elevec2, elevec3);
         if (err)
           FOUR_C_THROW("Proc %d: Element %d returned err=%d",
               Core::Communication::my_mpi_rank(get_comm()), ele.id(), err);
@@ -84,6 +98,82 @@ void Core::FE::Discretization::evaluate(Teuchos::ParameterList& params,
       strategy.systemmatrix1(), strategy.systemmatrix2(), strategy.systemvector1(),
       strategy.systemvector2(), strategy.systemvector3());
 
+  const int num_threads = std::min(num_evaluation_threads_, Core::Utils::max_threads());
+  if (num_threads > 1)
+  {
+    // every thread evaluates into its own location array and element storage
+    struct ThreadLocalStorage
+    {
+      explicit ThreadLocalStorage(int num_dofsets) : la(num_dofsets) {}
+
+      Core::Elements::LocationArray la;
+      Core::LinAlg::SerialDenseMatrix elemat1;
+      Core::LinAlg::SerialDenseMatrix elemat2;
+      Core::LinAlg::SerialDenseVector elevec1;
+      Core::LinAlg::SerialDenseVector elevec2;
+      Core::LinAlg::SerialDenseVector elevec3;
+    };
+    std::vector<ThreadLocalStorage> thread_storage(
+        num_threads, ThreadLocalStorage(static_cast<int>(dofsets_.size())));
+
+    // without concurrent assembly, the assemble strategy and the global objects are not
+    // thread-safe
+    std::mutex assembly_mutex;
+
+    auto evaluate_and_assemble = [&](Core::Elements::Element& actele, bool lock_assembly)
+    {
+      ThreadLocalStorage& storage = thread_storage[Core::Utils::thread_id()];
+      Core::Elements::LocationArray& la = storage.la;
+
+      actele.location_vector(*this, la, false);
+
+      strategy.clear_element_storage(la[row].size(), la[col].size(), storage.elemat1,
+          storage.elemat2, storage.elevec1, storage.elevec2, storage.elevec3);
+
+      element_action(actele, la, storage.elemat1, storage.elemat2, storage.elevec1,
+          storage.elevec2, storage.elevec3);
+
+      const int eid = actele.id();
+      std::unique_lock<std::mutex> lock(assembly_mutex, std::defer_lock);
+      if (lock_assembly) lock.lock();
+      if (strategy.assemblemat1())
+        strategy.assemble(*strategy.systemmatrix1(), eid, la[col].stride_, storage.elemat1,
+            la[row].lm_, la[row].lmowner_, la[col].lm_);
+      if (strategy.assemblemat2())
+        strategy.assemble(*strategy.systemmatrix2(), eid, la[col].stride_, storage.elemat2,
+            la[row].lm_, la[row].lmowner_, la[col].lm_);
+      if (strategy.assemblevec1())
+        strategy.assemble(
+            *strategy.systemvector1(), storage.elevec1, la[row].lm_, la[row].lmowner_);
+      if (strategy.assemblevec2())
+        strategy.assemble(
+            *strategy.systemvector2(), storage.elevec2, la[row].lm_, la[row].lmowner_);
+      if (strategy.assemblevec3())
+        strategy.assemble(
+            *strategy.systemvector3(), storage.elevec3, la[row].lm_, la[row].lmowner_);
+    };
+
+    if (strategy.allows_concurrent_assembly())
+    {
+      // elements of one color share no node and hence no row, so they assemble without locking
+      for (const std::vector<int>& color : element_colors())
+      {
+        Core::Utils::parallel_for(
+            static_cast<int>(color.size()), num_threads,
+            [&](int i) { evaluate_and_assemble(*elecolptr_[color[i]], false); },
+            element_loop_chunk_size);
+      }
+    }
+    else
+    {
+      Core::Utils::parallel_for(
+          static_cast<int>(elecolptr_.size()), num_threads,
+          [&](int i) { evaluate_and_assemble(*elecolptr_[i], true); }, element_loop_chunk_size);
+    }
+
+    return;
+  }
+
   Core::Elements::LocationArray la(dofsets_.size());
 
   // loop over column elements
@@ -110,6 +200,17 @@ void Core::FE::Discretization::evaluate(Teuchos::ParameterList& params,
 }
 
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::FE::Discretization::set_num_evaluation_threads(int num_threads)
+{
+  if (num_threads < 1)
+    FOUR_C_THROW("Number of evaluation threads must be positive, got %d.", num_threads);
+
+  num_evaluation_threads_ = num_threads;
+}
+
+
 /*----------------------------------------------------------------------*
  |  evaluate (public)                                        u.kue 01/08|
  *----------------------------------------------------------------------*/
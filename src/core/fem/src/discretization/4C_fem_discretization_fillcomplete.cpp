@@ -32,6 +32,7 @@ void Core::FE::Discretization::reset(bool killdofs, bool killcond)
   elecolmap_ = nullptr;
   elerowptr_.clear();
   elecolptr_.clear();
+  element_colors_.clear();
   noderowmap_ = nullptr;
   nodecolmap_ = nullptr;
   noderowptr_.clear();
@@ -143,6 +144,56 @@ int Core::FE::Discretization::fill_complete(
 }
 
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+const std::vector<std::vector<int>>& Core::FE::Discretization::element_colors()
+{
+  if (!filled()) FOUR_C_THROW("fill_complete was not called");
+
+  if (element_colors_.empty() and !elecolptr_.empty()) build_element_colors();
+
+  return element_colors_;
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::FE::Discretization::build_element_colors()
+{
+  const int numele = static_cast<int>(elecolptr_.size());
+  std::vector<int> color(numele, -1);
+
+  // forbidden[c] == lid marks color c as used by a neighbor of element lid
+  std::vector<int> forbidden;
+
+  element_colors_.clear();
+  for (int lid = 0; lid < numele; ++lid)
+  {
+    Core::Elements::Element& actele = *elecolptr_[lid];
+    for (int inode = 0; inode < actele.num_node(); ++inode)
+    {
+      Core::Nodes::Node& node = *actele.nodes()[inode];
+      for (int iele = 0; iele < node.num_element(); ++iele)
+      {
+        const int neighbor_color = color[node.elements()[iele]->lid()];
+        if (neighbor_color >= 0) forbidden[neighbor_color] = lid;
+      }
+    }
+
+    int mycolor = 0;
+    while (mycolor < static_cast<int>(forbidden.size()) and forbidden[mycolor] == lid) ++mycolor;
+    if (mycolor == static_cast<int>(forbidden.size()))
+    {
+      forbidden.push_back(-1);
+      element_colors_.emplace_back();
+    }
+
+    color[lid] = mycolor;
+    element_colors_[mycolor].push_back(lid);
+  }
+}
+
+
 /*----------------------------------------------------------------------*
  |  init elements (public)                                   mwgee 12/06|
  *----------------------------------------------------------------------*/
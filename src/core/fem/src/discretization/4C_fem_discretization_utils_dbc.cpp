@@ -15,6 +15,10 @@
 
 #include <Teuchos_ParameterList.hpp>
 
+#include <map>
+#include <utility>
+#include <vector>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*----------------------------------------------------------------------------*
@@ -488,6 +492,16 @@ void Core::FE::Utils::Dbc::do_dirichlet_condition(const Teuchos::ParameterList&
 
   if (systemvectors[2] != nullptr) deg = 2;
 
+  // Without time derivatives, the spatial functions are evaluated for all nodes at once. The
+  // points are collected per function and component.
+  struct FunctionPoints
+  {
+    std::vector<double> coordinates;
+    std::vector<int> lids;
+    std::vector<double> values;
+  };
+  std::map<std::pair<int, int>, FunctionPoints> function_points;
+
   // loop nodes to identify and evaluate load curves and spatial distributions
   // of Dirichlet boundary conditions
   for (unsigned i = 0; i < nnode; ++i)
@@ -537,6 +551,16 @@ void Core::FE::Utils::Dbc::do_dirichlet_condition(const Teuchos::ParameterList&
                                // is unprescribed by lower hierarchy condition
       if (dbc_on_dof_is_off || dbc_toggle_is_off) continue;
 
+      if (deg == 0 and funct and (*funct)[onesetj] > 0)
+      {
+        FunctionPoints& points = function_points[{(*funct)[onesetj], onesetj}];
+        const std::vector<double>& x = actnode->x();
+        for (unsigned d = 0; d < 3; ++d) points.coordinates.push_back(d < x.size() ? x[d] : 0.0);
+        points.lids.push_back(lid);
+        points.values.push_back((*val)[onesetj]);
+        continue;
+      }
+
       std::vector<double> value(deg + 1, (*val)[onesetj]);
 
       // factor given by temporal and spatial function
@@ -569,6 +593,21 @@ void Core::FE::Utils::Dbc::do_dirichlet_condition(const Teuchos::ParameterList&
     }  // loop over nodal DOFs
   }    // loop over nodes
 
+  // evaluate the collected spatial functions and assign the values
+  std::vector<double> functfac;
+  for (const auto& [function_component, points] : function_points)
+  {
+    const auto& [funct_num, component] = function_component;
+    functfac.resize(points.lids.size());
+    params.get<const Core::Utils::FunctionManager*>("function_manager")
+        ->function_by_id<Core::Utils::FunctionOfSpaceTime>(funct_num - 1)
+        .evaluate_at_points(
+            points.coordinates.data(), points.lids.size(), time, component, functfac.data());
+
+    for (std::size_t i = 0; i < points.lids.size(); ++i)
+      (*systemvectors[0])[points.lids[i]] = points.values[i] * functfac[i];
+  }
+
   return;
 }
 
@@ -8,6 +8,7 @@
 #include "4C_fem_general_assemblestrategy.hpp"
 
 #include "4C_fem_discretization.hpp"
+#include "4C_linalg_sparsematrix.hpp"
 #include "4C_linalg_sparseoperator.hpp"
 #include "4C_linalg_utils_sparse_algebra_assemble.hpp"
 
@@ -69,44 +70,71 @@ void Core::FE::AssembleStrategy::complete()
   }
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Core::FE::AssembleStrategy::allows_concurrent_assembly() const
+{
+  for (const auto& sysmat : {systemmatrix1_, systemmatrix2_})
+  {
+    if (sysmat == nullptr) continue;
+
+    const auto* sparse = dynamic_cast<const LinAlg::SparseMatrix*>(sysmat.get());
+    if (sparse == nullptr or not sparse->filled() or
+        sparse->get_matrixtype() != LinAlg::SparseMatrix::CRS_MATRIX)
+      return false;
+  }
+  return true;
+}
+
 /*----------------------------------------------------------------------*
  *----------------------------------------------------------------------*/
 void Core::FE::AssembleStrategy::clear_element_storage(int rdim, int cdim)
+{
+  clear_element_storage(
+      rdim, cdim, elematrix1_, elematrix2_, elevector1_, elevector2_, elevector3_);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::FE::AssembleStrategy::clear_element_storage(int rdim, int cdim,
+    LinAlg::SerialDenseMatrix& elematrix1, LinAlg::SerialDenseMatrix& elematrix2,
+    LinAlg::SerialDenseVector& elevector1, LinAlg::SerialDenseVector& elevector2,
+    LinAlg::SerialDenseVector& elevector3)
 {
   if (assemblemat1())
   {
-    if (elematrix1_.numRows() != rdim or elematrix1_.numCols() != cdim)
-      elematrix1_.shape(rdim, cdim);
+    if (elematrix1.numRows() != rdim or elematrix1.numCols() != cdim)
+      elematrix1.shape(rdim, cdim);
     else
-      elematrix1_.putScalar(0.0);
+      elematrix1.putScalar(0.0);
   }
   if (assemblemat2())
   {
-    if (elematrix2_.numRows() != rdim or elematrix2_.numCols() != cdim)
-      elematrix2_.shape(rdim, cdim);
+    if (elematrix2.numRows() != rdim or elematrix2.numCols() != cdim)
+      elematrix2.shape(rdim, cdim);
     else
-      elematrix2_.putScalar(0.0);
+      elematrix2.putScalar(0.0);
   }
   if (assemblevec1())
   {
-    if (elevector1_.length() != rdim)
-      elevector1_.size(rdim);
+    if (elevector1.length() != rdim)
+      elevector1.size(rdim);
     else
-      elevector1_.putScalar(0.0);
+      elevector1.putScalar(0.0);
   }
   if (assemblevec2())
   {
-    if (elevector2_.length() != rdim)
-      elevector2_.size(rdim);
+    if (elevector2.length() != rdim)
+      elevector2.size(rdim);
     else
-      elevector2_.putScalar(0.0);
+      elevector2.putScalar(0.0);
   }
   if (assemblevec3())
   {
-    if (elevector3_.length() != rdim)
-      elevector3_.size(rdim);
+    if (elevector3.length() != rdim)
+      elevector3.size(rdim);
     else
-      elevector3_.putScalar(0.0);
+      elevector3.putScalar(0.0);
   }
 }
 
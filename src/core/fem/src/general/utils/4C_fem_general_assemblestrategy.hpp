@@ -87,9 +87,23 @@ namespace Core::FE
     /// complete any global objects
     virtual void complete();
 
+    /*!
+    \brief Whether elements that share no node may be assembled concurrently
+
+    This holds if all global matrices are filled sparse matrices, such that assembly only adds
+    to existing entries of the rows of the given element. Derived strategies that override
+    assemble() have to override this method as well.
+    */
+    virtual bool allows_concurrent_assembly() const;
+
     /// zero element memory
     void clear_element_storage(int rdim, int cdim);
 
+    /// zero given element memory, e.g. thread-local storage that is used instead of the members
+    void clear_element_storage(int rdim, int cdim, LinAlg::SerialDenseMatrix& elematrix1,
+        LinAlg::SerialDenseMatrix& elematrix2, LinAlg::SerialDenseVector& elevector1,
+        LinAlg::SerialDenseVector& elevector2, LinAlg::SerialDenseVector& elevector3);
+
     //! @name Specific Assembly Methods
 
     /// Asseble to matrix 1
@@ -234,18 +234,17 @@ Core::FE::GaussIntegration::GaussIntegration(Core::FE::CellType distype, int deg
 
 Core::FE::GaussPointCache& Core::FE::GaussPointCache::instance()
 {
-  static std::unique_ptr<GaussPointCache> instance;
-  if (instance == nullptr)
-  {
-    instance = std::unique_ptr<GaussPointCache>(new GaussPointCache);
-  }
-  return *instance;
+  // initialization of function-local statics is thread-safe
+  static GaussPointCache instance;
+  return instance;
 }
 
 
 std::shared_ptr<Core::FE::GaussPoints> Core::FE::GaussPointCache::create(
     Core::FE::CellType distype, int degree)
 {
+  std::lock_guard<std::mutex> lock(mutex_);
+
   std::map<std::pair<Core::FE::CellType, int>, std::shared_ptr<GaussPoints>>::iterator i =
       gp_cache_.find(std::make_pair(distype, degree));
   if (i != gp_cache_.end())
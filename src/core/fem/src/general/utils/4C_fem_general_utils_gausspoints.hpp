@@ -15,6 +15,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -186,11 +187,15 @@ namespace Core::FE
    public:
     static GaussPointCache& instance();
 
+    /// thread-safe
     std::shared_ptr<GaussPoints> create(Core::FE::CellType distype, int degree);
 
    private:
     /// cache of already created gauss rules
     std::map<std::pair<Core::FE::CellType, int>, std::shared_ptr<GaussPoints>> gp_cache_;
+
+    /// serializes access to the cache
+    std::mutex mutex_;
   };
 
   /// gauss integration interface
@@ -17,7 +17,11 @@
 #include <ArborX_KDOP.hpp>
 #endif
 
-#ifdef FOUR_C_WITH_ARBORX
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
 FOUR_C_NAMESPACE_OPEN
 namespace Core::GeometricSearch
 {
@@ -33,9 +37,38 @@ namespace Core::GeometricSearch
 
   //! At the moment we consider all k-dops in R3
   constexpr int kdop_dim = 3;
+
+#ifndef FOUR_C_WITH_ARBORX
+  //! The (non-normalized) k-DOP directions in the same order as in ArborX.
+  constexpr std::array<std::array<float, kdop_dim>, kdop_directions> kdop_direction_vectors = {{
+      // faces of the unit cube
+      {1, 0, 0}, {0, 1, 0}, {0, 0, 1},
+      // edges of the unit cube
+      {1, 1, 0}, {1, 0, 1}, {0, 1, 1}, {1, -1, 0}, {1, 0, -1}, {0, 1, -1},
+      // corners of the unit cube
+      {1, 1, 1}, {1, -1, 1}, {1, 1, -1}, {1, -1, -1}}};
+
+  /*!
+   * \brief A k-DOP stored as the minimum and maximum projection onto each of the k-DOP directions.
+   *
+   * This is the storage of a BoundingVolume if 4C is built without ArborX. The member names are
+   * the ones of ArborX::Experimental::KDOP, such that code accessing the storage works with both.
+   * A default constructed k-DOP is empty.
+   */
+  struct KDOP
+  {
+    std::array<float, kdop_directions> _min_values;
+    std::array<float, kdop_directions> _max_values;
+
+    KDOP()
+    {
+      _min_values.fill(std::numeric_limits<float>::max());
+      _max_values.fill(std::numeric_limits<float>::lowest());
+    }
+  };
+#endif
 }  // namespace Core::GeometricSearch
 FOUR_C_NAMESPACE_CLOSE
-#endif
 
 
 #ifdef FOUR_C_WITH_ARBORX
@@ -65,21 +98,56 @@ namespace Core::GeometricSearch
    * \brief Class representing a bounding volume of a set of points.
    *
    * Internal this class uses k-DOPs implemented in ArborX. A k-DOP (discrete oriented polytope) is
-   * a convex polytope containing the object.
+   * a convex polytope containing the object. Without ArborX, an equivalent native k-DOP is used.
    */
   struct BoundingVolume
   {
 #ifndef FOUR_C_WITH_ARBORX
-    /*! \brief This class can not be used without ArborX, add empy methods and a controlled error.
+    /*! \brief Constructor initializing the bounding volume corners with numerical limit values.
+     */
+    BoundingVolume() = default;
+
+    /*! \brief Adds a point to the bounding volume.
+     *
+     * @param point Point to add to the bounding volume
      */
-    BoundingVolume()
+    inline void add_point(const Core::LinAlg::Matrix<3, 1, double>& point)
     {
-      FOUR_C_THROW(
-          "The struct 'Core::GeometricSearch::BoundingVolume' can only be used with ArborX."
-          "To use it, enable ArborX during the configure process.");
+      const std::array<float, kdop_dim> coords = {static_cast<float>(point(0)),
+          static_cast<float>(point(1)), static_cast<float>(point(2))};
+      for (int i_dir = 0; i_dir < kdop_directions; i_dir++)
+      {
+        const auto& direction = kdop_direction_vectors[i_dir];
+        const float projection =
+            direction[0] * coords[0] + direction[1] * coords[1] + direction[2] * coords[2];
+        bounding_volume_._min_values[i_dir] =
+            std::min(bounding_volume_._min_values[i_dir], projection);
+        bounding_volume_._max_values[i_dir] =
+            std::max(bounding_volume_._max_values[i_dir], projection);
+      }
     }
-    inline void extend_boundaries(const double offset) {}
-    inline void add_point(const Core::LinAlg::Matrix<3, 1, double> &point) {}
+
+    /*! \brief Extends the bounding volume based on a scalar value.
+     *
+     * @param offset Value by which to expand the bounding volume
+     */
+    inline void extend_boundaries(const double offset)
+    {
+      // Loop over directions.
+      for (int i_dir = 0; i_dir < kdop_directions; i_dir++)
+      {
+        const auto& direction = kdop_direction_vectors[i_dir];
+        const auto direction_scaling_factor =
+            std::sqrt(direction[0] * direction[0] + direction[1] * direction[1] +
+                      direction[2] * direction[2]);
+        const auto scaled_offset = offset * direction_scaling_factor;
+        bounding_volume_._min_values[i_dir] -= static_cast<float>(scaled_offset);
+        bounding_volume_._max_values[i_dir] += static_cast<float>(scaled_offset);
+      }
+    }
+
+    //! Native k-DOP storage.
+    KDOP bounding_volume_;
 #else
     /*! \brief Constructor initializing the bounding volume corners with numerical limit values.
      */
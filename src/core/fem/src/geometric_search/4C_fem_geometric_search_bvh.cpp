@@ -9,12 +9,15 @@
 
 #include "4C_fem_geometric_search_access_traits.hpp"
 #include "4C_fem_geometric_search_bounding_volume.hpp"
+#include "4C_fem_geometric_search_linear_bvh.hpp"
 #include "4C_fem_geometric_search_utils.hpp"
 #include "4C_io_pstream.hpp"
 
 #include <Epetra_MpiComm.h>
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <tuple>
+
 #ifdef FOUR_C_WITH_ARBORX
 #include <ArborX.hpp>
 #endif
@@ -28,13 +31,6 @@ namespace Core::GeometricSearch
       const std::vector<std::pair<int, BoundingVolume>>& predicates, const Epetra_Comm& comm,
       const Core::IO::Verbositylevel verbosity)
   {
-#ifndef FOUR_C_WITH_ARBORX
-    FOUR_C_THROW(
-        "Core::GeometricSearch::CollisionSearch can only be used with ArborX."
-        "To use it, enable ArborX during the configure process.");
-    return {};
-#else
-
     TEUCHOS_FUNC_TIME_MONITOR("Core::GeometricSearch::CollisionSearch");
 
     std::vector<int> indices_final;
@@ -54,6 +50,11 @@ namespace Core::GeometricSearch
     }
     else
     {
+#ifndef FOUR_C_WITH_ARBORX
+      // Without ArborX, the native linear bounding volume hierarchy is used.
+      LinearBoundingVolumeHierarchy bounding_volume_hierarchy(primitives);
+      std::tie(indices_final, offsets_final) = bounding_volume_hierarchy.query(predicates);
+#else
       using memory_space = Kokkos::HostSpace;
 
       // Build tree structure containting all primitives.
@@ -86,6 +87,7 @@ namespace Core::GeometricSearch
           indices_final.begin(), indices_full.data(), indices_full.data() + indices_full.extent(0));
       offsets_final.insert(
           offsets_final.begin(), offset_full.data(), offset_full.data() + offset_full.extent(0));
+#endif
     }
 
     if (verbosity == Core::IO::verbose)
@@ -96,7 +98,6 @@ namespace Core::GeometricSearch
     }
 
     return {indices_final, offsets_final};
-#endif
   }
 }  // namespace Core::GeometricSearch
 
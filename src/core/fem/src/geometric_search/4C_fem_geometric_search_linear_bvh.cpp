@@ -0,0 +1,292 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_fem_geometric_search_linear_bvh.hpp"
+
+#include "4C_utils_shared_memory_parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  using PaddedKDOP = Core::GeometricSearch::LinearBoundingVolumeHierarchy::PaddedKDOP;
+  constexpr int padded_directions =
+      Core::GeometricSearch::LinearBoundingVolumeHierarchy::padded_directions;
+  static_assert(padded_directions >= Core::GeometricSearch::kdop_directions);
+
+  //! Chunk size of the parallel loops
+  constexpr int chunk_size = 256;
+
+  PaddedKDOP padded_kdop(const Core::GeometricSearch::BoundingVolume& volume)
+  {
+    PaddedKDOP kdop;
+    for (int i = 0; i < padded_directions; ++i)
+    {
+      if (i < Core::GeometricSearch::kdop_directions)
+      {
+        kdop.min[i] = volume.bounding_volume_._min_values[i];
+        kdop.max[i] = volume.bounding_volume_._max_values[i];
+      }
+      else
+      {
+        kdop.min[i] = std::numeric_limits<float>::lowest();
+        kdop.max[i] = std::numeric_limits<float>::max();
+      }
+    }
+    return kdop;
+  }
+
+  //! Two k-DOPs overlap if their slabs overlap in every direction. No early exit, such that the
+  //! loop is vectorized.
+  inline bool overlap(const PaddedKDOP& a, const PaddedKDOP& b)
+  {
+    int result = 1;
+    for (int i = 0; i < padded_directions; ++i)
+      result &= static_cast<int>(a.min[i] <= b.max[i]) & static_cast<int>(b.min[i] <= a.max[i]);
+    return result != 0;
+  }
+
+  inline void merge(const PaddedKDOP& a, const PaddedKDOP& b, PaddedKDOP& result)
+  {
+    for (int i = 0; i < padded_directions; ++i)
+    {
+      result.min[i] = std::min(a.min[i], b.min[i]);
+      result.max[i] = std::max(a.max[i], b.max[i]);
+    }
+  }
+
+  //! Spread the lower 10 bits of @p v such that there are two zero bits between each of them.
+  inline std::uint32_t expand_bits(std::uint32_t v)
+  {
+    v = (v * 0x00010001u) & 0xFF0000FFu;
+    v = (v * 0x00000101u) & 0x0F00F00Fu;
+    v = (v * 0x00000011u) & 0xC30C30C3u;
+    v = (v * 0x00000005u) & 0x49249249u;
+    return v;
+  }
+
+  //! 30 bit Morton code of a point with coordinates in the unit cube
+  inline std::uint32_t morton_code(const std::array<float, 3>& x)
+  {
+    std::uint32_t code = 0;
+    for (int dim = 0; dim < 3; ++dim)
+    {
+      // clamp to the unit cube, e.g., for empty bounding volumes
+      const float scaled = x[dim] * 1024.0f;
+      const float clamped = scaled > 0.0f ? std::min(scaled, 1023.0f) : 0.0f;
+      code |= expand_bits(static_cast<std::uint32_t>(clamped)) << (2 - dim);
+    }
+    return code;
+  }
+}  // namespace
+
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+Core::GeometricSearch::LinearBoundingVolumeHierarchy::LinearBoundingVolumeHierarchy(
+    const std::vector<std::pair<int, BoundingVolume>>& primitives)
+    : num_primitives_(static_cast<int>(primitives.size()))
+{
+  const int n = num_primitives_;
+  if (n == 0) return;
+
+  const int num_threads = Core::Utils::max_threads();
+
+  // The first three k-DOP directions are the Cartesian axes, i.e., they give the axis aligned
+  // bounding box of the primitive which is used for the Morton codes.
+  std::array<float, 3> scene_min, scene_max;
+  scene_min.fill(std::numeric_limits<float>::max());
+  scene_max.fill(std::numeric_limits<float>::lowest());
+  for (const auto& [id, volume] : primitives)
+  {
+    for (int dim = 0; dim < 3; ++dim)
+    {
+      // skip empty bounding volumes
+      const auto& kdop = volume.bounding_volume_;
+      if (kdop._min_values[dim] > kdop._max_values[dim]) continue;
+
+      const float center = 0.5f * (kdop._min_values[dim] + kdop._max_values[dim]);
+      scene_min[dim] = std::min(scene_min[dim], center);
+      scene_max[dim] = std::max(scene_max[dim], center);
+    }
+  }
+  std::array<float, 3> scene_scaling;
+  for (int dim = 0; dim < 3; ++dim)
+  {
+    const float extent = scene_max[dim] - scene_min[dim];
+    scene_scaling[dim] = extent > 0.0f ? 1.0f / extent : 0.0f;
+  }
+
+  std::vector<std::uint32_t> codes(n);
+  Core::Utils::parallel_for(
+      n, num_threads,
+      [&](int i)
+      {
+        const auto& kdop = primitives[i].second.bounding_volume_;
+        std::array<float, 3> x;
+        for (int dim = 0; dim < 3; ++dim)
+        {
+          const float center = 0.5f * (kdop._min_values[dim] + kdop._max_values[dim]);
+          x[dim] = (center - scene_min[dim]) * scene_scaling[dim];
+        }
+        codes[i] = morton_code(x);
+      },
+      chunk_size);
+
+  // sort the primitives along the Morton curve, equal codes are ordered by index
+  leaf_primitives_.resize(n);
+  std::iota(leaf_primitives_.begin(), leaf_primitives_.end(), 0);
+  std::sort(leaf_primitives_.begin(), leaf_primitives_.end(),
+      [&](int a, int b) { return codes[a] < codes[b] or (codes[a] == codes[b] and a < b); });
+
+  std::vector<std::uint32_t> sorted_codes(n);
+  volumes_.resize(2 * n - 1);
+  Core::Utils::parallel_for(
+      n, num_threads,
+      [&](int i)
+      {
+        sorted_codes[i] = codes[leaf_primitives_[i]];
+        volumes_[n - 1 + i] = padded_kdop(primitives[leaf_primitives_[i]].second);
+      },
+      chunk_size);
+
+  if (n == 1) return;
+
+  // Length of the common prefix of the keys i and j, where the key is the Morton code augmented by
+  // the leaf index to make it unique. Returns -1 if j is out of range.
+  const auto delta = [&](int i, int j) -> int
+  {
+    if (j < 0 or j >= n) return -1;
+    if (sorted_codes[i] == sorted_codes[j])
+      return 32 + __builtin_clz(static_cast<std::uint32_t>(i ^ j));
+    return __builtin_clz(sorted_codes[i] ^ sorted_codes[j]);
+  };
+
+  // Build the binary radix tree. Every internal node is computed independently.
+  children_.resize(n - 1);
+  std::vector<int> parents(2 * n - 1, -1);
+  Core::Utils::parallel_for(
+      n - 1, num_threads,
+      [&](int i)
+      {
+        // direction of the range of the node
+        const int d = (delta(i, i + 1) - delta(i, i - 1)) >= 0 ? 1 : -1;
+
+        // upper bound of the length of the range
+        const int delta_min = delta(i, i - d);
+        int l_max = 2;
+        while (delta(i, i + l_max * d) > delta_min) l_max *= 2;
+
+        // other end of the range by binary search
+        int l = 0;
+        for (int t = l_max / 2; t >= 1; t /= 2)
+          if (delta(i, i + (l + t) * d) > delta_min) l += t;
+        const int j = i + l * d;
+
+        // split position by binary search
+        const int delta_node = delta(i, j);
+        int s = 0;
+        int t = l;
+        do
+        {
+          t = (t + 1) / 2;
+          if (delta(i, i + (s + t) * d) > delta_node) s += t;
+        } while (t > 1);
+        const int gamma = i + s * d + std::min(d, 0);
+
+        const int left = std::min(i, j) == gamma ? n - 1 + gamma : gamma;
+        const int right = std::max(i, j) == gamma + 1 ? n + gamma : gamma + 1;
+        children_[i] = {left, right};
+        parents[left] = i;
+        parents[right] = i;
+      },
+      chunk_size);
+
+  // Compute the bounding volumes bottom up. The second thread arriving at a node merges the
+  // volumes of both children and continues with the parent.
+  std::unique_ptr<std::atomic<int>[]> visits(new std::atomic<int>[n - 1]);
+  for (int i = 0; i < n - 1; ++i) visits[i].store(0, std::memory_order_relaxed);
+
+  Core::Utils::parallel_for(
+      n, num_threads,
+      [&](int leaf)
+      {
+        int node = parents[n - 1 + leaf];
+        while (node >= 0)
+        {
+          if (visits[node].fetch_add(1, std::memory_order_acq_rel) == 0) return;
+          merge(volumes_[children_[node].first], volumes_[children_[node].second], volumes_[node]);
+          node = parents[node];
+        }
+      },
+      chunk_size);
+}
+
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+std::pair<std::vector<int>, std::vector<int>>
+Core::GeometricSearch::LinearBoundingVolumeHierarchy::query(
+    const std::vector<std::pair<int, BoundingVolume>>& predicates) const
+{
+  const int num_predicates = static_cast<int>(predicates.size());
+  const int n = num_primitives_;
+
+  std::vector<std::vector<int>> hits(num_predicates);
+  if (n > 0)
+  {
+    const int num_threads = Core::Utils::max_threads();
+    std::vector<std::vector<int>> stacks(num_threads);
+
+    Core::Utils::parallel_for(
+        num_predicates, num_threads,
+        [&](int i_predicate)
+        {
+          const PaddedKDOP predicate = padded_kdop(predicates[i_predicate].second);
+          std::vector<int>& my_hits = hits[i_predicate];
+          std::vector<int>& stack = stacks[Core::Utils::thread_id()];
+
+          stack.clear();
+          stack.push_back(0);
+          while (!stack.empty())
+          {
+            const int node = stack.back();
+            stack.pop_back();
+            if (!overlap(volumes_[node], predicate)) continue;
+
+            if (node >= n - 1)
+              my_hits.push_back(leaf_primitives_[node - (n - 1)]);
+            else
+            {
+              stack.push_back(children_[node].second);
+              stack.push_back(children_[node].first);
+            }
+          }
+          std::sort(my_hits.begin(), my_hits.end());
+        },
+        chunk_size / 8);
+  }
+
+  std::vector<int> offsets(num_predicates + 1, 0);
+  for (int i = 0; i < num_predicates; ++i)
+    offsets[i + 1] = offsets[i] + static_cast<int>(hits[i].size());
+
+  std::vector<int> indices(offsets.back());
+  for (int i = 0; i < num_predicates; ++i)
+    std::copy(hits[i].begin(), hits[i].end(), indices.begin() + offsets[i]);
+
+  return {indices, offsets};
+}
+
+FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,85 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_FEM_GEOMETRIC_SEARCH_LINEAR_BVH_HPP
+#define FOUR_C_FEM_GEOMETRIC_SEARCH_LINEAR_BVH_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_fem_geometric_search_bounding_volume.hpp"
+
+#include <utility>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::GeometricSearch
+{
+  /*!
+   * \brief A linear bounding volume hierarchy (LBVH) of k-DOPs that does not depend on ArborX.
+   *
+   * The primitives are sorted along a Morton curve through the centers of their bounding volumes
+   * and the binary radix tree over the sorted Morton codes is built with the algorithm of Karras
+   * (2012). Every node of the tree stores a k-DOP that encloses the k-DOPs of its children, i.e.,
+   * the hierarchy is built directly on the k-DOPs and not on axis aligned boxes.
+   *
+   * The Morton codes, the tree topology and the bounding volumes of the nodes are computed in
+   * parallel if 4C is built with OpenMP. The nodes are stored in contiguous arrays and every
+   * k-DOP is padded to a multiple of the SIMD width, such that the overlap test of two k-DOPs is
+   * a branch-free loop the compiler can vectorize.
+   */
+  class LinearBoundingVolumeHierarchy
+  {
+   public:
+    /*!
+     * \brief Build the hierarchy of the given primitives.
+     */
+    explicit LinearBoundingVolumeHierarchy(
+        const std::vector<std::pair<int, BoundingVolume>>& primitives);
+
+    /*!
+     * \brief Find all primitives intersecting the predicates.
+     *
+     * The result has the same format as the one of collision_search(), i.e., the primitives
+     * intersecting predicate i are indices[offsets[i]] to indices[offsets[i+1]-1]. The indices of
+     * each predicate are sorted.
+     */
+    [[nodiscard]] std::pair<std::vector<int>, std::vector<int>> query(
+        const std::vector<std::pair<int, BoundingVolume>>& predicates) const;
+
+    //! Number of primitives in the hierarchy
+    [[nodiscard]] int size() const { return num_primitives_; }
+
+    //! Number of floats of a padded k-DOP slab array
+    static constexpr int padded_directions = 16;
+
+    //! k-DOP of a node, padded with slabs that always overlap.
+    struct alignas(64) PaddedKDOP
+    {
+      float min[padded_directions];
+      float max[padded_directions];
+    };
+
+   private:
+    //! Number of primitives, i.e., leaves of the tree
+    int num_primitives_;
+
+    //! Index of the primitive of each leaf
+    std::vector<int> leaf_primitives_;
+
+    //! Children of the internal nodes. The internal nodes are numbered 0 to n-2 and the leaves
+    //! n-1 to 2n-2, where n is the number of primitives.
+    std::vector<std::pair<int, int>> children_;
+
+    //! Bounding volumes of the internal nodes followed by the ones of the leaves
+    std::vector<PaddedKDOP> volumes_;
+  };
+}  // namespace Core::GeometricSearch
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
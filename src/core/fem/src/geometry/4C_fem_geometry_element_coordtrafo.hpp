@@ -33,7 +33,7 @@ namespace Core::Geo
       const M& xyze, const V& xsi, Core::LinAlg::Matrix<prob_dim, 1>& x)
   {
     const int numNodes = Core::FE::num_nodes<distype>;
-    static Core::LinAlg::Matrix<numNodes, 1> funct;
+    Core::LinAlg::Matrix<numNodes, 1> funct;
 
     Core::FE::shape_function<distype>(xsi, funct);
 
@@ -190,9 +190,9 @@ namespace Core::Geo
       case FE::CellType::hex27:
       {
         // split hex element into 5 tetrahedra in order to obtain a good initial guess
-        static Core::LinAlg::Matrix<4, 4> A_tet;
-        static Core::LinAlg::Matrix<4, 1> b_tet;
-        static Core::LinAlg::Matrix<4, 1> x_tet;
+        Core::LinAlg::Matrix<4, 4> A_tet;
+        Core::LinAlg::Matrix<4, 1> b_tet;
+        Core::LinAlg::Matrix<4, 1> x_tet;
 
 
         // first tet 1 3 4 6 + fourth row filled with ones
@@ -583,7 +583,7 @@ namespace Core::Geo
   )
   {
     const int numNodes = Core::FE::num_nodes<distype>;
-    static Core::LinAlg::Matrix<dim, numNodes> deriv1;
+    Core::LinAlg::Matrix<dim, numNodes> deriv1;
     Core::FE::shape_function_deriv1<distype>(xsi, deriv1);
 
     A.clear();
@@ -607,7 +607,7 @@ namespace Core::Geo
   )
   {
     const int numNodes = Core::FE::num_nodes<distype>;
-    static Core::LinAlg::Matrix<numNodes, 1> funct;
+    Core::LinAlg::Matrix<numNodes, 1> funct;
     funct.clear();
     Core::FE::shape_function<distype>(xsi, funct);
 
@@ -656,9 +656,9 @@ namespace Core::Geo
     const int maxiter = 20;  // 40;
     double residual = 1.0;
 
-    static Core::LinAlg::Matrix<3, 3> A;
-    static Core::LinAlg::Matrix<3, 1> b;
-    static Core::LinAlg::Matrix<3, 1> dx;
+    Core::LinAlg::Matrix<3, 3> A;
+    Core::LinAlg::Matrix<3, 1> b;
+    Core::LinAlg::Matrix<3, 1> dx;
 
     A.clear();
     b.clear();
@@ -816,7 +816,7 @@ namespace Core::Geo
   {
     const int numNodes = Core::FE::num_nodes<distype>;
 
-    static Core::LinAlg::Matrix<2, numNodes> deriv1;
+    Core::LinAlg::Matrix<2, numNodes> deriv1;
     Core::FE::shape_function_2d_deriv1(deriv1, xsi(0), xsi(1), distype);
 
     Jacobi.clear();
@@ -842,7 +842,7 @@ namespace Core::Geo
       const M& xyze_surfaceElement)
   {
     const int numNodes = Core::FE::num_nodes<distype>;
-    static Core::LinAlg::Matrix<numNodes, 1> funct;
+    Core::LinAlg::Matrix<numNodes, 1> funct;
     Core::FE::shape_function_2d(funct, xsi(0), xsi(1), distype);
 
     F.clear();
@@ -869,11 +869,11 @@ namespace Core::Geo
       const Core::LinAlg::Matrix<2, 1>& xsi, const M& xyze_surfaceElement)
   {
     const int numNodes = Core::FE::num_nodes<distype>;
-    static Core::LinAlg::Matrix<3, numNodes> deriv2;
+    Core::LinAlg::Matrix<3, numNodes> deriv2;
     Core::FE::shape_function_2d_deriv2(deriv2, xsi(0), xsi(1), distype);
 
     // third order tensor 3 x 2 x 2 stored as 3x2 and 3x2 so 3x4
-    static Core::LinAlg::Matrix<3, 4> tensor3order;
+    Core::LinAlg::Matrix<3, 4> tensor3order;
     tensor3order.clear();
 
     for (int i = 0; i < 3; ++i)
@@ -910,11 +910,11 @@ namespace Core::Geo
       iter++;
 
       // compute Jacobian, f and b
-      static Core::LinAlg::Matrix<3, 2> Jacobi;
-      static Core::LinAlg::Matrix<3, 1> F;
+      Core::LinAlg::Matrix<3, 2> Jacobi;
+      Core::LinAlg::Matrix<3, 1> F;
       update_jacobian_for_map3_to2<distype>(Jacobi, eleCoord, xyze_surfaceElement);
       update_f_for_map3_to2<distype>(F, eleCoord, physCoord, xyze_surfaceElement);
-      static Core::LinAlg::Matrix<2, 1> b;
+      Core::LinAlg::Matrix<2, 1> b;
       b.clear();
 
       for (int i = 0; i < 2; ++i)
@@ -927,10 +927,10 @@ namespace Core::Geo
       }
 
       // compute system matrix A
-      static Core::LinAlg::Matrix<2, 2> A;
+      Core::LinAlg::Matrix<2, 2> A;
       update_a_for_map3_to2<distype>(A, Jacobi, F, eleCoord, xyze_surfaceElement);
 
-      static Core::LinAlg::Matrix<2, 1> dx;
+      Core::LinAlg::Matrix<2, 1> dx;
       dx = 0.0;
 
       double det = Core::LinAlg::gauss_elimination<true, 2>(A, b, dx);
@@ -1011,21 +1011,21 @@ namespace Core::Geo
       iter++;
 
       // determine shapefunction, 1. and 2. derivative at current solutiom
-      static Core::LinAlg::Matrix<numNodes, 1> funct;
+      Core::LinAlg::Matrix<numNodes, 1> funct;
       Core::FE::shape_function_1d(funct, eleCoord(0), distype);
 
-      static Core::LinAlg::Matrix<1, numNodes> deriv1;
+      Core::LinAlg::Matrix<1, numNodes> deriv1;
       Core::FE::shape_function_1d_deriv1(deriv1, eleCoord(0), distype);
 
-      static Core::LinAlg::Matrix<1, numNodes> deriv2;
+      Core::LinAlg::Matrix<1, numNodes> deriv2;
       Core::FE::shape_function_1d_deriv2(deriv2, eleCoord(0), distype);
 
       // compute nonlinear system
-      static Core::LinAlg::Matrix<3, 1> F;
+      Core::LinAlg::Matrix<3, 1> F;
       // compute first derivative of r
-      static Core::LinAlg::Matrix<3, 1> F_deriv1;
+      Core::LinAlg::Matrix<3, 1> F_deriv1;
       // compute first derivative of r
-      static Core::LinAlg::Matrix<3, 1> F_deriv2;
+      Core::LinAlg::Matrix<3, 1> F_deriv2;
 
       F.clear();
       F_deriv1.clear();
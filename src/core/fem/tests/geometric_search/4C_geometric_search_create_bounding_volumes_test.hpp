@@ -10,8 +10,6 @@
 
 #include "4C_config.hpp"
 
-#ifdef FOUR_C_WITH_ARBORX
-
 #include "4C_fem_geometric_search_bounding_volume.hpp"
 #include "4C_linalg_fixedsizematrix.hpp"
 
@@ -90,5 +88,3 @@ namespace
 FOUR_C_NAMESPACE_CLOSE
 
 #endif
-
-#endif
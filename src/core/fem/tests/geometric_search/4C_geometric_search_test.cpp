@@ -10,16 +10,14 @@
 #include "4C_config.hpp"
 
 #include "4C_fem_geometric_search_bounding_volume.hpp"
-#include "4C_fem_geometric_search_utils.hpp"
-
-#ifdef FOUR_C_WITH_ARBORX
-
 #include "4C_fem_geometric_search_bvh.hpp"
 #include "4C_fem_geometric_search_utils.hpp"
 #include "4C_geometric_search_create_bounding_volumes_test.hpp"
 
 #include <Epetra_SerialComm.h>
 
+#include <random>
+
 namespace
 {
   using namespace FourC;
@@ -27,9 +25,11 @@ namespace
   class GeometricSearch : public ::testing::Test
   {
    public:
+#ifdef FOUR_C_WITH_ARBORX
     static void SetUpTestSuite() { Kokkos::initialize(); }
 
     static void TearDownTestSuite() { Kokkos::finalize(); }
+#endif
 
     GeometricSearch()
     {
@@ -131,6 +131,65 @@ namespace
     EXPECT_EQ(pairs.size(), 0);
   }
 
+  /**
+   * Checking collision search of many randomly placed kdops against a brute force search
+   */
+  TEST_F(GeometricSearch, CollisionSearchMatchesBruteForce)
+  {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> position(0.0, 10.0);
+    std::uniform_real_distribution<double> offset(-0.5, 0.5);
+
+    const auto create_volumes = [&](int n, int first_id)
+    {
+      std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>> volumes;
+      for (int i = 0; i < n; ++i)
+      {
+        Core::GeometricSearch::BoundingVolume volume;
+        Core::LinAlg::Matrix<3, 1, double> center(true);
+        for (int dim = 0; dim < 3; ++dim) center(dim) = position(generator);
+        for (int i_point = 0; i_point < 3; ++i_point)
+        {
+          Core::LinAlg::Matrix<3, 1, double> point(center);
+          for (int dim = 0; dim < 3; ++dim) point(dim) += offset(generator);
+          volume.add_point(point);
+        }
+        volume.extend_boundaries(0.05);
+        volumes.emplace_back(first_id + i, volume);
+      }
+      return volumes;
+    };
+
+    primitives_ = create_volumes(500, 0);
+    predicates_ = create_volumes(200, 500);
+
+    const auto &[indices, offsets] =
+        Core::GeometricSearch::collision_search(primitives_, predicates_, comm_, verbosity_);
+    auto pairs = Core::GeometricSearch::get_pairs(indices, offsets);
+    std::sort(pairs.begin(), pairs.end());
+
+    const auto intersects = [](const auto &a, const auto &b)
+    {
+      for (int i = 0; i < Core::GeometricSearch::kdop_directions; ++i)
+      {
+        if (a.bounding_volume_._min_values[i] > b.bounding_volume_._max_values[i] or
+            b.bounding_volume_._min_values[i] > a.bounding_volume_._max_values[i])
+          return false;
+      }
+      return true;
+    };
+
+    std::vector<std::pair<int, int>> expected_pairs;
+    for (std::size_t i_predicate = 0; i_predicate < predicates_.size(); ++i_predicate)
+      for (std::size_t i_primitive = 0; i_primitive < primitives_.size(); ++i_primitive)
+        if (intersects(predicates_[i_predicate].second, primitives_[i_primitive].second))
+          expected_pairs.emplace_back(i_predicate, i_primitive);
+
+    EXPECT_GT(expected_pairs.size(), 0);
+    EXPECT_EQ(pairs, expected_pairs);
+  }
+
+#ifdef FOUR_C_WITH_ARBORX
   /**
    * Check that the tolerance mechanism in the kDOP visualization works. The present values are
    * taken from a previously failing kDOP.
@@ -167,6 +226,5 @@ namespace
 
     get_k_dop_polyhedron_representation(kdop);
   }
-}  // namespace
-
 #endif
+}  // namespace
@@ -11,7 +11,9 @@
 #include "4C_fem_general_element.hpp"
 #include "4C_fem_general_node.hpp"
 #include "4C_fem_nurbs_discretization.hpp"
+#include "4C_io_asynchronous_output.hpp"
 #include "4C_io_control.hpp"
+#include "4C_io_hdf_shared_file.hpp"
 #include "4C_io_legacy_table.hpp"
 #include "4C_linalg_utils_densematrix_communication.hpp"
 #include "4C_linalg_utils_sparse_algebra_manipulation.hpp"
@@ -21,6 +23,58 @@
 
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  /*!
+   * \brief Data of an HDF5 dataset that is handed to the asynchronous output
+   *
+   * If asynchronous output is enabled, the data is copied such that the caller may modify or
+   * destroy the original before the dataset is actually written. Otherwise, the original data is
+   * referenced since the dataset is written right away.
+   */
+  template <typename T>
+  class StagedData
+  {
+   public:
+    StagedData(const T* data, std::size_t size) : data_(data), size_(size)
+    {
+      if (Core::IO::AsynchronousOutput::instance().enabled())
+      {
+        copy_.assign(data, data + size);
+        data_ = copy_.data();
+      }
+    }
+
+    [[nodiscard]] const T* data() const { return data_; }
+
+    [[nodiscard]] hsize_t size() const { return size_; }
+
+   private:
+    std::vector<T> copy_;
+    const T* data_;
+    hsize_t size_;
+  };
+
+  template <typename T>
+  std::shared_ptr<const StagedData<T>> stage_data(const T* data, std::size_t size)
+  {
+    return std::make_shared<const StagedData<T>>(data, size);
+  }
+
+  /*!
+   * \brief Flush the HDF5 file of @p group once all previously handed over output is written
+   */
+  void flush_asynchronously(hid_t group, const std::string& filename)
+  {
+    Core::IO::AsynchronousOutput::instance().run(
+        [group, filename]()
+        {
+          const herr_t flush_status = H5Fflush(group, H5F_SCOPE_LOCAL);
+          if (flush_status < 0) FOUR_C_THROW("Failed to flush HDF file %s", filename.c_str());
+        });
+  }
+}  // namespace
+
 
 /*----------------------------------------------------------------------*/
 /*----------------------------------------------------------------------*/
@@ -252,7 +306,12 @@ void Core::IO::DiscretizationReader::read_char_vector(
   MAP* result = map_read_map(restart_step_, name.c_str());
   std::string value_path = map_read_string(result, "values");
 
-  charvec = reader_->read_char_vector(value_path, dis_->get_comm());
+  // the char data of all procs of a shared result file is split up by the sizes of their parts
+  const char* size_path = nullptr;
+  if (map_find_string(result, "sizes", &size_path))
+    charvec = reader_->read_char_vector(value_path, size_path, dis_->get_comm());
+  else
+    charvec = reader_->read_char_vector(value_path, dis_->get_comm());
 
   return;
 }
@@ -541,6 +600,9 @@ Core::IO::DiscretizationWriter::DiscretizationWriter(const Core::IO::Discretizat
 
   if (type == CopyType::deep)
   {
+    // the copy shares the HDF5 handles, so pending output of the original has to be finished
+    AsynchronousOutput::instance().wait();
+
     step_ = writer.step_;
     time_ = writer.time_;
     meshfile_ = writer.meshfile_;
@@ -558,6 +620,9 @@ Core::IO::DiscretizationWriter::DiscretizationWriter(const Core::IO::Discretizat
 /*----------------------------------------------------------------------*/
 Core::IO::DiscretizationWriter::~DiscretizationWriter()
 {
+  // files may only be closed after all output to them is written
+  AsynchronousOutput::instance().wait();
+
   if (meshfile_ != -1)
   {
     const herr_t status = H5Fclose(meshfile_);
@@ -614,6 +679,7 @@ void Core::IO::DiscretizationWriter::create_mesh_file(const int step)
       meshname << ".p" << Core::Communication::my_mpi_rank(get_comm());
     }
 
+    AsynchronousOutput::instance().wait();
     if (meshfile_ != -1)
     {
       const herr_t status = H5Fclose(meshfile_);
@@ -640,10 +706,11 @@ void Core::IO::DiscretizationWriter::create_result_file(const int step)
     resultname << output_->file_name() << ".result." << dis_->name() << ".s" << step;
 
     resultfilename_ = resultname.str();
-    if (Core::Communication::num_mpi_ranks(get_comm()) > 1)
+    if (Core::Communication::num_mpi_ranks(get_comm()) > 1 and not write_shared_result_file())
     {
       resultname << ".p" << Core::Communication::my_mpi_rank(get_comm());
     }
+    AsynchronousOutput::instance().wait();
     if (resultfile_ != -1)
     {
       herr_t status = H5Fclose(resultfile_);
@@ -657,13 +724,25 @@ void Core::IO::DiscretizationWriter::create_result_file(const int step)
     mapcache_.clear();
     mapstack_.clear();
 
-    resultfile_ = H5Fcreate(resultname.str().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    if (write_shared_result_file())
+      resultfile_ = create_shared_hdf5_file(resultname.str(), get_comm());
+    else
+      resultfile_ = H5Fcreate(resultname.str().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
     if (resultfile_ < 0) FOUR_C_THROW("Failed to open file %s", resultname.str().c_str());
     resultfile_changed_ = step;
   }
 }
 
 
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+bool Core::IO::DiscretizationWriter::write_shared_result_file() const
+{
+  // a single proc writes the same file anyway
+  return output_->write_shared_hdf5_file() and Core::Communication::num_mpi_ranks(get_comm()) > 1;
+}
+
+
 /*----------------------------------------------------------------------*/
 /*----------------------------------------------------------------------*/
 void Core::IO::DiscretizationWriter::new_result_file(int numb_run)
@@ -727,6 +806,11 @@ void Core::IO::DiscretizationWriter::new_step(const int step, const double time)
       }
     }
 
+    /* Finish the output of the previous step before the groups and files are changed. This
+     * bounds the staged data to a single step, while the output of a step is written during the
+     * computation of the following steps. */
+    AsynchronousOutput::instance().wait();
+
     step_ = step;
     time_ = time;
     std::ostringstream groupname;
@@ -759,7 +843,7 @@ void Core::IO::DiscretizationWriter::new_step(const int step, const double time)
 
       if (write_file)
       {
-        if (Core::Communication::num_mpi_ranks(get_comm()) > 1)
+        if (Core::Communication::num_mpi_ranks(get_comm()) > 1 and not write_shared_result_file())
         {
           output_->control_file() << "    num_output_proc = "
                                   << Core::Communication::num_mpi_ranks(get_comm()) << "\n";
@@ -829,21 +913,24 @@ void Core::IO::DiscretizationWriter::write_multi_vector(
   if (binio_)
   {
     std::string valuename = name + ".values";
-    double* data = vec.Values();
-    const hsize_t size = vec.MyLength() * vec.NumVectors();
-    if (size != 0)
+    const hid_t resultgroup = resultgroup_;
+    const std::size_t num_values = vec.MyLength() * vec.NumVectors();
+    if (write_shared_result_file())
     {
-      const herr_t make_status =
-          H5LTmake_dataset_double(resultgroup_, valuename.c_str(), 1, &size, data);
-      if (make_status < 0)
-        FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
+      write_shared_hdf5_dataset(resultgroup, valuename, H5T_NATIVE_DOUBLE, vec.Values(),
+          vec.MyLength(), vec.NumVectors(), output_->hdf5_compression_level(), get_comm());
     }
     else
     {
-      const herr_t make_status =
-          H5LTmake_dataset_double(resultgroup_, valuename.c_str(), 0, &size, data);
-      if (make_status < 0)
-        FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
+      AsynchronousOutput::instance().run(
+          [resultgroup, valuename, values = stage_data(vec.Values(), num_values)]()
+          {
+            const hsize_t size = values->size();
+            const herr_t make_status = H5LTmake_dataset_double(
+                resultgroup, valuename.c_str(), size != 0 ? 1 : 0, &size, values->data());
+            if (make_status < 0)
+              FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
+          });
     }
 
     std::string idname;
@@ -862,27 +949,38 @@ void Core::IO::DiscretizationWriter::write_multi_vector(
 
     const Epetra_BlockMapData* mapdata = vec.Map().DataPtr();
     std::map<const Epetra_BlockMapData*, std::string>::const_iterator m = mapcache_.find(mapdata);
-    if (m != mapcache_.end())
+    int write_map = m == mapcache_.end();
+    // datasets of a shared file are created collectively, thus all procs have to agree
+    if (write_shared_result_file())
+    {
+      int local_write_map = write_map;
+      get_comm().MaxAll(&local_write_map, &write_map, 1);
+    }
+    if (not write_map)
     {
       // the map has been written already, just link to it again
       idname = m->second;
     }
     else
     {
-      const hsize_t mapsize = vec.MyLength();
       idname = name + ".ids";
-      int* ids = vec.Map().MyGlobalElements();
-      if (size != 0)
+      if (write_shared_result_file())
       {
-        const herr_t make_status =
-            H5LTmake_dataset_int(resultgroup_, idname.c_str(), 1, &mapsize, ids);
-        if (make_status < 0) FOUR_C_THROW("Failed to create dataset in HDF-resultfile");
+        write_shared_hdf5_dataset(resultgroup, idname, H5T_NATIVE_INT,
+            vec.Map().MyGlobalElements(), vec.MyLength(), 1, output_->hdf5_compression_level(),
+            get_comm());
       }
       else
       {
-        const herr_t make_status =
-            H5LTmake_dataset_int(resultgroup_, idname.c_str(), 0, &mapsize, ids);
-        if (make_status < 0) FOUR_C_THROW("Failed to create dataset in HDF-resultfile");
+        AsynchronousOutput::instance().run(
+            [resultgroup, idname, num_values,
+                ids = stage_data(vec.Map().MyGlobalElements(), vec.MyLength())]()
+            {
+              const hsize_t mapsize = ids->size();
+              const herr_t make_status = H5LTmake_dataset_int(
+                  resultgroup, idname.c_str(), num_values != 0 ? 1 : 0, &mapsize, ids->data());
+              if (make_status < 0) FOUR_C_THROW("Failed to create dataset in HDF-resultfile");
+            });
       }
 
       idname = groupname.str() + idname;
@@ -935,11 +1033,7 @@ void Core::IO::DiscretizationWriter::write_multi_vector(
                               << "\"\n\n"  // different names + other informations?
                               << std::flush;
     }
-    const herr_t flush_status = H5Fflush(resultgroup_, H5F_SCOPE_LOCAL);
-    if (flush_status < 0)
-    {
-      FOUR_C_THROW("Failed to flush HDF file %s", resultfilename_.c_str());
-    }
+    flush_asynchronously(resultgroup, resultfilename_);
   }
 }
 
@@ -952,21 +1046,23 @@ void Core::IO::DiscretizationWriter::write_vector(const std::string name,
   if (binio_)
   {
     std::string valuename = name + ".values";
-    const hsize_t size = vec.size();
-    const char* data = vec.data();
-    if (size != 0)
+    const hid_t resultgroup = resultgroup_;
+    if (write_shared_result_file())
     {
-      const herr_t make_status =
-          H5LTmake_dataset_char(resultgroup_, valuename.c_str(), 1, &size, data);
-      if (make_status < 0)
-        FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
+      write_shared_hdf5_dataset(resultgroup, valuename, H5T_NATIVE_CHAR, vec.data(), vec.size(),
+          1, output_->hdf5_compression_level(), get_comm());
     }
     else
     {
-      const herr_t make_status =
-          H5LTmake_dataset_char(resultgroup_, valuename.c_str(), 0, &size, data);
-      if (make_status < 0)
-        FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
+      AsynchronousOutput::instance().run(
+          [resultgroup, valuename, values = stage_data(vec.data(), vec.size())]()
+          {
+            const hsize_t size = values->size();
+            const herr_t make_status = H5LTmake_dataset_char(
+                resultgroup, valuename.c_str(), size != 0 ? 1 : 0, &size, values->data());
+            if (make_status < 0)
+              FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
+          });
     }
 
     std::string idname;
@@ -985,19 +1081,38 @@ void Core::IO::DiscretizationWriter::write_vector(const std::string name,
 
     const Epetra_BlockMapData* mapdata = elemap.DataPtr();
     std::map<const Epetra_BlockMapData*, std::string>::const_iterator m = mapcache_.find(mapdata);
-    if (m != mapcache_.end())
+    int write_map = m == mapcache_.end();
+    // datasets of a shared file are created collectively, thus all procs have to agree
+    if (write_shared_result_file())
+    {
+      int local_write_map = write_map;
+      get_comm().MaxAll(&local_write_map, &write_map, 1);
+    }
+    if (not write_map)
     {
       // the map has been written already, just link to it again
       idname = m->second;
     }
     else
     {
-      const hsize_t mapsize = elemap.NumMyElements();
       idname = name + ".ids";
-      int* ids = elemap.MyGlobalElements();
-      const herr_t make_status =
-          H5LTmake_dataset_int(resultgroup_, idname.c_str(), 1, &mapsize, ids);
-      if (make_status < 0) FOUR_C_THROW("Failed to create dataset in HDF-resultfile");
+      if (write_shared_result_file())
+      {
+        write_shared_hdf5_dataset(resultgroup, idname, H5T_NATIVE_INT, elemap.MyGlobalElements(),
+            elemap.NumMyElements(), 1, output_->hdf5_compression_level(), get_comm());
+      }
+      else
+      {
+        AsynchronousOutput::instance().run(
+            [resultgroup, idname,
+                ids = stage_data(elemap.MyGlobalElements(), elemap.NumMyElements())]()
+            {
+              const hsize_t mapsize = ids->size();
+              const herr_t make_status =
+                  H5LTmake_dataset_int(resultgroup, idname.c_str(), 1, &mapsize, ids->data());
+              if (make_status < 0) FOUR_C_THROW("Failed to create dataset in HDF-resultfile");
+            });
+      }
 
       idname = groupname.str() + idname;
 
@@ -1049,11 +1164,7 @@ void Core::IO::DiscretizationWriter::write_vector(const std::string name,
                               << "\"\n\n"  // different names + other informations?
                               << std::flush;
     }
-    const herr_t flush_status = H5Fflush(resultgroup_, H5F_SCOPE_LOCAL);
-    if (flush_status < 0)
-    {
-      FOUR_C_THROW("Failed to flush HDF file %s", resultfilename_.c_str());
-    }
+    flush_asynchronously(resultgroup, resultfilename_);
   }
 }
 
@@ -1063,6 +1174,9 @@ void Core::IO::DiscretizationWriter::write_mesh(const int step, const double tim
 {
   if (binio_)
   {
+    // the mesh is written rarely and synchronously, so wait for all pending output
+    AsynchronousOutput::instance().wait();
+
     if (step - meshfile_changed_ >= output_->file_steps() or meshfile_changed_ == -1)
     {
       create_mesh_file(step);
@@ -1212,6 +1326,9 @@ void Core::IO::DiscretizationWriter::write_only_nodes_in_new_field_group_to_cont
 {
   if (binio_)
   {
+    // the mesh is written rarely and synchronously, so wait for all pending output
+    AsynchronousOutput::instance().wait();
+
     if (step - meshfile_changed_ >= output_->file_steps() or meshfile_changed_ == -1)
     {
       create_mesh_file(step);
@@ -1468,20 +1585,29 @@ void Core::IO::DiscretizationWriter::write_char_data(
     // only proc0 writes the vector entities to the binary data
     // an appropriate name has to be provided
     std::string valuename = name + ".values";
-    const hsize_t size = charvec.size();
-    if (size != 0)
+    const hid_t resultgroup = resultgroup_;
+    std::string sizename = name + ".sizes";
+    if (write_shared_result_file())
     {
-      const herr_t make_status =
-          H5LTmake_dataset_char(resultgroup_, valuename.c_str(), 1, &size, charvec.data());
-      if (make_status < 0)
-        FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
+      write_shared_hdf5_dataset(resultgroup, valuename, H5T_NATIVE_CHAR, charvec.data(),
+          charvec.size(), 1, output_->hdf5_compression_level(), get_comm());
+
+      // the packed data of the procs cannot be told apart in the shared dataset, hence the size
+      // of each part is stored such that the restart can split it up again
+      const int size = static_cast<int>(charvec.size());
+      write_shared_hdf5_dataset(resultgroup, sizename, H5T_NATIVE_INT, &size, 1, 1, 0, get_comm());
     }
     else
     {
-      const herr_t make_status =
-          H5LTmake_dataset_char(resultgroup_, valuename.c_str(), 0, &size, charvec.data());
-      if (make_status < 0)
-        FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
+      AsynchronousOutput::instance().run(
+          [resultgroup, valuename, values = stage_data(charvec.data(), charvec.size())]()
+          {
+            const hsize_t size = values->size();
+            const herr_t make_status = H5LTmake_dataset_char(
+                resultgroup, valuename.c_str(), size != 0 ? 1 : 0, &size, values->data());
+            if (make_status < 0)
+              FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
+          });
     }
 
     // ... write other mesh informations
@@ -1493,15 +1619,17 @@ void Core::IO::DiscretizationWriter::write_char_data(
       groupname << "/step" << step_ << "/";
 
       valuename = groupname.str() + valuename;
+      sizename = groupname.str() + sizename;
 
       // a comment is also added to the control file
       output_->control_file() << "    " << name << ":\n"
-                              << "        values = \"" << valuename.c_str() << "\"\n\n"
-                              << std::flush;
+                              << "        values = \"" << valuename.c_str() << "\"\n";
+      if (write_shared_result_file())
+        output_->control_file() << "        sizes = \"" << sizename.c_str() << "\"\n";
+      output_->control_file() << "\n" << std::flush;
     }
 
-    const herr_t flush_status = H5Fflush(resultgroup_, H5F_SCOPE_LOCAL);
-    if (flush_status < 0) FOUR_C_THROW("Failed to flush HDF file %s", resultfilename_.c_str());
+    flush_asynchronously(resultgroup, resultfilename_);
   }
 }
 
@@ -1511,28 +1639,38 @@ void Core::IO::DiscretizationWriter::write_char_data(
 void Core::IO::DiscretizationWriter::write_redundant_double_vector(
     const std::string name, std::vector<double>& doublevec)
 {
-  if (binio_)
+  if (binio_ and write_shared_result_file())
+  {
+    // the dataset of a shared file is created by all procs, but only proc0 contributes data
+    const bool is_proc0 = Core::Communication::my_mpi_rank(get_comm()) == 0;
+    write_shared_hdf5_dataset(resultgroup_, name + ".values", H5T_NATIVE_DOUBLE, doublevec.data(),
+        is_proc0 ? doublevec.size() : 0, 1, output_->hdf5_compression_level(), get_comm());
+
+    if (is_proc0)
+    {
+      output_->control_file() << "    " << name << ":\n"
+                              << "        values = \"/step" << step_ << "/" << name
+                              << ".values\"\n\n"
+                              << std::flush;
+    }
+  }
+  else if (binio_)
   {
     if (Core::Communication::my_mpi_rank(get_comm()) == 0)
     {
       // only proc0 writes the vector entities to the binary data
       // an appropriate name has to be provided
       std::string valuename = name + ".values";
-      const hsize_t size = doublevec.size();
-      if (size != 0)
-      {
-        const herr_t make_status =
-            H5LTmake_dataset_double(resultgroup_, valuename.c_str(), 1, &size, doublevec.data());
-        if (make_status < 0)
-          FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
-      }
-      else
-      {
-        const herr_t make_status =
-            H5LTmake_dataset_double(resultgroup_, valuename.c_str(), 0, &size, doublevec.data());
-        if (make_status < 0)
-          FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
-      }
+      const hid_t resultgroup = resultgroup_;
+      AsynchronousOutput::instance().run(
+          [resultgroup, valuename, values = stage_data(doublevec.data(), doublevec.size())]()
+          {
+            const hsize_t size = values->size();
+            const herr_t make_status = H5LTmake_dataset_double(
+                resultgroup, valuename.c_str(), size != 0 ? 1 : 0, &size, values->data());
+            if (make_status < 0)
+              FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
+          });
 
       // do I need the following naming stuff?
       std::ostringstream groupname;
@@ -1546,8 +1684,7 @@ void Core::IO::DiscretizationWriter::write_redundant_double_vector(
                               << "        values = \"" << valuename.c_str() << "\"\n\n"
                               << std::flush;
 
-      const herr_t flush_status = H5Fflush(resultgroup_, H5F_SCOPE_LOCAL);
-      if (flush_status < 0) FOUR_C_THROW("Failed to flush HDF file %s", resultfilename_.c_str());
+      flush_asynchronously(resultgroup, resultfilename_);
     }  // endif proc0
   }
 }
@@ -1558,28 +1695,38 @@ void Core::IO::DiscretizationWriter::write_redundant_double_vector(
 void Core::IO::DiscretizationWriter::write_redundant_int_vector(
     const std::string name, std::vector<int>& vectorint)
 {
-  if (binio_)
+  if (binio_ and write_shared_result_file())
+  {
+    // the dataset of a shared file is created by all procs, but only proc0 contributes data
+    const bool is_proc0 = Core::Communication::my_mpi_rank(get_comm()) == 0;
+    write_shared_hdf5_dataset(resultgroup_, name + ".values", H5T_NATIVE_INT, vectorint.data(),
+        is_proc0 ? vectorint.size() : 0, 1, output_->hdf5_compression_level(), get_comm());
+
+    if (is_proc0)
+    {
+      output_->control_file() << "    " << name << ":\n"
+                              << "        values = \"/step" << step_ << "/" << name
+                              << ".values\"\n\n"
+                              << std::flush;
+    }
+  }
+  else if (binio_)
   {
     if (Core::Communication::my_mpi_rank(get_comm()) == 0)
     {
       // only proc0 writes the entities to the binary data
       // an appropriate name has to be provided
       std::string valuename = name + ".values";
-      const hsize_t size = vectorint.size();
-      if (size != 0)
-      {
-        const herr_t make_status =
-            H5LTmake_dataset_int(resultgroup_, valuename.c_str(), 1, &size, vectorint.data());
-        if (make_status < 0)
-          FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
-      }
-      else
-      {
-        const herr_t make_status =
-            H5LTmake_dataset_int(resultgroup_, valuename.c_str(), 0, &size, vectorint.data());
-        if (make_status < 0)
-          FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
-      }
+      const hid_t resultgroup = resultgroup_;
+      AsynchronousOutput::instance().run(
+          [resultgroup, valuename, values = stage_data(vectorint.data(), vectorint.size())]()
+          {
+            const hsize_t size = values->size();
+            const herr_t make_status = H5LTmake_dataset_int(
+                resultgroup, valuename.c_str(), size != 0 ? 1 : 0, &size, values->data());
+            if (make_status < 0)
+              FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
+          });
 
       // do I need the following naming stuff?
       std::ostringstream groupname;
@@ -1593,8 +1740,7 @@ void Core::IO::DiscretizationWriter::write_redundant_int_vector(
                               << "        values = \"" << valuename.c_str() << "\"\n\n"
                               << std::flush;
 
-      const herr_t flush_status = H5Fflush(resultgroup_, H5F_SCOPE_LOCAL);
-      if (flush_status < 0) FOUR_C_THROW("Failed to flush HDF file %s", resultfilename_.c_str());
+      flush_asynchronously(resultgroup, resultfilename_);
     }  // endif proc0
   }
 }
@@ -400,6 +400,9 @@ namespace Core::IO
     //! open new result file
     void create_result_file(const int step);
 
+    //! do all procs write into one shared result file
+    [[nodiscard]] bool write_shared_result_file() const;
+
     //! my discretization
     std::shared_ptr<Core::FE::Discretization> dis_;
 
@@ -0,0 +1,113 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_io_asynchronous_output.hpp"
+
+FOUR_C_NAMESPACE_OPEN
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+Core::IO::AsynchronousOutput& Core::IO::AsynchronousOutput::instance()
+{
+  static AsynchronousOutput asynchronous_output;
+  return asynchronous_output;
+}
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+Core::IO::AsynchronousOutput::~AsynchronousOutput()
+{
+  if (thread_.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    task_available_.notify_one();
+
+    // the remaining tasks are executed before the thread finishes
+    thread_.join();
+  }
+}
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+void Core::IO::AsynchronousOutput::set_enabled(bool enabled)
+{
+  if (enabled == enabled_) return;
+
+  if (!enabled) wait();
+
+  enabled_ = enabled;
+
+  if (enabled_ and !thread_.joinable()) thread_ = std::thread([this]() { process_tasks(); });
+}
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+void Core::IO::AsynchronousOutput::run(std::function<void()> task)
+{
+  if (!enabled_)
+  {
+    task();
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+  task_available_.notify_one();
+}
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+void Core::IO::AsynchronousOutput::wait()
+{
+  std::exception_ptr exception = nullptr;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    tasks_finished_.wait(lock, [this]() { return tasks_.empty() and !busy_; });
+    std::swap(exception, exception_);
+  }
+
+  if (exception) std::rethrow_exception(exception);
+}
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+void Core::IO::AsynchronousOutput::process_tasks()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;)
+  {
+    task_available_.wait(lock, [this]() { return stop_ or !tasks_.empty(); });
+    if (tasks_.empty()) return;
+
+    std::function<void()> task = std::move(tasks_.front());
+    tasks_.pop_front();
+    busy_ = true;
+    lock.unlock();
+
+    try
+    {
+      task();
+    }
+    catch (...)
+    {
+      lock.lock();
+      if (!exception_) exception_ = std::current_exception();
+      lock.unlock();
+    }
+
+    lock.lock();
+    busy_ = false;
+    if (tasks_.empty()) tasks_finished_.notify_all();
+  }
+}
+
+FOUR_C_NAMESPACE_CLOSE
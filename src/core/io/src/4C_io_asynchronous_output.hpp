@@ -0,0 +1,112 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_IO_ASYNCHRONOUS_OUTPUT_HPP
+#define FOUR_C_IO_ASYNCHRONOUS_OUTPUT_HPP
+
+#include "4C_config.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::IO
+{
+  /*!
+   * \brief Process-wide queue of output tasks that are executed by a single background thread
+   *
+   * The DiscretizationWriter hands all its HDF5 operations to this queue. If asynchronous output
+   * is enabled, the tasks are executed in order by a dedicated I/O thread while the calling thread
+   * continues, e.g., with the assembly and solve of the next time step. Otherwise, every task is
+   * executed immediately on the calling thread.
+   *
+   * All HDF5 calls of the writers go through the same thread, so HDF5 does not need to be built
+   * thread-safe. Code that accesses HDF5 files directly from the main thread (e.g. the HDFReader)
+   * has to call wait() first.
+   *
+   * Tasks must not depend on data that the caller may change after handing them over: everything
+   * a task writes has to be copied into staging buffers that are owned by the task.
+   */
+  class AsynchronousOutput
+  {
+   public:
+    //! the instance shared by all writers of this process
+    static AsynchronousOutput& instance();
+
+    ~AsynchronousOutput();
+
+    AsynchronousOutput(const AsynchronousOutput&) = delete;
+    AsynchronousOutput& operator=(const AsynchronousOutput&) = delete;
+
+    /*!
+     * \brief Switch asynchronous execution on or off
+     *
+     * Switching it off waits for all pending tasks.
+     */
+    void set_enabled(bool enabled);
+
+    //! Return whether tasks are executed by the background thread
+    [[nodiscard]] bool enabled() const { return enabled_; }
+
+    /*!
+     * \brief Execute the @p task
+     *
+     * If asynchronous output is enabled, the task is queued and executed later by the background
+     * thread. Otherwise, it is executed immediately.
+     */
+    void run(std::function<void()> task);
+
+    /*!
+     * \brief Wait until all queued tasks are finished
+     *
+     * If a task threw an exception, the first one is rethrown here.
+     */
+    void wait();
+
+   private:
+    AsynchronousOutput() = default;
+
+    //! main loop of the background thread
+    void process_tasks();
+
+    //! whether tasks are executed by the background thread
+    bool enabled_ = false;
+
+    //! the background thread (only started once asynchronous output is enabled)
+    std::thread thread_;
+
+    //! protects all members below
+    std::mutex mutex_;
+
+    //! notifies the background thread about new tasks or shutdown
+    std::condition_variable task_available_;
+
+    //! notifies waiting threads that all tasks are finished
+    std::condition_variable tasks_finished_;
+
+    //! queued tasks
+    std::deque<std::function<void()>> tasks_;
+
+    //! whether the background thread currently executes a task
+    bool busy_ = false;
+
+    //! whether the background thread has to stop
+    bool stop_ = false;
+
+    //! first exception thrown by a task and not yet rethrown
+    std::exception_ptr exception_ = nullptr;
+  };
+}  // namespace Core::IO
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
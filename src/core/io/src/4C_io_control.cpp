@@ -186,7 +186,9 @@ Core::IO::OutputControl::OutputControl(const OutputControl& ocontrol, const char
       filesteps_(ocontrol.filesteps_),
       restart_step_(ocontrol.restart_step_),
       myrank_(ocontrol.myrank_),
-      write_binary_output_(ocontrol.write_binary_output_)
+      write_binary_output_(ocontrol.write_binary_output_),
+      write_shared_hdf5_file_(ocontrol.write_shared_hdf5_file_),
+      hdf5_compression_level_(ocontrol.hdf5_compression_level_)
 {
   // replace file names if provided
   if (new_prefix)
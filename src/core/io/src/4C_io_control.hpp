@@ -120,6 +120,19 @@ namespace Core::IO
 
     bool write_binary_output() const { return write_binary_output_; }
 
+    /// whether all processes write their result data into one shared HDF5 file via MPI-IO
+    bool write_shared_hdf5_file() const { return write_shared_hdf5_file_; }
+
+    /// deflate level (0 to 9) of datasets in shared HDF5 files, 0 means no compression
+    int hdf5_compression_level() const { return hdf5_compression_level_; }
+
+    /// switch to one shared HDF5 result file instead of one file per process
+    void set_shared_hdf5_file(bool shared_file, int compression_level)
+    {
+      write_shared_hdf5_file_ = shared_file;
+      hdf5_compression_level_ = compression_level;
+    }
+
     /// overwrites result files
     void overwrite_result_file(const Core::FE::ShapeFunctionType& spatial_approx);
 
@@ -153,6 +166,8 @@ namespace Core::IO
     const int restart_step_;
     const int myrank_;
     const bool write_binary_output_;
+    bool write_shared_hdf5_file_ = false;
+    int hdf5_compression_level_ = 0;
   };
 
 
@@ -14,6 +14,8 @@
 #include "4C_io_input_file.hpp"
 #include "4C_rebalance_print.hpp"
 
+#include <Epetra_Util.h>
+
 FOUR_C_NAMESPACE_OPEN
 
 
@@ -180,59 +182,14 @@ void Core::IO::ElementReader::get_and_distribute_elements(const int nblock, cons
     {
       std::istringstream t{std::string{element_line}};
       int elenumber;
-      std::string eletype;
-      std::string distype;
-      // read element id type and distype
-      t >> elenumber >> eletype >> distype;
+      t >> elenumber;
       elenumber -= 1;
       gidlist.push_back(elenumber);
 
       // only read registered element types or all elements if nothing is
       // registered
-      if (elementtypes_.size() == 0 or elementtypes_.count(eletype) > 0)
+      if (read_element(std::string{element_line}, ed, 0))
       {
-        // let the factory create a matching empty element
-        std::shared_ptr<Core::Elements::Element> ele =
-            Core::Communication::factory(eletype, distype, elenumber, 0);
-        if (!ele) FOUR_C_THROW("element creation failed");
-
-        // For the time being we support old and new input facilities. To
-        // smooth transition.
-
-        Input::LineDefinition* linedef = ed.element_lines(eletype, distype);
-        if (linedef != nullptr)
-        {
-          if (not linedef->read(t))
-          {
-            std::cout << "\n" << elenumber << " " << eletype << " " << distype << " ";
-            linedef->print(std::cout);
-            std::cout << "\n";
-            std::cout << element_line << "\n";
-            FOUR_C_THROW(
-                "failed to read element %d %s %s", elenumber, eletype.c_str(), distype.c_str());
-          }
-
-          ele->set_node_ids(distype, linedef->container());
-          ele->read_element(eletype, distype, linedef->container());
-        }
-        else
-        {
-          FOUR_C_THROW(
-              "a matching line definition is needed for %s %s", eletype.c_str(), distype.c_str());
-        }
-
-        // add element to discretization
-        dis_->add_element(ele);
-
-        // get the node ids of this element
-        const int numnode = ele->num_node();
-        const int* nodeids = ele->node_ids();
-
-        // all node gids of this element are inserted into a set of
-        // node ids --- it will be used later during reading of nodes
-        // to add the node to one or more discretisations
-        std::copy(nodeids, nodeids + numnode, std::inserter(nodes_, nodes_.begin()));
-
         ++bcount;
 
         // Distribute the block if it is full. Never distribute the last block here because it
@@ -258,4 +215,122 @@ void Core::IO::ElementReader::get_and_distribute_elements(const int nblock, cons
   }
 }
 
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+void Core::IO::ElementReader::read_and_distribute_in_parallel()
+{
+  const int myrank = Core::Communication::my_mpi_rank(comm_);
+
+  Core::Elements::ElementDefinition ed;
+  ed.setup_valid_element_lines();
+
+  // every proc reads and keeps the elements of its part of the section
+  std::vector<int> my_eids;
+  for (const auto& element_line : input_.my_lines_in_section(sectionname_))
+  {
+    std::shared_ptr<Core::Elements::Element> ele = read_element(element_line, ed, myrank);
+    if (ele) my_eids.push_back(ele->id());
+  }
+
+  int my_numele = static_cast<int>(my_eids.size());
+  int numele = 0;
+  comm_.SumAll(&my_numele, &numele, 1);
+
+  if (numele == 0)
+  {
+    // If the element section is empty, we create an empty input and return
+    coleles_ = roweles_ = colnodes_ = rownodes_ =
+        std::make_shared<Epetra_Map>(-1, 0, nullptr, 0, comm_);
+
+    return;
+  }
+
+  roweles_ = std::make_shared<Epetra_Map>(-1, my_numele, my_eids.data(), 0, comm_);
+}
+
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+std::vector<bool> Core::IO::ElementReader::have_nodes(const std::vector<int>& node_ids) const
+{
+  // make the node ids of all procs unique, any owner will do
+  const std::vector<int> my_nodes(nodes_.begin(), nodes_.end());
+  const Epetra_Map overlapping_nodes(
+      -1, static_cast<int>(my_nodes.size()), my_nodes.data(), 0, comm_);
+  const Epetra_Map unique_nodes = Epetra_Util::Create_OneToOne_Map(overlapping_nodes);
+
+  // nodes without an owner are not part of any of our elements
+  const int numids = static_cast<int>(node_ids.size());
+  std::vector<int> pids(numids);
+  const int err = unique_nodes.RemoteIDList(numids, node_ids.data(), pids.data(), nullptr);
+  if (err < 0) FOUR_C_THROW("Epetra_BlockMap::RemoteIDList returned err=%d", err);
+
+  std::vector<bool> have(numids);
+  for (int i = 0; i < numids; ++i) have[i] = pids[i] >= 0;
+  return have;
+}
+
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+std::shared_ptr<Core::Elements::Element> Core::IO::ElementReader::read_element(
+    const std::string& element_line, Core::Elements::ElementDefinition& ed, int owner)
+{
+  std::istringstream t{element_line};
+  int elenumber;
+  std::string eletype;
+  std::string distype;
+  // read element id type and distype
+  t >> elenumber >> eletype >> distype;
+  elenumber -= 1;
+
+  // only read registered element types or all elements if nothing is registered
+  if (elementtypes_.size() != 0 and elementtypes_.count(eletype) == 0) return nullptr;
+
+  // let the factory create a matching empty element
+  std::shared_ptr<Core::Elements::Element> ele =
+      Core::Communication::factory(eletype, distype, elenumber, owner);
+  if (!ele) FOUR_C_THROW("element creation failed");
+
+  // For the time being we support old and new input facilities. To
+  // smooth transition.
+
+  Input::LineDefinition* linedef = ed.element_lines(eletype, distype);
+  if (linedef != nullptr)
+  {
+    if (not linedef->read(t))
+    {
+      std::cout << "\n" << elenumber << " " << eletype << " " << distype << " ";
+      linedef->print(std::cout);
+      std::cout << "\n";
+      std::cout << element_line << "\n";
+      FOUR_C_THROW(
+          "failed to read element %d %s %s", elenumber, eletype.c_str(), distype.c_str());
+    }
+
+    ele->set_node_ids(distype, linedef->container());
+    ele->read_element(eletype, distype, linedef->container());
+  }
+  else
+  {
+    FOUR_C_THROW(
+        "a matching line definition is needed for %s %s", eletype.c_str(), distype.c_str());
+  }
+
+  // add element to discretization
+  dis_->add_element(ele);
+
+  // get the node ids of this element
+  const int numnode = ele->num_node();
+  const int* nodeids = ele->node_ids();
+
+  // all node gids of this element are inserted into a set of
+  // node ids --- it will be used later during reading of nodes
+  // to add the node to one or more discretisations
+  std::copy(nodeids, nodeids + numnode, std::inserter(nodes_, nodes_.begin()));
+
+  return ele;
+}
+
 FOUR_C_NAMESPACE_CLOSE
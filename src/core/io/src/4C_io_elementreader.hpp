@@ -22,6 +22,11 @@ namespace Core::FE
 {
   class Discretization;
 }  // namespace Core::FE
+namespace Core::Elements
+{
+  class Element;
+  class ElementDefinition;
+}  // namespace Core::Elements
 namespace Core::IO
 {
   class InputFile;
@@ -45,7 +50,8 @@ namespace Core::IO
     - We cannot afford to read all elements or all nodes on one
       processor.
 
-    - Only processor 0 can actually read the (ascii) input file
+    - Only processor 0 can actually read the (ascii) input file, unless
+      the file is read in parallel, see read_and_distribute_in_parallel().
 
     - We do not want to setup (that is read) elements more than once.
 
@@ -136,6 +142,16 @@ namespace Core::IO
     */
     virtual void read_and_distribute();
 
+    /*! Read elements in parallel
+
+    Every processor reads the element lines of its own part of the element section (see
+    InputFile::my_lines_in_section()) and keeps the elements it has read. There is neither a
+    redundant vector of element ids nor a distribution of element blocks from processor 0. The
+    resulting element row map is a valid but arbitrary distribution which is improved by the
+    subsequent graph based partitioning, just like the linear map of read_and_distribute().
+    */
+    void read_and_distribute_in_parallel();
+
     /*!
     \brief Tell whether the given node belongs to us
 
@@ -143,6 +159,16 @@ namespace Core::IO
     */
     bool has_node(const int nodeid) const { return nodes_.find(nodeid) != nodes_.end(); }
 
+    /*!
+    \brief Tell for each of the given nodes whether it belongs to us
+
+    This is the counterpart of has_node() after read_and_distribute_in_parallel(), where
+    every processor only knows the nodes of its own elements. Each processor asks for its own
+    @p node_ids and the answer takes the elements of all processors into account. This call is
+    collective.
+    */
+    std::vector<bool> have_nodes(const std::vector<int>& node_ids) const;
+
    private:
     /// Get the overall number of elements and their corresponding global IDs
     std::pair<int, std::vector<int>> get_element_size_and_ids() const;
@@ -150,6 +176,17 @@ namespace Core::IO
     /// Read the file and get element information, distribute them to each processor
     void get_and_distribute_elements(const int nblock, const int bsize);
 
+    /*!
+    \brief Create the element of one line of the element section
+
+    The element is owned by @p owner. It is added to the discretization and its nodes are
+    remembered in nodes_.
+
+    \return The element or nullptr if its type is not read by this reader
+    */
+    std::shared_ptr<Core::Elements::Element> read_element(const std::string& element_line,
+        Core::Elements::ElementDefinition& ed, int owner);
+
     /// discretization name
     std::string name_;
 
@@ -167,7 +204,8 @@ namespace Core::IO
 
     This is a redundant set of all node numbers. But it is only valid
     on processor 0. We need it to easily figure out to which
-    discretization a node belongs.
+    discretization a node belongs. After a parallel read, every processor
+    holds the node ids of the elements it has read.
     */
     std::set<int> nodes_;
 
@@ -8,6 +8,8 @@
 #include "4C_io_hdf.hpp"
 
 #include "4C_comm_mpi_utils.hpp"
+#include "4C_io_asynchronous_output.hpp"
+#include "4C_io_hdf_shared_file.hpp"
 #include "4C_utils_exceptions.hpp"
 
 #include <iostream>
@@ -21,6 +23,9 @@ FOUR_C_NAMESPACE_OPEN
 Core::IO::HDFReader::HDFReader(std::string dir)
     : filenames_(0), files_(0), input_dir_(dir), num_output_proc_(0)
 {
+  // the files might still be written by the asynchronous output of this process
+  AsynchronousOutput::instance().wait();
+
   // inhibit delayed closure, throws error if file contents still in use
   h5_plist_ = H5Pcreate(H5P_FILE_ACCESS);
   herr_t status = H5Pset_fclose_degree(h5_plist_, H5F_CLOSE_WEAK);
@@ -45,6 +50,9 @@ Core::IO::HDFReader::~HDFReader()
 void Core::IO::HDFReader::open(
     std::string basename, int num_output_procs, int new_proc_num, int my_id)
 {
+  // the files might still be written by the asynchronous output of this process
+  AsynchronousOutput::instance().wait();
+
   int start;
   int end;
   num_output_proc_ = num_output_procs;
@@ -58,7 +66,9 @@ void Core::IO::HDFReader::open(
     {
       buf << ".p" << i;
     }
-    if (i >= start and i < end)
+    // a single file is opened by all procs such that each of them can read its part of the
+    // distributed vectors, see read_result_data()
+    if ((i >= start and i < end) or num_output_proc_ == 1)
     {
       filenames_.push_back(buf.str());
       files_.push_back(H5Fopen(buf.str().c_str(), H5F_ACC_RDONLY, h5_plist_));
@@ -177,6 +187,8 @@ std::shared_ptr<std::vector<char>> Core::IO::HDFReader::read_node_data(
 std::shared_ptr<std::vector<char>> Core::IO::HDFReader::read_char_data(
     std::string path, int start, int end) const
 {
+  AsynchronousOutput::instance().wait();
+
   if (end == -1) end = num_output_proc_;
   hsize_t offset = 0;
   std::shared_ptr<std::vector<char>> data = std::make_shared<std::vector<char>>();
@@ -236,6 +248,8 @@ std::shared_ptr<std::vector<char>> Core::IO::HDFReader::read_char_data(
 std::shared_ptr<std::vector<int>> Core::IO::HDFReader::read_int_data(
     std::string path, int start, int end) const
 {
+  AsynchronousOutput::instance().wait();
+
   if (end == -1) end = num_output_proc_;
   int offset = 0;
   std::shared_ptr<std::vector<int>> data = std::make_shared<std::vector<int>>();
@@ -292,6 +306,8 @@ std::shared_ptr<std::vector<int>> Core::IO::HDFReader::read_int_data(
 std::shared_ptr<std::vector<double>> Core::IO::HDFReader::read_double_data(
     std::string path, int start, int end, std::vector<int>& lengths) const
 {
+  AsynchronousOutput::instance().wait();
+
   if (end == -1) end = num_output_proc_;
   int offset = 0;
   std::shared_ptr<std::vector<double>> data = std::make_shared<std::vector<double>>();
@@ -352,6 +368,30 @@ std::shared_ptr<Core::LinAlg::MultiVector<double>> Core::IO::HDFReader::read_res
   int my_id = Core::Communication::my_mpi_rank(Comm);
 
   if (files_.size() == 0) FOUR_C_THROW("Tried to read data without opening any file");
+
+  // A single file, e.g. written by a serial run or as shared file by a parallel run, is read in
+  // parallel: each proc selects a block of the rows. The vector is redistributed afterwards.
+  if (num_output_proc_ == 1 and new_proc_num > 1)
+  {
+    AsynchronousOutput::instance().wait();
+
+    const std::vector<int> ids = read_hdf5_int_block(files_[0], id_path, 1, new_proc_num, my_id);
+    Epetra_Map map(-1, static_cast<int>(ids.size()), ids.data(), 0, Comm);
+
+    std::shared_ptr<Core::LinAlg::MultiVector<double>> res =
+        std::make_shared<Core::LinAlg::MultiVector<double>>(map, columns, false);
+
+    const std::vector<double> values =
+        read_hdf5_double_block(files_[0], value_path, columns, new_proc_num, my_id);
+    if (static_cast<int>(values.size()) != res->MyLength() * res->NumVectors())
+      FOUR_C_THROW("vector value size mismatch: %d != %d", values.size(),
+          res->MyLength() * res->NumVectors());
+
+    // both are stored column by column
+    std::copy(values.begin(), values.end(), res->Values());
+    return res;
+  }
+
   int start, end;
   calculate_range(new_proc_num, my_id, start, end);
 
@@ -426,11 +466,40 @@ std::shared_ptr<std::vector<char>> Core::IO::HDFReader::read_char_vector(
   return res;
 }
 
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+std::shared_ptr<std::vector<char>> Core::IO::HDFReader::read_char_vector(
+    std::string value_path, std::string size_path, const Epetra_Comm& Comm) const
+{
+  int new_proc_num = Core::Communication::num_mpi_ranks(Comm);
+  int my_id = Core::Communication::my_mpi_rank(Comm);
+
+  if (files_.size() == 0) FOUR_C_THROW("Tried to read data without opening any file");
+
+  // the file might still be written by the asynchronous output of this process
+  AsynchronousOutput::instance().wait();
+
+  // the parts written by the procs are distributed just like the files of a per-proc output
+  const std::vector<int> sizes = read_hdf5_int_block(files_[0], size_path, 1, 1, 0);
+  int start, end;
+  calculate_range(static_cast<int>(sizes.size()), new_proc_num, my_id, start, end);
+
+  hsize_t offset = 0;
+  for (int i = 0; i < start; ++i) offset += sizes[i];
+  hsize_t length = 0;
+  for (int i = start; i < end; ++i) length += sizes[i];
+
+  return std::make_shared<std::vector<char>>(
+      read_hdf5_char_range(files_[0], value_path, offset, length));
+}
+
 
 /*----------------------------------------------------------------------*/
 /*----------------------------------------------------------------------*/
 void Core::IO::HDFReader::close()
 {
+  AsynchronousOutput::instance().wait();
+
   for (int i = 0; i < num_output_proc_ and i < static_cast<int>(files_.size()); ++i)
   {
     if (files_[i] != -1)
@@ -448,18 +517,24 @@ void Core::IO::HDFReader::close()
 /*----------------------------------------------------------------------*/
 void Core::IO::HDFReader::calculate_range(int new_proc_num, int my_id, int& start, int& end) const
 {
-  const int mod = num_output_proc_ % new_proc_num;
+  calculate_range(num_output_proc_, new_proc_num, my_id, start, end);
+}
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+void Core::IO::HDFReader::calculate_range(
+    int num_parts, int new_proc_num, int my_id, int& start, int& end)
+{
+  const int mod = num_parts % new_proc_num;
   if (my_id < mod)
   {
-    start = (num_output_proc_ / new_proc_num + 1) * my_id;
-    end = (num_output_proc_ / new_proc_num + 1) * (my_id + 1);
+    start = (num_parts / new_proc_num + 1) * my_id;
+    end = (num_parts / new_proc_num + 1) * (my_id + 1);
   }
   else
   {
-    start = (num_output_proc_ / new_proc_num + 1) * mod +
-            (num_output_proc_ / new_proc_num) * (my_id - mod);
-    end = (num_output_proc_ / new_proc_num + 1) * mod +
-          (num_output_proc_ / new_proc_num) * (my_id - mod + 1);
+    start = (num_parts / new_proc_num + 1) * mod + (num_parts / new_proc_num) * (my_id - mod);
+    end = (num_parts / new_proc_num + 1) * mod + (num_parts / new_proc_num) * (my_id - mod + 1);
   }
 }
 
@@ -59,9 +59,9 @@ namespace Core::IO
     //! Open a new set of input files.
     /*!
       With num_output_procs==1 this function opens the result data
-      file with name basename. If num_output_procs>1 it opens the result
-      files of all processors, by appending .p<proc_num> to the
-      basename.
+      file with name basename on all processors. If num_output_procs>1
+      it opens the result files of all processors, by appending
+      .p<proc_num> to the basename.
     */
     void open(std::string basename, int num_output_procs, int new_proc_num, int my_id);
     //!
@@ -110,6 +110,9 @@ namespace Core::IO
 
       \note If columns==1, we create an Core::LinAlg::Vector<double>.
 
+      \note A single file, e.g. a shared file written by all processors, is read in
+             parallel. Each processor reads a contiguous block of rows.
+
       \param id_path      (in): hdf5 path to map array (from control file)
       \param value_path   (in): hdf5 path to value array (from control file)
       \param columns      (in): number of vector columns
@@ -136,6 +139,18 @@ namespace Core::IO
     std::shared_ptr<std::vector<char>> read_char_vector(
         std::string value_path, const Epetra_Comm& Comm) const;
 
+    //! read a std::vector<char> from a result file that is shared by all procs
+    /*!
+      The char data of all procs is stored in one dataset. The sizes of their parts are needed
+      to assign complete parts to the reading procs.
+
+      \param value_path   (in): hdf5 path to the char array (from control file)
+      \param size_path    (in): hdf5 path to the sizes of the parts of all procs
+      \param Comm         (in): the communicator
+     */
+    std::shared_ptr<std::vector<char>> read_char_vector(
+        std::string value_path, std::string size_path, const Epetra_Comm& Comm) const;
+
     std::shared_ptr<std::vector<double>> read_double_vector(std::string path) const
     {
       std::vector<int> length;
@@ -191,6 +206,9 @@ namespace Core::IO
      */
     void calculate_range(int new_proc_num, int my_id, int& start, int& end) const;
 
+    //! Figure out which subset of @p num_parts parts this process needs to read
+    static void calculate_range(int num_parts, int new_proc_num, int my_id, int& start, int& end);
+
     //! the names of the files opened here
     std::vector<std::string> filenames_;
 
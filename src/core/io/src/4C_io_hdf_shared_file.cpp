@@ -0,0 +1,230 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_io_hdf_shared_file.hpp"
+
+#include "4C_utils_exceptions.hpp"
+
+#include <Epetra_MpiComm.h>
+
+#include <algorithm>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  //! maximum number of entries in a chunk of a compressed dataset
+  constexpr hsize_t max_chunk_size = 1 << 16;
+
+  MPI_Comm get_mpi_comm(const Epetra_Comm& comm)
+  {
+    return dynamic_cast<const Epetra_MpiComm&>(comm).Comm();
+  }
+
+  template <typename T>
+  std::vector<T> read_block(hid_t file, const std::string& path, hid_t type, int num_columns,
+      int num_procs, int my_rank)
+  {
+    const hid_t dataset = H5Dopen2(file, path.c_str(), H5P_DEFAULT);
+    if (dataset < 0) FOUR_C_THROW("Failed to open dataset %s", path.c_str());
+    const hid_t filespace = H5Dget_space(dataset);
+    if (filespace < 0) FOUR_C_THROW("Failed to get dataspace from dataset %s", path.c_str());
+
+    std::vector<T> data;
+    const int rank = H5Sget_simple_extent_ndims(filespace);
+    if (rank == 1)
+    {
+      hsize_t size;
+      if (H5Sget_simple_extent_dims(filespace, &size, nullptr) < 0)
+        FOUR_C_THROW("Failed to get size of dataset %s", path.c_str());
+      if (size % num_columns != 0)
+        FOUR_C_THROW("Size %d of dataset %s does not match %d columns", static_cast<int>(size),
+            path.c_str(), num_columns);
+
+      // linear distribution of the rows, the first procs get one row more
+      const hsize_t num_rows = size / num_columns;
+      const hsize_t rank_id = my_rank;
+      const hsize_t remainder = num_rows % num_procs;
+      hsize_t length = num_rows / num_procs;
+      const hsize_t start = rank_id * length + std::min(rank_id, remainder);
+      if (rank_id < remainder) length += 1;
+
+      data.resize(length * num_columns);
+      if (length > 0)
+      {
+        // one block per column, the columns are num_rows apart
+        const hsize_t count = num_columns;
+        herr_t status =
+            H5Sselect_hyperslab(filespace, H5S_SELECT_SET, &start, &num_rows, &count, &length);
+        if (status < 0) FOUR_C_THROW("Failed to select hyperslab in dataset %s", path.c_str());
+
+        const hsize_t memsize = data.size();
+        const hid_t memspace = H5Screate_simple(1, &memsize, nullptr);
+        status = H5Dread(dataset, type, memspace, filespace, H5P_DEFAULT, data.data());
+        if (status < 0) FOUR_C_THROW("Failed to read data from dataset %s", path.c_str());
+        H5Sclose(memspace);
+      }
+    }
+    else if (rank != 0)
+      FOUR_C_THROW("HDF5 rank=%d unsupported", rank);
+
+    if (H5Sclose(filespace) < 0) FOUR_C_THROW("Failed to close dataspace %s", path.c_str());
+    if (H5Dclose(dataset) < 0) FOUR_C_THROW("Failed to close dataset %s", path.c_str());
+
+    return data;
+  }
+}  // namespace
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+bool Core::IO::hdf5_supports_shared_files()
+{
+#ifdef H5_HAVE_PARALLEL
+  return true;
+#else
+  return false;
+#endif
+}
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+hid_t Core::IO::create_shared_hdf5_file(const std::string& filename, const Epetra_Comm& comm)
+{
+#ifdef H5_HAVE_PARALLEL
+  const hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+  if (H5Pset_fapl_mpio(fapl, get_mpi_comm(comm), MPI_INFO_NULL) < 0)
+    FOUR_C_THROW("Failed to set MPI-IO file access for %s", filename.c_str());
+
+  const hid_t file = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+  if (file < 0) FOUR_C_THROW("Failed to open file %s", filename.c_str());
+  H5Pclose(fapl);
+  return file;
+#else
+  FOUR_C_THROW(
+      "Cannot create shared file %s. The HDF5 library is built without MPI support.",
+      filename.c_str());
+  return -1;
+#endif
+}
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+void Core::IO::write_shared_hdf5_dataset(hid_t group, const std::string& name, hid_t type,
+    const void* data, hsize_t local_length, int num_columns, int compression_level,
+    const Epetra_Comm& comm)
+{
+  const MPI_Comm mpi_comm = get_mpi_comm(comm);
+
+  // offset of my part in each column and the global column length
+  unsigned long long local = local_length;
+  unsigned long long offset = 0;
+  unsigned long long global = 0;
+  MPI_Exscan(&local, &offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, mpi_comm);
+  if (comm.MyPID() == 0) offset = 0;
+  MPI_Allreduce(&local, &global, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, mpi_comm);
+
+  // empty datasets are scalar, just like the ones of the per-proc files
+  const hsize_t size = global * num_columns;
+  const hid_t filespace = size != 0 ? H5Screate_simple(1, &size, nullptr) : H5Screate(H5S_SCALAR);
+
+  const hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+  if (compression_level > 0 and size != 0)
+  {
+    const hsize_t chunk = std::min(size, max_chunk_size);
+    if (H5Pset_chunk(dcpl, 1, &chunk) < 0 or H5Pset_deflate(dcpl, compression_level) < 0)
+      FOUR_C_THROW("Failed to set compression of dataset %s", name.c_str());
+  }
+
+  const hid_t dataset =
+      H5Dcreate2(group, name.c_str(), type, filespace, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+  if (dataset < 0) FOUR_C_THROW("Failed to create dataset %s in HDF-resultfile", name.c_str());
+
+  if (size != 0)
+  {
+    const hsize_t memsize = std::max<hsize_t>(local_length * num_columns, 1);
+    const hid_t memspace = H5Screate_simple(1, &memsize, nullptr);
+    if (local_length > 0)
+    {
+      // one block per column, the columns are global entries apart
+      const hsize_t start = offset;
+      const hsize_t stride = global;
+      const hsize_t count = num_columns;
+      H5Sselect_hyperslab(filespace, H5S_SELECT_SET, &start, &stride, &count, &local_length);
+    }
+    else
+    {
+      // procs without data still take part in the collective write
+      H5Sselect_none(filespace);
+      H5Sselect_none(memspace);
+    }
+
+    const hid_t dxpl = H5Pcreate(H5P_DATASET_XFER);
+#ifdef H5_HAVE_PARALLEL
+    H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+#endif
+    const herr_t status = H5Dwrite(dataset, type, memspace, filespace, dxpl, data);
+    if (status < 0) FOUR_C_THROW("Failed to write dataset %s in HDF-resultfile", name.c_str());
+    H5Pclose(dxpl);
+    H5Sclose(memspace);
+  }
+
+  H5Dclose(dataset);
+  H5Pclose(dcpl);
+  H5Sclose(filespace);
+}
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+std::vector<int> Core::IO::read_hdf5_int_block(
+    hid_t file, const std::string& path, int num_columns, int num_procs, int my_rank)
+{
+  return read_block<int>(file, path, H5T_NATIVE_INT, num_columns, num_procs, my_rank);
+}
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+std::vector<double> Core::IO::read_hdf5_double_block(
+    hid_t file, const std::string& path, int num_columns, int num_procs, int my_rank)
+{
+  return read_block<double>(file, path, H5T_NATIVE_DOUBLE, num_columns, num_procs, my_rank);
+}
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+std::vector<char> Core::IO::read_hdf5_char_range(
+    hid_t file, const std::string& path, hsize_t offset, hsize_t length)
+{
+  std::vector<char> data(length);
+  if (length == 0) return data;
+
+  const hid_t dataset = H5Dopen2(file, path.c_str(), H5P_DEFAULT);
+  if (dataset < 0) FOUR_C_THROW("Failed to open dataset %s", path.c_str());
+  const hid_t filespace = H5Dget_space(dataset);
+  if (filespace < 0) FOUR_C_THROW("Failed to get dataspace from dataset %s", path.c_str());
+
+  hsize_t size = 0;
+  if (H5Sget_simple_extent_ndims(filespace) != 1 or
+      H5Sget_simple_extent_dims(filespace, &size, nullptr) < 0 or offset + length > size)
+    FOUR_C_THROW("Dataset %s does not contain the range [%d,%d)", path.c_str(),
+        static_cast<int>(offset), static_cast<int>(offset + length));
+
+  herr_t status =
+      H5Sselect_hyperslab(filespace, H5S_SELECT_SET, &offset, nullptr, &length, nullptr);
+  if (status < 0) FOUR_C_THROW("Failed to select hyperslab in dataset %s", path.c_str());
+
+  const hid_t memspace = H5Screate_simple(1, &length, nullptr);
+  status = H5Dread(dataset, H5T_NATIVE_CHAR, memspace, filespace, H5P_DEFAULT, data.data());
+  if (status < 0) FOUR_C_THROW("Failed to read data from dataset %s", path.c_str());
+
+  H5Sclose(memspace);
+  if (H5Sclose(filespace) < 0) FOUR_C_THROW("Failed to close dataspace %s", path.c_str());
+  if (H5Dclose(dataset) < 0) FOUR_C_THROW("Failed to close dataset %s", path.c_str());
+
+  return data;
+}
+
+FOUR_C_NAMESPACE_CLOSE
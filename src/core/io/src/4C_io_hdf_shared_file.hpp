@@ -0,0 +1,78 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_IO_HDF_SHARED_FILE_HPP
+#define FOUR_C_IO_HDF_SHARED_FILE_HPP
+
+#include "4C_config.hpp"
+
+#include <Epetra_Comm.h>
+#include <hdf5.h>
+
+#include <string>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::IO
+{
+  /*!
+   * \brief Return whether the HDF5 library supports files that are shared by all processes
+   *
+   * This requires an HDF5 library that is built with MPI-IO support.
+   */
+  bool hdf5_supports_shared_files();
+
+  /*!
+   * \brief Create an HDF5 file that is written by all processes of @p comm via MPI-IO
+   *
+   * This call is collective. All datasets in the file have to be created collectively as well,
+   * see write_shared_hdf5_dataset().
+   */
+  hid_t create_shared_hdf5_file(const std::string& filename, const Epetra_Comm& comm);
+
+  /*!
+   * \brief Write the distributed data of all processes of @p comm into one dataset
+   *
+   * The local @p data consists of @p num_columns columns with @p local_length entries each,
+   * stored one after the other. The dataset stores the columns one after the other as well,
+   * where each column contains the local parts of all processes ordered by rank. This is the
+   * layout a single process writes, hence the dataset can be read like the one of a serial run.
+   *
+   * With a @p compression_level between 1 and 9, the dataset is chunked and compressed with
+   * deflate. This call is collective.
+   */
+  void write_shared_hdf5_dataset(hid_t group, const std::string& name, hid_t type,
+      const void* data, hsize_t local_length, int num_columns, int compression_level,
+      const Epetra_Comm& comm);
+
+  /*!
+   * \brief Read a contiguous block of rows of a dataset with @p num_columns columns
+   *
+   * The rows of the dataset are linearly distributed among @p num_procs processes and the block
+   * of @p my_rank is read with a hyperslab selection. The returned data is stored column by
+   * column. Scalar (empty) datasets result in empty data.
+   */
+  std::vector<int> read_hdf5_int_block(
+      hid_t file, const std::string& path, int num_columns, int num_procs, int my_rank);
+
+  //! Same as read_hdf5_int_block() for double data
+  std::vector<double> read_hdf5_double_block(
+      hid_t file, const std::string& path, int num_columns, int num_procs, int my_rank);
+
+  /*!
+   * \brief Read @p length entries starting at @p offset of a one-dimensional char dataset
+   *
+   * This is used to read the parts of a char dataset that were written by a range of processes.
+   */
+  std::vector<char> read_hdf5_char_range(
+      hid_t file, const std::string& path, hsize_t offset, hsize_t length);
+}  // namespace Core::IO
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -18,6 +18,7 @@
 #include <Teuchos_Time.hpp>
 #include <yaml-cpp/yaml.h>
 
+#include <cstdint>
 #include <filesystem>
 #include <sstream>
 #include <utility>
@@ -225,12 +226,16 @@ namespace Core::IO
       int current_section_linecount = 0;
       SectionType current_section_type = SectionType::normal;
       std::string line;
+      // byte positions of the current and the next line
+      std::streamoff current_line_start = 0;
+      std::streamoff next_line_start = 0;
 
-      const auto finalize_section_read = [&](int number_of_lines)
+      const auto finalize_section_read = [&](int number_of_lines, std::streamoff section_end)
       {
         if (current_section_type == SectionType::on_the_fly)
         {
           exclude_information[current_excluded_section_name].length = number_of_lines;
+          exclude_information[current_excluded_section_name].end_pos = section_end;
         }
 
         // Reset tracking variables
@@ -244,7 +249,8 @@ namespace Core::IO
           // Start a new excluded section. This starts at the next line. The correct length
           // will be set when the section ends.
           exclude_information.emplace(maybe_excluded_section,
-              Internal::SectionPosition{.file = file_path, .pos = file.tellg(), .length = 0});
+              Internal::SectionPosition{
+                  .file = file_path, .pos = next_line_start, .length = 0, .end_pos = 0});
           current_excluded_section_name = maybe_excluded_section;
           current_section_type = SectionType::on_the_fly;
         }
@@ -265,6 +271,10 @@ namespace Core::IO
       {
         ++current_section_linecount;
 
+        // getline() consumes the line break unless the file ends without one
+        current_line_start = next_line_start;
+        next_line_start += static_cast<std::streamoff>(line.size()) + (file.eof() ? 0 : 1);
+
         // In case we are reading an include section, a comment needs to be preceded by
         // whitespace. Otherwise, we would treat double slashes as comments, although they are
         // part of the file path.
@@ -292,7 +302,7 @@ namespace Core::IO
         {
           // finalize the last excluded section. Subtract the current line which is not part of
           // the section anymore.
-          finalize_section_read(current_section_linecount - 1);
+          finalize_section_read(current_section_linecount - 1, current_line_start);
         }
 
         switch (current_section_type)
@@ -317,7 +327,7 @@ namespace Core::IO
         }
       }
       // Finalize the last section
-      finalize_section_read(current_section_linecount);
+      finalize_section_read(current_section_linecount, next_line_start);
 
       return included_files;
     }
@@ -502,8 +512,9 @@ namespace Core::IO
     void SectionPosition::pack(Communication::PackBuffer& data) const
     {
       Core::Communication::add_to_pack(data, file.string());
-      Core::Communication::add_to_pack(data, static_cast<unsigned>(pos));
+      Core::Communication::add_to_pack(data, static_cast<std::int64_t>(pos));
       Core::Communication::add_to_pack(data, length);
+      Core::Communication::add_to_pack(data, static_cast<std::int64_t>(end_pos));
     }
 
     void SectionPosition::unpack(Communication::UnpackBuffer& buffer)
@@ -511,10 +522,13 @@ namespace Core::IO
       std::string file_str;
       Core::Communication::extract_from_pack(buffer, file_str);
       file = file_str;
-      unsigned pos_extract;
+      std::int64_t pos_extract;
       Core::Communication::extract_from_pack(buffer, pos_extract);
       pos = pos_extract;
       Core::Communication::extract_from_pack(buffer, length);
+      std::int64_t end_pos_extract;
+      Core::Communication::extract_from_pack(buffer, end_pos_extract);
+      end_pos = end_pos_extract;
     }
   }  // namespace Internal
 
@@ -546,6 +560,64 @@ namespace Core::IO
   }
 
 
+  /*----------------------------------------------------------------------*/
+  /*----------------------------------------------------------------------*/
+  std::vector<std::string> InputFile::my_lines_in_section(const std::string& section_name)
+  {
+    record_section_used(section_name);
+
+    std::vector<std::string> my_lines;
+    const int myrank = Core::Communication::my_mpi_rank(comm_);
+    const int numproc = Core::Communication::num_mpi_ranks(comm_);
+
+    const auto section = excludepositions_.find(section_name);
+    if (section == excludepositions_.end())
+    {
+      // pre-read sections are small, rank 0 takes them as a whole
+      if (myrank == 0)
+      {
+        for (const auto& line : line_range(section_name)) my_lines.emplace_back(line);
+      }
+      return my_lines;
+    }
+
+    const Internal::SectionPosition& position = section->second;
+    const std::streamoff begin = position.pos;
+    const std::streamoff end = std::max<std::streamoff>(position.end_pos, begin);
+
+    // equally sized byte ranges, the last rank takes the remainder
+    const std::streamoff chunk = (end - begin) / numproc;
+    const std::streamoff my_begin = begin + myrank * chunk;
+    const std::streamoff my_end = (myrank == numproc - 1) ? end : my_begin + chunk;
+    if (my_begin >= my_end) return my_lines;
+
+    std::ifstream file(position.file);
+    if (not file) FOUR_C_THROW("Unable to open file: %s", position.file.c_str());
+
+    // A line belongs to the rank whose range contains its first character. Unless we start at
+    // the section begin, skip the rest of the line that started in front of my range.
+    std::string line;
+    std::streamoff line_start = my_begin;
+    if (my_begin != begin)
+    {
+      file.seekg(my_begin - 1);
+      std::getline(file, line);
+      line_start += static_cast<std::streamoff>(line.size());
+    }
+    else
+      file.seekg(my_begin);
+
+    while (line_start < my_end and std::getline(file, line))
+    {
+      line_start += static_cast<std::streamoff>(line.size()) + 1;
+      line = Core::Utils::strip_comment(line);
+      if (!line.empty()) my_lines.emplace_back(std::move(line));
+    }
+
+    return my_lines;
+  }
+
+
   /*----------------------------------------------------------------------*/
   /*----------------------------------------------------------------------*/
   bool read_parameters_in_section(
@@ -133,6 +133,8 @@ namespace Core::IO
       std::filesystem::path file;
       std::ifstream::pos_type pos;
       unsigned int length;
+      //! Byte position of the first character after the section.
+      std::ifstream::pos_type end_pos;
 
       void pack(Core::Communication::PackBuffer& data) const;
 
@@ -230,6 +232,18 @@ namespace Core::IO
      */
     auto lines_in_section(const std::string& section_name);
 
+    /**
+     * Get the lines of a section that are read by this rank. Large sections, which are read
+     * on-the-fly, are split into byte ranges of roughly equal size and every rank reads only the
+     * complete lines that start in its range. All other sections are pre-read and their lines are
+     * handed out to rank 0. Taken together, the ranks obtain every line of the section exactly
+     * once and the lines of a lower rank precede the ones of a higher rank. The lines are
+     * processed like the ones of lines_in_section().
+     *
+     * @note Contrary to lines_in_section(), the file is opened by all ranks.
+     */
+    std::vector<std::string> my_lines_in_section(const std::string& section_name);
+
     /**
      * Returns whether a section with the given name exists in the input file and contains any
      * content.
@@ -347,7 +361,7 @@ namespace Core::IO
 
     if (excludepositions_.count(section_name) > 0)
     {
-      const auto [path, start_pos, length] = excludepositions_.at(section_name);
+      const auto [path, start_pos, length, end_pos] = excludepositions_.at(section_name);
 
       auto file = std::make_shared<std::ifstream>(path);
       file->seekg(start_pos);
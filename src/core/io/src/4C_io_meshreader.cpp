@@ -102,6 +102,16 @@ void Core::IO::MeshReader::read_mesh_from_dat_file(int& max_node_id)
 {
   TEUCHOS_FUNC_TIME_MONITOR("Core::IO::MeshReader::read_mesh_from_dat_file");
 
+  if (parameters_.mesh_paritioning_parameters.get<bool>("PARALLEL_READ"))
+  {
+    // every proc reads its part of the element and node sections
+    for (auto& element_reader : element_readers_)
+      element_reader.read_and_distribute_in_parallel();
+
+    read_nodes_in_parallel(input_, node_section_name_, element_readers_, max_node_id);
+    return;
+  }
+
   // read element information
   for (auto& element_reader : element_readers_) element_reader.read_and_distribute();
 
@@ -119,8 +129,11 @@ void Core::IO::MeshReader::rebalance()
   for (size_t i = 0; i < element_readers_.size(); i++)
   {
     // global node ids --- this will be a fully redundant vector!
-    int numnodes = static_cast<int>(element_readers_[i].get_unique_nodes().size());
-    comm_.Broadcast(&numnodes, 1, 0);
+    // Only check whether there are any nodes, the ids are known by proc 0 or, after a parallel
+    // read, distributed over all procs.
+    int mynumnodes = static_cast<int>(element_readers_[i].get_unique_nodes().size());
+    int numnodes = 0;
+    comm_.MaxAll(&mynumnodes, &numnodes, 1);
 
     const auto discret = element_readers_[i].get_dis();
 
@@ -103,6 +103,8 @@ namespace Core::IO
       Actually most of the work gets done by the ElementReader. The
       reading of both elements and nodes happens in blocks on processor
       0. After each block read the discretizations are redistributed.
+      With PARALLEL_READ in MESH PARTITIONING, all processors read their
+      part of the element and node sections instead.
 
      */
     void read_and_partition();
@@ -16,6 +16,7 @@
 #include "4C_io_input_file.hpp"
 
 #include <istream>
+#include <unordered_map>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -32,22 +33,18 @@ namespace
     return list_of_discretizations;
   }
 
-}  // namespace
-
-
-void Core::IO::read_nodes(Core::IO::InputFile& input, const std::string& node_section_name,
-    std::vector<ElementReader>& element_readers, int& max_node_id)
-{
-  const int myrank = Core::Communication::my_mpi_rank(input.get_comm());
-  if (myrank > 0) return;
-
-  std::string tmp;
-  std::string tmp2;
-
-  int line_count = 0;
-  for (const auto& node_line : input.lines_in_section(node_section_name))
+  /**
+   * Create the node of one line of the node section and add it to the discretizations returned by
+   * @p find_dis. The @p line_count is the index of the line in the section.
+   */
+  template <typename FindDis>
+  void read_node_line(std::string_view node_line, FindDis&& find_dis, int myrank, int line_count,
+      int& max_node_id)
   {
     std::istringstream linestream{std::string{node_line}};
+    std::string tmp;
+    std::string tmp2;
+
     linestream >> tmp;
 
     if (tmp == "NODE")
@@ -59,8 +56,7 @@ void Core::IO::read_nodes(Core::IO::InputFile& input, const std::string& node_se
 
       nodeid--;
       max_node_id = std::max(max_node_id, nodeid) + 1;
-      std::vector<std::shared_ptr<Core::FE::Discretization>> dis =
-          find_dis_node(element_readers, nodeid);
+      std::vector<std::shared_ptr<Core::FE::Discretization>> dis = find_dis(nodeid);
 
       for (const auto& di : dis)
       {
@@ -80,8 +76,7 @@ void Core::IO::read_nodes(Core::IO::InputFile& input, const std::string& node_se
 
       nodeid--;
       max_node_id = std::max(max_node_id, nodeid) + 1;
-      std::vector<std::shared_ptr<Core::FE::Discretization>> diss =
-          find_dis_node(element_readers, nodeid);
+      std::vector<std::shared_ptr<Core::FE::Discretization>> diss = find_dis(nodeid);
 
       for (const auto& dis : diss)
       {
@@ -106,8 +101,7 @@ void Core::IO::read_nodes(Core::IO::InputFile& input, const std::string& node_se
         FOUR_C_THROW(
             "Reading of control points %d failed: They must be numbered consecutive!!", cpid);
       if (tmp != "COORD") FOUR_C_THROW("failed to read control point %d", cpid);
-      std::vector<std::shared_ptr<Core::FE::Discretization>> diss =
-          find_dis_node(element_readers, cpid);
+      std::vector<std::shared_ptr<Core::FE::Discretization>> diss = find_dis(cpid);
 
       for (auto& dis : diss)
       {
@@ -224,8 +218,7 @@ void Core::IO::read_nodes(Core::IO::InputFile& input, const std::string& node_se
       }
 
       // add fiber information to node
-      std::vector<std::shared_ptr<Core::FE::Discretization>> discretizations =
-          find_dis_node(element_readers, nodeid);
+      std::vector<std::shared_ptr<Core::FE::Discretization>> discretizations = find_dis(nodeid);
       for (auto& dis : discretizations)
       {
         auto node = std::make_shared<Core::Nodes::FiberNode>(
@@ -235,9 +228,75 @@ void Core::IO::read_nodes(Core::IO::InputFile& input, const std::string& node_se
     }
     else
       FOUR_C_THROW("unexpected word '%s'", tmp.c_str());
+  }
+}  // namespace
+
+
+void Core::IO::read_nodes(Core::IO::InputFile& input, const std::string& node_section_name,
+    std::vector<ElementReader>& element_readers, int& max_node_id)
+{
+  const int myrank = Core::Communication::my_mpi_rank(input.get_comm());
+  if (myrank > 0) return;
 
+  int line_count = 0;
+  for (const auto& node_line : input.lines_in_section(node_section_name))
+  {
+    read_node_line(
+        node_line, [&](int nodeid) { return find_dis_node(element_readers, nodeid); }, myrank,
+        line_count, max_node_id);
     ++line_count;
   }
 }
 
+
+void Core::IO::read_nodes_in_parallel(Core::IO::InputFile& input,
+    const std::string& node_section_name, std::vector<ElementReader>& element_readers,
+    int& max_node_id)
+{
+  const Epetra_Comm& comm = input.get_comm();
+  const int myrank = Core::Communication::my_mpi_rank(comm);
+
+  const std::vector<std::string> node_lines = input.my_lines_in_section(node_section_name);
+
+  // index of my first line within the section
+  int my_line_count = static_cast<int>(node_lines.size());
+  int line_offset = 0;
+  comm.ScanSum(&my_line_count, &line_offset, 1);
+  line_offset -= my_line_count;
+
+  // The element readers only know the nodes of the local elements. Ask them collectively which
+  // of my node ids are used by any element.
+  std::vector<int> node_ids;
+  node_ids.reserve(node_lines.size());
+  for (const auto& node_line : node_lines)
+  {
+    std::istringstream linestream{node_line};
+    std::string type;
+    int nodeid = 0;
+    linestream >> type >> nodeid;
+    node_ids.push_back(nodeid - 1);
+  }
+
+  std::unordered_map<int, std::vector<std::shared_ptr<Core::FE::Discretization>>> node_dis;
+  for (const auto& element_reader : element_readers)
+  {
+    const std::vector<bool> have = element_reader.have_nodes(node_ids);
+    for (std::size_t i = 0; i < node_ids.size(); ++i)
+      if (have[i]) node_dis[node_ids[i]].emplace_back(element_reader.get_dis());
+  }
+
+  const auto find_dis = [&](int nodeid)
+  {
+    auto it = node_dis.find(nodeid);
+    return it != node_dis.end() ? it->second
+                                : std::vector<std::shared_ptr<Core::FE::Discretization>>{};
+  };
+
+  for (std::size_t i = 0; i < node_lines.size(); ++i)
+  {
+    read_node_line(
+        node_lines[i], find_dis, myrank, line_offset + static_cast<int>(i), max_node_id);
+  }
+}
+
 FOUR_C_NAMESPACE_CLOSE
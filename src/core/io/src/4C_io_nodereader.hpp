@@ -27,6 +27,15 @@ namespace Core::IO
   void read_nodes(Core::IO::InputFile& input, const std::string& node_section_name,
       std::vector<ElementReader>& element_readers, int& max_node_id);
 
+  /**
+   * Read the nodes of section @p node_section_name in parallel. Every rank reads its own part of
+   * the section and keeps the nodes that belong to the elements read by
+   * ElementReader::read_and_distribute_in_parallel(). The nodes are owned by the rank that read
+   * them until the mesh is rebalanced. This call is collective.
+   */
+  void read_nodes_in_parallel(Core::IO::InputFile& input, const std::string& node_section_name,
+      std::vector<ElementReader>& element_readers, int& max_node_id);
+
 }  // namespace Core::IO
 
 FOUR_C_NAMESPACE_CLOSE
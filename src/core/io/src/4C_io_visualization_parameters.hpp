@@ -25,8 +25,10 @@ namespace Core::IO
   /// data format for written numeric data
   enum class OutputDataFormat
   {
-    binary,
-    ascii,
+    binary,         // zlib compressed and base64 encoded data inside each data array
+    ascii,          // human readable data
+    appended_zlib,  // zlib compressed raw binary data appended at the end of each file
+    appended_lz4,   // lz4 compressed raw binary data appended at the end of each file
     vague
   };
 
@@ -10,8 +10,14 @@
 #include "4C_io_legacy_table.hpp"
 #include "4C_io_pstream.hpp"
 #include "4C_utils_exceptions.hpp"
+#include "4C_utils_shared_memory_parallel.hpp"
+
+#ifdef FOUR_C_WITH_LZ4
+#include <lz4.h>
+#endif
 
 #include <cmath>
+#include <cstring>
 #include <filesystem>
 #include <iomanip>
 #include <limits>
@@ -174,6 +180,88 @@ namespace LibB64
 
 }  // namespace LibB64
 
+namespace
+{
+  //! size of the uncompressed blocks of the VTK compressed data format (same as VTK's default)
+  constexpr std::size_t compression_block_size = 32768;
+
+  //! name of the VTK compressor that can read data written in the given data format
+  std::string vtk_compressor_name(Core::IO::OutputDataFormat data_format)
+  {
+    if (data_format == Core::IO::OutputDataFormat::appended_lz4) return "vtkLZ4DataCompressor";
+    return "vtkZLibDataCompressor";
+  }
+
+  /*----------------------------------------------------------------------*
+   *----------------------------------------------------------------------*/
+  std::string compress_block(
+      const char* data, const std::size_t data_size, Core::IO::OutputDataFormat data_format)
+  {
+    std::string compressed_block;
+
+    if (data_format == Core::IO::OutputDataFormat::appended_lz4)
+    {
+#ifdef FOUR_C_WITH_LZ4
+      compressed_block.resize(LZ4_compressBound(static_cast<int>(data_size)));
+      const int compressed_size = LZ4_compress_default(data, compressed_block.data(),
+          static_cast<int>(data_size), static_cast<int>(compressed_block.size()));
+      if (compressed_size <= 0) FOUR_C_THROW("lz4 compression failed");
+      compressed_block.resize(compressed_size);
+#else
+      FOUR_C_THROW("4C was built without LZ4. Reconfigure with FOUR_C_WITH_LZ4=ON.");
+#endif
+    }
+    else
+    {
+      uLongf compressed_size = compressBound(data_size);
+      compressed_block.resize(compressed_size);
+      const int err = compress2(reinterpret_cast<Bytef*>(compressed_block.data()),
+          &compressed_size, reinterpret_cast<const Bytef*>(data), data_size, Z_BEST_SPEED);
+      if (err != Z_OK) FOUR_C_THROW("zlib compression failed");
+      compressed_block.resize(compressed_size);
+    }
+
+    return compressed_block;
+  }
+
+  /*----------------------------------------------------------------------*
+   | append data in the block format of the VTK data compressors:         |
+   | header [#blocks, block size, last block size, compressed sizes...]   |
+   | followed by the compressed blocks                                    |
+   *----------------------------------------------------------------------*/
+  void append_compressed_blocks(const char* data, const std::size_t data_size,
+      Core::IO::OutputDataFormat data_format, std::string& appended_data)
+  {
+    const std::size_t num_blocks =
+        (data_size + compression_block_size - 1) / compression_block_size;
+    const std::size_t last_block_size =
+        (data_size % compression_block_size == 0 and data_size > 0)
+            ? compression_block_size
+            : data_size % compression_block_size;
+
+    // blocks are independent, so they can be compressed concurrently
+    std::vector<std::string> compressed_blocks(num_blocks);
+    Core::Utils::parallel_for(static_cast<int>(num_blocks), Core::Utils::max_threads(),
+        [&](int block)
+        {
+          const std::size_t block_size = (block + 1 == static_cast<int>(num_blocks))
+                                             ? last_block_size
+                                             : compression_block_size;
+          compressed_blocks[block] =
+              compress_block(data + block * compression_block_size, block_size, data_format);
+        });
+
+    std::vector<uint32_t> header = {static_cast<uint32_t>(num_blocks),
+        static_cast<uint32_t>(compression_block_size), static_cast<uint32_t>(last_block_size)};
+    for (const auto& compressed_block : compressed_blocks)
+      header.push_back(static_cast<uint32_t>(compressed_block.size()));
+
+    appended_data.append(
+        reinterpret_cast<const char*>(header.data()), header.size() * sizeof(uint32_t));
+    for (const auto& compressed_block : compressed_blocks) appended_data.append(compressed_block);
+  }
+}  // namespace
+
 
 
 /*----------------------------------------------------------------------*
@@ -182,7 +270,8 @@ VtkWriterBase::VtkWriterBase(unsigned int myrank, unsigned int num_processors,
     unsigned int max_number_timesteps_to_be_written,
     const std::string& path_existing_working_directory,
     const std::string& name_new_vtk_subdirectory, const std::string& geometry_name,
-    const std::string& restart_name, const double restart_time, bool write_binary_output)
+    const std::string& restart_name, const double restart_time,
+    Core::IO::OutputDataFormat data_format)
     : currentPhase_(VAGUE),
       num_timestep_digits_(LibB64::ndigits(max_number_timesteps_to_be_written)),
       num_processor_digits_(LibB64::ndigits(num_processors)),
@@ -191,10 +280,18 @@ VtkWriterBase::VtkWriterBase(unsigned int myrank, unsigned int num_processors,
       timestep_(std::numeric_limits<unsigned int>::min()),
       is_restart_(restart_time > 0.0),
       cycle_(std::numeric_limits<int>::max()),
-      write_binary_output_(write_binary_output),
+      write_binary_output_(data_format != Core::IO::OutputDataFormat::ascii),
+      data_format_(data_format),
       myrank_(myrank),
       numproc_(num_processors)
 {
+#ifndef FOUR_C_WITH_LZ4
+  if (data_format_ == Core::IO::OutputDataFormat::appended_lz4)
+    FOUR_C_THROW(
+        "Output data format 'appended_lz4' requires 4C to be built with LZ4. Reconfigure with "
+        "FOUR_C_WITH_LZ4=ON or choose 'appended_zlib'.");
+#endif
+
   set_and_create_vtk_working_directory(path_existing_working_directory, name_new_vtk_subdirectory);
 
   create_restarted_initial_collection_file_mid_section(geometry_name, restart_name, restart_time);
@@ -268,7 +365,9 @@ void VtkWriterBase::initialize_vtk_file_stream_this_processor()
             << get_part_of_file_name_indicating_processor_id(myrank_) << this->writer_suffix();
 
   currentout_.close();
-  currentout_.open(tmpstream.str().c_str());
+  currentout_.open(tmpstream.str().c_str(), std::ios::out | std::ios::binary);
+
+  appended_data_.clear();
 }
 
 /*----------------------------------------------------------------------*
@@ -386,7 +485,7 @@ void VtkWriterBase::write_vtk_header_this_processor(const std::string& byteorder
   currentout_ << "# vtk DataFile Version 3.0\n";
   currentout_ << "-->\n";
   currentout_ << "<VTKFile type=\"" << this->writer_string() << "\" version=\"0.1\"";
-  currentout_ << " compressor=\"vtkZLibDataCompressor\"";
+  currentout_ << " compressor=\"" << vtk_compressor_name(data_format_) << "\"";
   currentout_ << " byte_order=\"" << byteorder << "\"";
   currentout_ << ">\n";
   currentout_ << "  " << this->writer_opening_tag() << "\n";
@@ -494,9 +593,7 @@ void VtkWriterBase::write_data_array_this_processor(
 
   if (write_binary_output_)
   {
-    filestream << " format=\"binary\">\n";
-
-    LibB64::write_compressed_block(data, filestream);
+    write_binary_data_array_content(filestream, data);
   }
   else
   {
@@ -604,11 +701,60 @@ void VtkWriterBase::write_vtk_footer_this_processor()
   currentout_ << "    </Piece>\n";
 
   currentout_ << "  </" << this->writer_string() << ">\n";
+
+  write_appended_data_this_processor();
+
   currentout_ << "</VTKFile>\n";
 
   currentout_ << std::flush;
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void VtkWriterBase::write_appended_data_this_processor()
+{
+  if (data_format_ != Core::IO::OutputDataFormat::appended_zlib and
+      data_format_ != Core::IO::OutputDataFormat::appended_lz4)
+    return;
+
+  // the offsets of the data arrays count the bytes after the leading underscore
+  currentout_ << "  <AppendedData encoding=\"raw\">\n";
+  currentout_ << "_";
+  currentout_.write(appended_data_.data(), appended_data_.size());
+  currentout_ << "\n  </AppendedData>\n";
+
+  appended_data_.clear();
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+template <typename T>
+void VtkWriterBase::write_binary_data_array_content(
+    std::ostream& filestream, const std::vector<T>& data)
+{
+  if (data_format_ == Core::IO::OutputDataFormat::appended_zlib or
+      data_format_ == Core::IO::OutputDataFormat::appended_lz4)
+  {
+    filestream << " format=\"appended\" offset=\"" << appended_data_.size() << "\">\n";
+
+    append_compressed_blocks(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(T),
+        data_format_, appended_data_);
+  }
+  else
+  {
+    filestream << " format=\"binary\">\n";
+
+    LibB64::write_compressed_block(data, filestream);
+  }
+}
+
+template void VtkWriterBase::write_binary_data_array_content(
+    std::ostream&, const std::vector<double>&);
+template void VtkWriterBase::write_binary_data_array_content(
+    std::ostream&, const std::vector<int>&);
+template void VtkWriterBase::write_binary_data_array_content(
+    std::ostream&, const std::vector<uint8_t>&);
+
 /*----------------------------------------------------------------------*
  *----------------------------------------------------------------------*/
 void VtkWriterBase::write_vtk_collection_file_for_all_written_master_files(
@@ -12,6 +12,7 @@
 #include "4C_config.hpp"
 
 #include "4C_io_visualization_data.hpp"
+#include "4C_io_visualization_parameters.hpp"
 #include "4C_utils_exceptions.hpp"
 
 #include <stdint.h>
@@ -104,7 +105,8 @@ class VtkWriterBase
       unsigned int max_number_timesteps_to_be_written,
       const std::string& path_existing_working_directory,
       const std::string& name_new_vtk_subdirectory, const std::string& geometry_name,
-      const std::string& restart_name, double restart_time, bool write_binary_output);
+      const std::string& restart_name, double restart_time,
+      Core::IO::OutputDataFormat data_format);
 
   //! destructor
   virtual ~VtkWriterBase() = default;
@@ -153,6 +155,14 @@ class VtkWriterBase
   void write_data_array(const Core::IO::visualization_vector_type_variant& data,
       const int num_components, const std::string& name);
 
+  /** \brief write the format of an opened DataArray tag and its binary data
+   *
+   *  Depending on the data format, the data is either written inline (zlib compressed and base64
+   *  encoded) or compressed and appended to the appended data section of this processor's file.
+   *  In the latter case, only the offset into the appended data section is written here. */
+  template <typename T>
+  void write_binary_data_array_content(std::ostream& filestream, const std::vector<T>& data);
+
   //! generate the part of the filename that expresses the processor ID
   const std::string& get_part_of_file_name_indicating_processor_id(unsigned int processor_id) const;
 
@@ -207,6 +217,9 @@ class VtkWriterBase
   //! write epilogue of the VTK file on this processor
   void write_vtk_footer_this_processor();
 
+  //! write the appended data section into the VTK file on this processor
+  void write_appended_data_this_processor();
+
 
   //! initialize the individual vtk file stream on each processor
   void initialize_vtk_file_stream_this_processor();
@@ -336,6 +349,12 @@ class VtkWriterBase
   //! toggle between ascii and binary output
   const bool write_binary_output_;
 
+  //! format of the written numeric data
+  const Core::IO::OutputDataFormat data_format_;
+
+  //! compressed raw binary data of all data arrays in appended format of the current file
+  std::string appended_data_;
+
 
   //! global processor id of this processor
   const unsigned int myrank_;
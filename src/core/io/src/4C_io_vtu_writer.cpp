@@ -24,10 +24,11 @@ VtuWriter::VtuWriter(unsigned int myrank, unsigned int num_processors,
     unsigned int max_number_timesteps_to_be_written,
     const std::string& path_existing_working_directory,
     const std::string& name_new_vtk_subdirectory, const std::string& geometry_name,
-    const std::string& restart_name, const double restart_time, bool write_binary_output)
+    const std::string& restart_name, const double restart_time,
+    Core::IO::OutputDataFormat data_format)
     : VtkWriterBase(myrank, num_processors, max_number_timesteps_to_be_written,
           path_existing_working_directory, name_new_vtk_subdirectory, geometry_name, restart_name,
-          restart_time, write_binary_output)
+          restart_time, data_format)
 {
   // empty constructor
 }
@@ -139,8 +140,7 @@ void VtuWriter::write_geometry_unstructured_grid(const std::vector<double>& poin
 
   if (write_binary_output_)
   {
-    currentout_ << " format=\"binary\">\n";
-    LibB64::write_compressed_block(point_coordinates, currentout_);
+    write_binary_data_array_content(currentout_, point_coordinates);
   }
   else
   {
@@ -177,8 +177,7 @@ void VtuWriter::write_geometry_unstructured_grid(const std::vector<double>& poin
 
   if (write_binary_output_)
   {
-    currentout_ << " format=\"binary\">\n";
-    LibB64::write_compressed_block(point_cell_connectivity, currentout_);
+    write_binary_data_array_content(currentout_, point_cell_connectivity);
   }
   else
   {
@@ -199,8 +198,7 @@ void VtuWriter::write_geometry_unstructured_grid(const std::vector<double>& poin
 
   if (write_binary_output_)
   {
-    currentout_ << " format=\"binary\">\n";
-    LibB64::write_compressed_block(cell_offset, currentout_);
+    write_binary_data_array_content(currentout_, cell_offset);
   }
   else
   {
@@ -219,8 +217,7 @@ void VtuWriter::write_geometry_unstructured_grid(const std::vector<double>& poin
   currentout_ << "        <DataArray type=\"UInt8\" Name=\"types\"";
   if (write_binary_output_)
   {
-    currentout_ << " format=\"binary\">\n";
-    LibB64::write_compressed_block(cell_types, currentout_);
+    write_binary_data_array_content(currentout_, cell_types);
   }
   else
   {
@@ -237,8 +234,7 @@ void VtuWriter::write_geometry_unstructured_grid(const std::vector<double>& poin
     currentout_ << R"(        <DataArray type="Int32" Name="faces")";
     if (write_binary_output_)
     {
-      currentout_ << " format=\"binary\">\n";
-      LibB64::write_compressed_block(face_connectivity, currentout_);
+      write_binary_data_array_content(currentout_, face_connectivity);
     }
     else
     {
@@ -251,8 +247,7 @@ void VtuWriter::write_geometry_unstructured_grid(const std::vector<double>& poin
     currentout_ << R"(        <DataArray type="Int32" Name="faceoffsets")";
     if (write_binary_output_)
     {
-      currentout_ << " format=\"binary\">\n";
-      LibB64::write_compressed_block(face_offset, currentout_);
+      write_binary_data_array_content(currentout_, face_offset);
     }
     else
     {
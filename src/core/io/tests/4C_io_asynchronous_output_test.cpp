@@ -0,0 +1,74 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_io_asynchronous_output.hpp"
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  TEST(AsynchronousOutputTest, DisabledExecutesImmediately)
+  {
+    Core::IO::AsynchronousOutput& output = Core::IO::AsynchronousOutput::instance();
+    output.set_enabled(false);
+
+    const std::thread::id caller = std::this_thread::get_id();
+    bool executed = false;
+    output.run(
+        [&]()
+        {
+          executed = true;
+          EXPECT_EQ(std::this_thread::get_id(), caller);
+        });
+    EXPECT_TRUE(executed);
+  }
+
+  TEST(AsynchronousOutputTest, EnabledExecutesInOrderOnBackgroundThread)
+  {
+    Core::IO::AsynchronousOutput& output = Core::IO::AsynchronousOutput::instance();
+    output.set_enabled(true);
+
+    const std::thread::id caller = std::this_thread::get_id();
+    std::vector<int> order;
+    for (int i = 0; i < 100; ++i)
+    {
+      output.run(
+          [&order, caller, i]()
+          {
+            EXPECT_NE(std::this_thread::get_id(), caller);
+            order.push_back(i);
+          });
+    }
+    output.wait();
+
+    ASSERT_EQ(order.size(), 100u);
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(order[i], i);
+
+    output.set_enabled(false);
+  }
+
+  TEST(AsynchronousOutputTest, WaitRethrowsFirstException)
+  {
+    Core::IO::AsynchronousOutput& output = Core::IO::AsynchronousOutput::instance();
+    output.set_enabled(true);
+
+    output.run([]() { throw std::runtime_error("first"); });
+    output.run([]() { throw std::logic_error("second"); });
+    EXPECT_THROW(output.wait(), std::runtime_error);
+
+    // the exception is only reported once
+    EXPECT_NO_THROW(output.wait());
+
+    output.set_enabled(false);
+  }
+}  // namespace
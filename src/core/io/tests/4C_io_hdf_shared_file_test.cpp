@@ -0,0 +1,97 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_io_hdf_shared_file.hpp"
+
+#include <Epetra_MpiComm.h>
+
+#include <cstdio>
+#include <numeric>
+
+
+namespace
+{
+  using namespace FourC;
+
+  class HDFSharedFileTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      file_ = H5Fcreate(filename_.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+      ASSERT_GE(file_, 0);
+    }
+
+    void TearDown() override
+    {
+      H5Fclose(file_);
+      std::remove(filename_.c_str());
+    }
+
+    const std::string filename_ = "hdf_shared_file_test.h5";
+    hid_t file_ = -1;
+  };
+
+  TEST_F(HDFSharedFileTest, ReadBlocksOfMultiVector)
+  {
+    Epetra_MpiComm comm(MPI_COMM_WORLD);
+
+    // two columns with 7 rows, stored column by column
+    std::vector<double> values(14);
+    std::iota(values.begin(), values.end(), 0.0);
+    Core::IO::write_shared_hdf5_dataset(
+        file_, "values", H5T_NATIVE_DOUBLE, values.data(), 7, 2, 0, comm);
+
+    // the rows are distributed as 3, 2, 2 among three procs
+    EXPECT_EQ(Core::IO::read_hdf5_double_block(file_, "values", 2, 3, 0),
+        (std::vector<double>{0, 1, 2, 7, 8, 9}));
+    EXPECT_EQ(Core::IO::read_hdf5_double_block(file_, "values", 2, 3, 1),
+        (std::vector<double>{3, 4, 10, 11}));
+    EXPECT_EQ(Core::IO::read_hdf5_double_block(file_, "values", 2, 3, 2),
+        (std::vector<double>{5, 6, 12, 13}));
+  }
+
+  TEST_F(HDFSharedFileTest, CompressedDataset)
+  {
+    Epetra_MpiComm comm(MPI_COMM_WORLD);
+
+    std::vector<int> ids(100000);
+    std::iota(ids.begin(), ids.end(), 42);
+    Core::IO::write_shared_hdf5_dataset(file_, "ids", H5T_NATIVE_INT, ids.data(), ids.size(), 1,
+        6, comm);
+
+    EXPECT_EQ(Core::IO::read_hdf5_int_block(file_, "ids", 1, 1, 0), ids);
+  }
+
+  TEST_F(HDFSharedFileTest, EmptyDataset)
+  {
+    Epetra_MpiComm comm(MPI_COMM_WORLD);
+
+    Core::IO::write_shared_hdf5_dataset(file_, "ids", H5T_NATIVE_INT, nullptr, 0, 1, 0, comm);
+
+    EXPECT_TRUE(Core::IO::read_hdf5_int_block(file_, "ids", 1, 2, 0).empty());
+    EXPECT_TRUE(Core::IO::read_hdf5_int_block(file_, "ids", 1, 2, 1).empty());
+  }
+
+  TEST_F(HDFSharedFileTest, ReadCharRangesOfProcs)
+  {
+    Epetra_MpiComm comm(MPI_COMM_WORLD);
+
+    // the packed data of three procs with the sizes 4, 0 and 3 stored one after the other
+    const std::string data = "abcdefg";
+    Core::IO::write_shared_hdf5_dataset(
+        file_, "data", H5T_NATIVE_CHAR, data.data(), data.size(), 1, 0, comm);
+
+    EXPECT_EQ(Core::IO::read_hdf5_char_range(file_, "data", 0, 4),
+        (std::vector<char>{'a', 'b', 'c', 'd'}));
+    EXPECT_TRUE(Core::IO::read_hdf5_char_range(file_, "data", 4, 0).empty());
+    EXPECT_EQ(
+        Core::IO::read_hdf5_char_range(file_, "data", 4, 3), (std::vector<char>{'e', 'f', 'g'}));
+  }
+}  // namespace
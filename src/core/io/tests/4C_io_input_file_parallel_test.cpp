@@ -0,0 +1,141 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_io_input_file.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+
+#include <Epetra_MpiComm.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  //! number of lines in the on-the-fly section
+  constexpr int num_lines = 31;
+
+  //! every line of the section has this many bytes including the line break
+  constexpr int line_length = 10;
+
+  //! the line with index @p i of the on-the-fly section
+  std::string section_line(int i)
+  {
+    std::ostringstream line;
+    line << "line " << std::setw(4) << std::setfill('0') << i;
+    return line.str();
+  }
+
+  class InputFileParallelTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      // the name of an excluded section makes the section an on-the-fly section
+      if (Core::Communication::my_mpi_rank(comm_) == 0)
+      {
+        std::ofstream file(filename_);
+        file << header_;
+        for (int i = 0; i < num_lines; ++i) file << section_line(i) << "\n";
+        file << "--SHORT SECTION\nline in short section\n";
+      }
+      comm_.Barrier();
+    }
+
+    void TearDown() override
+    {
+      comm_.Barrier();
+      if (Core::Communication::my_mpi_rank(comm_) == 0) std::remove(filename_.c_str());
+    }
+
+    Epetra_MpiComm comm_{MPI_COMM_WORLD};
+    const std::string filename_ = "input_file_parallel_test.dat";
+    const std::string header_ = "--TITLE\nparallel read\n--NODE COORDS\n";
+  };
+
+  TEST_F(InputFileParallelTest, MyLinesAreDisjointAndComplete)
+  {
+    Core::IO::InputFile input{filename_, comm_};
+    const int myrank = Core::Communication::my_mpi_rank(comm_);
+    const int numproc = Core::Communication::num_mpi_ranks(comm_);
+    ASSERT_GE(numproc, 2);
+
+    // count how often each line is read and by which rank
+    std::vector<int> my_count(num_lines, 0);
+    std::vector<int> my_owner(num_lines, -1);
+    for (const std::string& line : input.my_lines_in_section("NODE COORDS"))
+    {
+      const int i = std::stoi(line.substr(5));
+      ASSERT_EQ(line, section_line(i));
+      ++my_count[i];
+      my_owner[i] = myrank;
+    }
+
+    std::vector<int> count(num_lines);
+    std::vector<int> owner(num_lines);
+    comm_.SumAll(my_count.data(), count.data(), num_lines);
+    comm_.MaxAll(my_owner.data(), owner.data(), num_lines);
+
+    for (int i = 0; i < num_lines; ++i) EXPECT_EQ(count[i], 1) << "line " << i;
+
+    // the lines of a lower rank precede the ones of a higher rank
+    for (int i = 1; i < num_lines; ++i) EXPECT_LE(owner[i - 1], owner[i]);
+
+    // every rank gets a share of the section
+    for (int rank = 0; rank < numproc; ++rank)
+      EXPECT_NE(std::find(owner.begin(), owner.end(), rank), owner.end()) << "rank " << rank;
+  }
+
+  TEST_F(InputFileParallelTest, LineAcrossRangeBoundaryGoesToOneRank)
+  {
+    Core::IO::InputFile input{filename_, comm_};
+    const int numproc = Core::Communication::num_mpi_ranks(comm_);
+
+    std::vector<int> my_count(num_lines, 0);
+    for (const std::string& line : input.my_lines_in_section("NODE COORDS"))
+      ++my_count[std::stoi(line.substr(5))];
+    std::vector<int> count(num_lines);
+    comm_.SumAll(my_count.data(), count.data(), num_lines);
+
+    // the byte ranges of the ranks are computed relative to the section begin
+    const int chunk = num_lines * line_length / numproc;
+    for (int rank = 1; rank < numproc; ++rank)
+    {
+      const int boundary = rank * chunk;
+      ASSERT_NE(boundary % line_length, 0) << "the range boundary does not split a line";
+
+      const int split_line = boundary / line_length;
+      EXPECT_EQ(count[split_line], 1) << "line " << split_line << " crosses a range boundary";
+
+      // the split line starts in front of the boundary, hence the lower rank reads it
+      int my_reader = my_count[split_line] > 0 ? Core::Communication::my_mpi_rank(comm_) : -1;
+      int reader = -1;
+      comm_.MaxAll(&my_reader, &reader, 1);
+      EXPECT_EQ(reader, rank - 1);
+    }
+  }
+
+  TEST_F(InputFileParallelTest, PreReadSectionGoesToRankZero)
+  {
+    Core::IO::InputFile input{filename_, comm_};
+
+    const std::vector<std::string> lines = input.my_lines_in_section("SHORT SECTION");
+    if (Core::Communication::my_mpi_rank(comm_) == 0)
+      EXPECT_EQ(lines, std::vector<std::string>{"line in short section"});
+    else
+      EXPECT_TRUE(lines.empty());
+  }
+}  // namespace
@@ -165,6 +165,22 @@ namespace
     check_section(input, "PARTICLES", std::vector<std::string>(30, "line in long section"));
   }
 
+  TEST(InputFile, MyLinesInSection)
+  {
+    const std::string input_file_name = TESTING::get_support_file_path("test_files/test1.dat");
+
+    Epetra_MpiComm comm(MPI_COMM_WORLD);
+    Core::IO::InputFile input{input_file_name, comm};
+
+    // on-the-fly section ends right before the next section
+    EXPECT_EQ(input.my_lines_in_section("PARTICLES"),
+        std::vector<std::string>(30, "line in long section"));
+    // pre-read section
+    EXPECT_EQ(input.my_lines_in_section("SHORT SECTION"),
+        std::vector<std::string>(3, "line in short section"));
+    EXPECT_TRUE(input.my_lines_in_section("EMPTY").empty());
+  }
+
   TEST(InputFile, HasIncludes)
   {
     const std::string input_file_name =
@@ -0,0 +1,217 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_io_vtu_writer.hpp"
+
+#include "4C_io_pstream.hpp"
+
+#include <Epetra_SerialComm.h>
+#include <zlib.h>
+
+#ifdef FOUR_C_WITH_LZ4
+#include <lz4.h>
+#endif
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  //! size of the uncompressed blocks written by the VtuWriter
+  constexpr std::size_t block_size = 32768;
+
+  //! the raw binary data of all data arrays in appended format, indexed by their name
+  struct AppendedFile
+  {
+    std::map<std::string, std::size_t> offsets;
+    std::string appended_data;
+  };
+
+  AppendedFile read_appended_file(const std::filesystem::path& directory)
+  {
+    std::filesystem::path vtu_file;
+    for (const auto& entry : std::filesystem::directory_iterator(directory))
+      if (entry.path().extension() == ".vtu") vtu_file = entry.path();
+
+    std::ifstream in(vtu_file, std::ios::binary);
+    const std::string content(
+        (std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    // the appended section starts behind the underscore and runs up to the closing tag
+    const std::string appended_tag = "<AppendedData encoding=\"raw\">\n_";
+    const std::size_t appended_begin = content.find(appended_tag);
+    EXPECT_NE(appended_begin, std::string::npos);
+    const std::size_t data_begin = appended_begin + appended_tag.size();
+    const std::size_t data_end = content.rfind("\n  </AppendedData>");
+
+    AppendedFile file;
+    file.appended_data = content.substr(data_begin, data_end - data_begin);
+
+    // data arrays without name are the point coordinates
+    for (std::size_t pos = content.find("<DataArray"); pos < appended_begin;
+         pos = content.find("<DataArray", pos + 1))
+    {
+      const std::string tag = content.substr(pos, content.find('>', pos) - pos);
+      EXPECT_NE(tag.find("format=\"appended\""), std::string::npos) << tag;
+
+      std::string name = "Points";
+      if (const std::size_t name_pos = tag.find("Name=\""); name_pos != std::string::npos)
+        name = tag.substr(name_pos + 6, tag.find('"', name_pos + 6) - name_pos - 6);
+
+      const std::size_t offset_pos = tag.find("offset=\"") + 8;
+      file.offsets[name] =
+          std::stoul(tag.substr(offset_pos, tag.find('"', offset_pos) - offset_pos));
+    }
+
+    return file;
+  }
+
+  //! check the block header of one data array and return its decompressed data
+  std::string decompress_data_array(const std::string& appended_data, std::size_t offset,
+      std::size_t num_bytes, Core::IO::OutputDataFormat data_format)
+  {
+    auto header_entry = [&](std::size_t i)
+    {
+      std::uint32_t value;
+      std::memcpy(&value, appended_data.data() + offset + i * sizeof(value), sizeof(value));
+      return static_cast<std::size_t>(value);
+    };
+
+    const std::size_t num_blocks = header_entry(0);
+    EXPECT_EQ(num_blocks, (num_bytes + block_size - 1) / block_size);
+    EXPECT_EQ(header_entry(1), block_size);
+    EXPECT_EQ(header_entry(2), num_bytes - (num_blocks - 1) * block_size);
+
+    std::string data;
+    std::size_t compressed_pos = offset + (3 + num_blocks) * sizeof(std::uint32_t);
+    for (std::size_t block = 0; block < num_blocks; ++block)
+    {
+      const std::size_t compressed_size = header_entry(3 + block);
+      const std::size_t expected_size = (block + 1 == num_blocks) ? header_entry(2) : block_size;
+
+      std::string uncompressed(expected_size, '\0');
+      std::size_t uncompressed_size = 0;
+      if (data_format == Core::IO::OutputDataFormat::appended_zlib)
+      {
+        uLongf zlib_size = expected_size;
+        EXPECT_EQ(uncompress(reinterpret_cast<Bytef*>(uncompressed.data()), &zlib_size,
+                      reinterpret_cast<const Bytef*>(appended_data.data() + compressed_pos),
+                      compressed_size),
+            Z_OK);
+        uncompressed_size = zlib_size;
+      }
+#ifdef FOUR_C_WITH_LZ4
+      else
+      {
+        uncompressed_size = LZ4_decompress_safe(appended_data.data() + compressed_pos,
+            uncompressed.data(), static_cast<int>(compressed_size),
+            static_cast<int>(expected_size));
+      }
+#endif
+      EXPECT_EQ(uncompressed_size, expected_size);
+
+      data += uncompressed;
+      compressed_pos += compressed_size;
+    }
+
+    return data;
+  }
+
+  class VtuWriterAppendedTest : public ::testing::TestWithParam<Core::IO::OutputDataFormat>
+  {
+   protected:
+    void SetUp() override
+    {
+      Core::IO::cout.setup(false, false, false, Core::IO::standard,
+          std::make_shared<Epetra_SerialComm>(), 0, 0, "dummyFilePrefix");
+
+      // a cloud of vertex cells whose coordinates and point data span several blocks
+      const int num_points = 5000;
+      for (int i = 0; i < num_points; ++i)
+      {
+        for (int d = 0; d < 3; ++d) point_coordinates_.push_back(0.001 * i + d);
+        point_data_.push_back(std::sin(0.01 * i));
+        point_cell_connectivity_.push_back(i);
+        cell_offset_.push_back(i + 1);
+        cell_types_.push_back(1);
+      }
+
+      std::filesystem::remove_all(directory_);
+    }
+
+    void TearDown() override
+    {
+      Core::IO::cout.close();
+      std::filesystem::remove_all(directory_);
+    }
+
+    void write_file(Core::IO::OutputDataFormat data_format)
+    {
+      VtuWriter writer(0, 1, 10, "", directory_, "geometry", "", 0.0, data_format);
+      writer.reset_time_and_time_step(0.0, 0);
+      writer.initialize_vtk_file_streams_for_new_geometry_and_or_time_step();
+      writer.write_vtk_headers();
+      writer.write_geometry_unstructured_grid(
+          point_coordinates_, point_cell_connectivity_, cell_offset_, cell_types_, {}, {});
+      writer.write_point_data_vector(point_data_, 1, "data");
+      writer.write_vtk_footers();
+    }
+
+    const std::string directory_ = "vtu_writer_appended_test";
+    std::vector<double> point_coordinates_;
+    std::vector<double> point_data_;
+    std::vector<Core::IO::index_type> point_cell_connectivity_;
+    std::vector<Core::IO::index_type> cell_offset_;
+    std::vector<uint8_t> cell_types_;
+  };
+
+  TEST_P(VtuWriterAppendedTest, BlockHeaderAndDataRoundTrip)
+  {
+    const Core::IO::OutputDataFormat data_format = GetParam();
+    write_file(data_format);
+    const AppendedFile file = read_appended_file(directory_);
+
+    auto expect_round_trip = [&](const std::string& name, const auto& expected)
+    {
+      SCOPED_TRACE(name);
+      ASSERT_EQ(file.offsets.count(name), 1u);
+      const std::size_t num_bytes = expected.size() * sizeof(expected[0]);
+      const std::string data =
+          decompress_data_array(file.appended_data, file.offsets.at(name), num_bytes, data_format);
+      ASSERT_EQ(data.size(), num_bytes);
+      EXPECT_EQ(std::memcmp(data.data(), expected.data(), num_bytes), 0);
+    };
+
+    // 120000 bytes in four blocks, the last one partially filled
+    expect_round_trip("Points", point_coordinates_);
+    // 40000 bytes in two blocks
+    expect_round_trip("data", point_data_);
+    expect_round_trip("connectivity", point_cell_connectivity_);
+    expect_round_trip("offsets", cell_offset_);
+    // less than one block
+    expect_round_trip("types", cell_types_);
+  }
+
+  INSTANTIATE_TEST_SUITE_P(AppendedFormats, VtuWriterAppendedTest,
+      ::testing::Values(Core::IO::OutputDataFormat::appended_zlib
+#ifdef FOUR_C_WITH_LZ4
+          ,
+          Core::IO::OutputDataFormat::appended_lz4
+#endif
+          ));
+}  // namespace
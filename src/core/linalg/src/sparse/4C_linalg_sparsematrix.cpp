@@ -12,6 +12,7 @@
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <iterator>
 #include <memory>
@@ -386,6 +387,8 @@ void Core::LinAlg::SparseMatrix::assemble(int eid, const std::vector<int>& lmstr
     if (!doit) return;
 #endif
 
+    if (assemble_with_plan(eid, Aele, lmrow, lmrowowner, lmcol)) return;
+
     std::vector<int> localcol(lcoldim);
     for (int lcol = 0; lcol < lcoldim; ++lcol)
     {
@@ -573,6 +576,8 @@ void Core::LinAlg::SparseMatrix::assemble(int eid, const Core::LinAlg::SerialDen
     if (!doit) return;
 #endif
 
+    if (assemble_with_plan(eid, Aele, lmrow, lmrowowner, lmcol)) return;
+
     std::vector<double> values(lcoldim);
     std::vector<int> localcol(lcoldim);
     for (int lcol = 0; lcol < lcoldim; ++lcol)
@@ -647,6 +652,137 @@ void Core::LinAlg::SparseMatrix::assemble(int eid, const Core::LinAlg::SerialDen
   }
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::LinAlg::SparseMatrix::enable_assembly_plans(bool enable)
+{
+  use_assembly_plans_ = enable;
+  if (not use_assembly_plans_)
+  {
+    assembly_plans_.clear();
+    assembly_plans_graph_.reset();
+  }
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Core::LinAlg::SparseMatrix::assemble_with_plan(int eid,
+    const Core::LinAlg::SerialDenseMatrix& Aele, const std::vector<int>& lmrow,
+    const std::vector<int>& lmrowowner, const std::vector<int>& lmcol)
+{
+  if (not use_assembly_plans_ or graph_ == nullptr or not sysmat_->Filled()) return false;
+
+  // the matrix has to be built on the saved graph (not the case after an explicit Dirichlet
+  // application)
+  if (sysmat_->NumMyNonzeros() != graph_->NumMyNonzeros()) return false;
+
+  // plans of an old graph are useless
+  ElementAssemblyPlan* plan = nullptr;
+  {
+    std::shared_lock<std::shared_mutex> lock(assembly_plans_mutex_);
+    if (assembly_plans_graph_.lock() == graph_)
+    {
+      auto it = assembly_plans_.find(eid);
+      if (it != assembly_plans_.end()) plan = &it->second;
+    }
+  }
+
+  // references to map entries stay valid on insertion, and an element's own plan is only
+  // touched by the thread assembling that element
+  if (plan == nullptr)
+  {
+    std::unique_lock<std::shared_mutex> lock(assembly_plans_mutex_);
+    if (assembly_plans_graph_.lock() != graph_)
+    {
+      assembly_plans_.clear();
+      assembly_plans_graph_ = graph_;
+    }
+    plan = &assembly_plans_[eid];
+  }
+
+  if (plan->lmrow != lmrow or plan->lmcol != lmcol or plan->lmrowowner != lmrowowner)
+  {
+    if (not build_assembly_plan(*plan, lmrow, lmrowowner, lmcol))
+    {
+      std::unique_lock<std::shared_mutex> lock(assembly_plans_mutex_);
+      assembly_plans_.erase(eid);
+      return false;
+    }
+  }
+
+  const int lrowdim = static_cast<int>(lmrow.size());
+  const int lcoldim = static_cast<int>(lmcol.size());
+  for (int lrow = 0; lrow < lrowdim; ++lrow)
+  {
+    const int rlid = plan->rowlids[lrow];
+    if (rlid < 0) continue;
+
+    int length;
+    double* valview;
+    int* indices;
+    sysmat_->ExtractMyRowView(rlid, length, valview, indices);
+
+    const int* positions = &plan->positions[lrow * lcoldim];
+    for (int lcol = 0; lcol < lcoldim; ++lcol) valview[positions[lcol]] += Aele(lrow, lcol);
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Core::LinAlg::SparseMatrix::build_assembly_plan(ElementAssemblyPlan& plan,
+    const std::vector<int>& lmrow, const std::vector<int>& lmrowowner,
+    const std::vector<int>& lmcol) const
+{
+  const int lrowdim = static_cast<int>(lmrow.size());
+  const int lcoldim = static_cast<int>(lmcol.size());
+
+  const int myrank = Core::Communication::my_mpi_rank(sysmat_->Comm());
+  const Epetra_Map& rowmap = sysmat_->RowMap();
+  const Epetra_Map& colmap = sysmat_->ColMap();
+
+  std::vector<int> localcol(lcoldim);
+  for (int lcol = 0; lcol < lcoldim; ++lcol)
+  {
+    localcol[lcol] = colmap.LID(lmcol[lcol]);
+    if (localcol[lcol] < 0) return false;
+  }
+
+  plan.rowlids.assign(lrowdim, -1);
+  plan.positions.assign(lrowdim * lcoldim, -1);
+
+  for (int lrow = 0; lrow < lrowdim; ++lrow)
+  {
+    if (lmrowowner[lrow] != myrank) continue;
+
+    const int rgid = lmrow[lrow];
+    if (dbcmaps_ != nullptr and dbcmaps_->Map(1)->MyGID(rgid)) continue;
+
+    const int rlid = rowmap.LID(rgid);
+    if (rlid < 0) return false;
+
+    int length;
+    double* valview;
+    int* indices;
+    if (sysmat_->ExtractMyRowView(rlid, length, valview, indices)) return false;
+
+    for (int lcol = 0; lcol < lcoldim; ++lcol)
+    {
+      const int* loc = std::lower_bound(indices, indices + length, localcol[lcol]);
+      if (loc == indices + length or *loc != localcol[lcol]) return false;
+      plan.positions[lrow * lcoldim + lcol] = static_cast<int>(loc - indices);
+    }
+    plan.rowlids[lrow] = rlid;
+  }
+
+  plan.lmrow = lmrow;
+  plan.lmrowowner = lmrowowner;
+  plan.lmcol = lmcol;
+
+  return true;
+}
+
 /*----------------------------------------------------------------------*
  *----------------------------------------------------------------------*/
 void Core::LinAlg::SparseMatrix::fe_assemble(const Core::LinAlg::SerialDenseMatrix& Aele,
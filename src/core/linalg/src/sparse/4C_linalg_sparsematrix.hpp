@@ -17,6 +17,11 @@
 #include <Epetra_Comm.h>
 #include <Epetra_FECrsMatrix.h>
 
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
 class Epetra_CrsMatrix;
 
 FOUR_C_NAMESPACE_OPEN
@@ -204,6 +209,22 @@ namespace Core::LinAlg
     /// single value assemble used by BlockSparseMatrix
     void assemble(double val, int rgid, int cgid) override;
 
+    /// Cache element assembly plans for the saved graph
+    /*!
+      With savegraph==true the sparsity pattern does not change between calls to Zero(). If
+      assembly plans are enabled, the first assembly of an element into the Filled() matrix stores
+      the local row ids and the positions of all element entries inside the matrix rows under the
+      element id. Subsequent assemblies of the same element with the same location vectors reduce
+      to a scatter-add without any map lookups or allocations.
+
+      The plans are discarded whenever the saved graph changes. A plan is only reused if the
+      location vectors passed to assemble() are identical to the ones the plan was built for.
+
+      \note The plans need memory in the order of the number of element matrix entries on this
+      proc. Only enable them for matrices that are reassembled frequently.
+     */
+    void enable_assembly_plans(bool enable = true);
+
 
     /*
      * \brief Set a single value in a Epetra_FECrsMatrix
@@ -365,6 +386,30 @@ namespace Core::LinAlg
     //@}
 
    private:
+    /// cached positions of the entries of one element matrix in the rows of the filled matrix
+    struct ElementAssemblyPlan
+    {
+      //! location vectors the plan was built for
+      std::vector<int> lmrow;
+      std::vector<int> lmrowowner;
+      std::vector<int> lmcol;
+
+      //! local row id of each element row, -1 if the row is not assembled on this proc
+      std::vector<int> rowlids;
+
+      //! position of each element matrix entry (row-major) inside its matrix row
+      std::vector<int> positions;
+    };
+
+    /// assemble into the filled matrix with a cached plan, return false if no plan is available
+    bool assemble_with_plan(int eid, const Core::LinAlg::SerialDenseMatrix& Aele,
+        const std::vector<int>& lmrow, const std::vector<int>& lmrowowner,
+        const std::vector<int>& lmcol);
+
+    /// build the assembly plan for the given location vectors, return false on failure
+    bool build_assembly_plan(ElementAssemblyPlan& plan, const std::vector<int>& lmrow,
+        const std::vector<int>& lmrowowner, const std::vector<int>& lmcol) const;
+
     /// saved graph (if any)
     std::shared_ptr<Epetra_CrsGraph> graph_;
 
@@ -379,6 +424,18 @@ namespace Core::LinAlg
 
     /// matrix type (Epetra_CrsMatrix or Epetra_FECrsMatrix)
     MatrixType matrixtype_;
+
+    /// whether element assembly plans are cached
+    bool use_assembly_plans_ = false;
+
+    /// graph the cached assembly plans refer to
+    std::weak_ptr<Epetra_CrsGraph> assembly_plans_graph_;
+
+    /// cached assembly plans by element id
+    std::unordered_map<int, ElementAssemblyPlan> assembly_plans_;
+
+    /// guards the plan cache, elements of different colors may assemble concurrently
+    std::shared_mutex assembly_plans_mutex_;
   };
 
   //! Cast matrix of type SparseOperator to const SparseMatrix and check in debug mode if cast was
@@ -0,0 +1,185 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_linalg_sparsematrix.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_linalg_serialdensematrix.hpp"
+
+// Epetra related headers
+#include <Epetra_Map.h>
+#include <Epetra_MpiComm.h>
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  /*!
+   * A chain of two-node line elements on a distributed map with one dof per node. Every rank
+   * assembles all elements touching one of its rows, so the elements at the rank boundary come
+   * with rows owned by the neighboring rank.
+   */
+  class SparseMatrixAssemblyPlanTest : public testing::Test
+  {
+   public:
+    std::shared_ptr<Epetra_Comm> comm_;
+    std::shared_ptr<Epetra_Map> map_;
+    std::vector<int> owner_;
+    int NumGlobalElements = 10;
+
+   protected:
+    SparseMatrixAssemblyPlanTest()
+    {
+      // set up communicator
+      comm_ = std::make_shared<Epetra_MpiComm>(MPI_COMM_WORLD);
+
+      // set up a map
+      map_ = std::make_shared<Epetra_Map>(NumGlobalElements, 0, *comm_);
+
+      // owners of all dofs, also the ones of the other ranks
+      std::vector<int> gids(NumGlobalElements);
+      for (int gid = 0; gid < NumGlobalElements; ++gid) gids[gid] = gid;
+      std::vector<int> lids(NumGlobalElements);
+      owner_.resize(NumGlobalElements);
+      map_->RemoteIDList(NumGlobalElements, gids.data(), owner_.data(), lids.data());
+    }
+
+    //! location vectors of element @p eid, optionally in reversed node order
+    std::pair<std::vector<int>, std::vector<int>> location(int eid, bool reversed) const
+    {
+      std::vector<int> lm = {eid, eid + 1};
+      if (reversed) std::swap(lm[0], lm[1]);
+      return {lm, {owner_[lm[0]], owner_[lm[1]]}};
+    }
+
+    //! element matrix of element @p eid, consistent with the node order of location()
+    Core::LinAlg::SerialDenseMatrix element_matrix(int eid, double factor, bool reversed) const
+    {
+      // all values are exactly representable, so the assembled sums are exact
+      Core::LinAlg::SerialDenseMatrix Aele(2, 2);
+      for (int i = 0; i < 2; ++i)
+        for (int j = 0; j < 2; ++j)
+        {
+          const double value = factor * (1.0 + eid) + 0.5 * i - 0.25 * j;
+          Aele(reversed ? 1 - i : i, reversed ? 1 - j : j) = value;
+        }
+      return Aele;
+    }
+
+    //! assemble all elements touching my rows into @p A
+    void assemble(Core::LinAlg::SparseMatrix& A, double factor, int reversed_eid = -1) const
+    {
+      const int myrank = Core::Communication::my_mpi_rank(*comm_);
+      const std::vector<int> lmstride = {1, 1};
+      for (int eid = 0; eid < NumGlobalElements - 1; ++eid)
+      {
+        if (owner_[eid] != myrank and owner_[eid + 1] != myrank) continue;
+
+        const bool reversed = eid == reversed_eid;
+        const auto [lm, lmowner] = location(eid, reversed);
+        A.assemble(eid, lmstride, element_matrix(eid, factor, reversed), lm, lmowner, lm);
+      }
+      A.complete();
+    }
+  };
+
+  //! return all entries of my rows sorted by global row and column id
+  std::map<std::pair<int, int>, double> matrix_entries(const Core::LinAlg::SparseMatrix& A)
+  {
+    std::map<std::pair<int, int>, double> entries;
+    const Epetra_CrsMatrix& crs = *A.epetra_matrix();
+    for (int lrow = 0; lrow < crs.NumMyRows(); ++lrow)
+    {
+      int length;
+      double* values;
+      int* indices;
+      crs.ExtractMyRowView(lrow, length, values, indices);
+      for (int k = 0; k < length; ++k) entries[{crs.GRID(lrow), crs.GCID(indices[k])}] = values[k];
+    }
+    return entries;
+  }
+
+  void expect_equal_entries(
+      const Core::LinAlg::SparseMatrix& expected, const Core::LinAlg::SparseMatrix& actual)
+  {
+    const auto expected_entries = matrix_entries(expected);
+    const auto actual_entries = matrix_entries(actual);
+    ASSERT_EQ(expected_entries.size(), actual_entries.size());
+    for (const auto& [index, value] : expected_entries)
+    {
+      ASSERT_EQ(actual_entries.count(index), 1u);
+      EXPECT_EQ(actual_entries.at(index), value)
+          << "entry (" << index.first << "," << index.second << ")";
+    }
+  }
+
+  TEST_F(SparseMatrixAssemblyPlanTest, PlanAssemblyMatchesStandardAssembly)
+  {
+    Core::LinAlg::SparseMatrix standard(*map_, 3, false, true);
+    Core::LinAlg::SparseMatrix planned(*map_, 3, false, true);
+    planned.enable_assembly_plans();
+
+    // the first assembly into the unfilled matrices builds the graph
+    assemble(standard, 1.0);
+    assemble(planned, 1.0);
+    expect_equal_entries(standard, planned);
+
+    // the second one builds the plans, the following ones reuse them
+    for (const double factor : {2.0, 3.0, -1.5})
+    {
+      standard.zero();
+      planned.zero();
+      assemble(standard, factor);
+      assemble(planned, factor);
+      expect_equal_entries(standard, planned);
+    }
+  }
+
+  TEST_F(SparseMatrixAssemblyPlanTest, ChangedLocationVectorRebuildsPlan)
+  {
+    Core::LinAlg::SparseMatrix standard(*map_, 3, false, true);
+    Core::LinAlg::SparseMatrix planned(*map_, 3, false, true);
+    planned.enable_assembly_plans();
+
+    assemble(standard, 1.0);
+    assemble(planned, 1.0);
+    planned.zero();
+    assemble(planned, 2.0);
+
+    // reverse the node order of an element at the rank boundary, which has an off-processor row
+    const int boundary_eid = map_->MaxAllGID() / 2;
+    for (const double factor : {2.0, 4.0})
+    {
+      standard.zero();
+      planned.zero();
+      assemble(standard, factor, boundary_eid);
+      assemble(planned, factor, boundary_eid);
+      expect_equal_entries(standard, planned);
+    }
+
+    // the reordered element contributes the very same entries as before
+    Core::LinAlg::SparseMatrix reference(*map_, 3, false, true);
+    assemble(reference, 4.0);
+    expect_equal_entries(reference, planned);
+
+    // switching back to the original order rebuilds the plan once more
+    standard.zero();
+    planned.zero();
+    assemble(standard, 5.0);
+    assemble(planned, 5.0);
+    expect_equal_entries(standard, planned);
+  }
+}  // namespace
+
+FOUR_C_NAMESPACE_CLOSE
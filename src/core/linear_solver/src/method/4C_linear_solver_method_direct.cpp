@@ -15,14 +15,40 @@
 #include <Amesos_Umfpack.h>
 #include <Epetra_LinearProblem.h>
 
+#include <algorithm>
+
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  //! Check on all processes whether @p A and @p B have the same local sparsity pattern
+  bool have_same_graph(const Epetra_CrsMatrix& A, const Epetra_CrsMatrix& B)
+  {
+    int same = A.RowMap().SameAs(B.RowMap()) and A.ColMap().SameAs(B.ColMap()) and
+               A.NumMyNonzeros() == B.NumMyNonzeros();
+
+    for (int row = 0; same and row < A.NumMyRows(); ++row)
+    {
+      int num_a, num_b;
+      int *indices_a, *indices_b;
+      A.Graph().ExtractMyRowView(row, num_a, indices_a);
+      B.Graph().ExtractMyRowView(row, num_b, indices_b);
+      same = num_a == num_b and std::equal(indices_a, indices_a + num_a, indices_b);
+    }
+
+    int all_same;
+    A.Comm().MinAll(&same, &all_same, 1);
+    return all_same;
+  }
+}  // namespace
+
 //----------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------
 template <class MatrixType, class VectorType>
 Core::LinearSolver::DirectSolver<MatrixType, VectorType>::DirectSolver(std::string solvertype)
     : solvertype_(solvertype),
       factored_(false),
+      symbolic_factored_(false),
       solver_(nullptr),
       reindexer_(nullptr),
       projector_(nullptr)
@@ -67,34 +93,44 @@ void Core::LinearSolver::DirectSolver<MatrixType, VectorType>::setup(
 
   x_ = x;
   b_ = b;
-  a_ = crsA;
 
-  // 3. Do a GID reindexing of the overall problem and create the direct solver
   linear_problem_->SetRHS(b_->get_ptr_of_Epetra_MultiVector().get());
   linear_problem_->SetLHS(x_->get_ptr_of_Epetra_MultiVector().get());
-  linear_problem_->SetOperator(a_.get());
 
-  if (reindexer_ and not(reset or refactor)) reindexer_->fwd();
+  // 3. Keep the solver object and its symbolic factorization as long as the sparsity pattern
+  // does not change. Only the reindexed view of the linear problem is updated to the new matrix.
+  const bool same_graph = not reset and a_ != nullptr and have_same_graph(*crsA, *a_);
+
+  a_ = crsA;
+  linear_problem_->SetOperator(a_.get());
 
-  if (reset or refactor or not is_factored())
+  if (same_graph)
   {
-    reindexer_ = std::make_shared<EpetraExt::LinearProblem_Reindex2>(nullptr);
+    if (refactor) factored_ = false;
 
-    if (solvertype_ == "umfpack")
-    {
-      solver_ = std::make_shared<Amesos_Umfpack>((*reindexer_)(*linear_problem_));
-    }
-    else if (solvertype_ == "superlu")
-    {
-      solver_ = std::make_shared<Amesos_Superludist>((*reindexer_)(*linear_problem_));
-    }
-    else
-    {
-      solver_ = std::make_shared<Amesos_Klu>((*reindexer_)(*linear_problem_));
-    }
+    reindexer_->fwd();
+    return;
+  }
+
+  // 4. Do a GID reindexing of the overall problem and create the direct solver
 
-    factored_ = false;
+  reindexer_ = std::make_shared<EpetraExt::LinearProblem_Reindex2>(nullptr);
+
+  if (solvertype_ == "umfpack")
+  {
+    solver_ = std::make_shared<Amesos_Umfpack>((*reindexer_)(*linear_problem_));
   }
+  else if (solvertype_ == "superlu")
+  {
+    solver_ = std::make_shared<Amesos_Superludist>((*reindexer_)(*linear_problem_));
+  }
+  else
+  {
+    solver_ = std::make_shared<Amesos_Klu>((*reindexer_)(*linear_problem_));
+  }
+
+  factored_ = false;
+  symbolic_factored_ = false;
 }
 
 //----------------------------------------------------------------------------------
@@ -104,7 +140,11 @@ int Core::LinearSolver::DirectSolver<MatrixType, VectorType>::solve()
 {
   if (not is_factored())
   {
-    solver_->SymbolicFactorization();
+    if (not symbolic_factored_)
+    {
+      solver_->SymbolicFactorization();
+      symbolic_factored_ = true;
+    }
     solver_->NumericFactorization();
     factored_ = true;
   }
@@ -13,6 +13,7 @@
 #include "4C_linear_solver_method.hpp"
 
 #include <Amesos_BaseSolver.h>
+#include <Epetra_CrsMatrix.h>
 #include <EpetraExt_Reindex_LinearProblem2.h>
 
 FOUR_C_NAMESPACE_OPEN
@@ -32,7 +33,8 @@ namespace Core::LinearSolver
      * @param A Matrix of the linear system
      * @param x Solution vector of the linear system
      * @param b Right-hand side vector of the linear system
-     * @param refactor Boolean flag to enforce a refactorization of the matrix
+     * @param refactor Boolean flag to enforce a refactorization of the matrix. If the sparsity
+     * pattern did not change since the last call, only the numeric factorization is redone.
      * @param reset Boolean flag to enforce a full reset of the solver object
      * @param projector Krylov projector
      */
@@ -52,6 +54,9 @@ namespace Core::LinearSolver
     //! flag indicating whether a valid factorization is stored
     bool factored_;
 
+    //! flag indicating whether the symbolic factorization of the current graph is stored
+    bool symbolic_factored_;
+
     //! a linear problem wrapper class used by Trilinos and for scaling of the system
     std::shared_ptr<Epetra_LinearProblem> linear_problem_;
 
@@ -61,8 +66,8 @@ namespace Core::LinearSolver
     //! right hand side vector
     std::shared_ptr<VectorType> b_;
 
-    //! system of equations
-    std::shared_ptr<MatrixType> a_;
+    //! system matrix of the current linear problem
+    std::shared_ptr<Epetra_CrsMatrix> a_;
 
     //! an abstract amesos solver that can be any of the amesos concrete implementations
     std::shared_ptr<Amesos_BaseSolver> solver_;
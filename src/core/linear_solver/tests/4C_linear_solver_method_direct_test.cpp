@@ -0,0 +1,144 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_linear_solver_method_direct.hpp"
+
+#include "4C_linalg_multi_vector.hpp"
+
+#include <Epetra_CrsMatrix.h>
+#include <Epetra_Map.h>
+#include <Epetra_MpiComm.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+namespace
+{
+  using namespace FourC;
+
+  using DirectSolver =
+      Core::LinearSolver::DirectSolver<Epetra_Operator, Core::LinAlg::MultiVector<double>>;
+
+  /*!
+   * A diagonally dominant band matrix on a distributed map. The direct solver reindexes and
+   * factorizes it, and it is solved for a right-hand side whose exact solution is known.
+   */
+  class DirectSolverTest : public ::testing::Test
+  {
+   protected:
+    //! band matrix with @p bandwidth off-diagonals on each side and @p diagonal on the diagonal
+    std::shared_ptr<Epetra_CrsMatrix> band_matrix(int bandwidth, double diagonal) const
+    {
+      auto A = std::make_shared<Epetra_CrsMatrix>(Copy, map_, 2 * bandwidth + 1);
+      for (int lrow = 0; lrow < map_.NumMyElements(); ++lrow)
+      {
+        const int row = map_.GID(lrow);
+        for (int col = std::max(0, row - bandwidth);
+             col <= std::min(num_rows_ - 1, row + bandwidth); ++col)
+        {
+          double value = col == row ? diagonal + 0.1 * row : -1.0 / (1 + std::abs(col - row));
+          A->InsertGlobalValues(row, 1, &value, &col);
+        }
+      }
+      A->FillComplete();
+      return A;
+    }
+
+    //! right-hand side A * x_exact
+    std::shared_ptr<Core::LinAlg::MultiVector<double>> rhs(const Epetra_CrsMatrix& A) const
+    {
+      auto b = std::make_shared<Core::LinAlg::MultiVector<double>>(map_, 1);
+      A.Multiply(false, *x_exact_.get_ptr_of_Epetra_MultiVector(),
+          *b->get_ptr_of_Epetra_MultiVector());
+      return b;
+    }
+
+    //! maximum deviation of @p x from the exact solution
+    double error(const Core::LinAlg::MultiVector<double>& x) const
+    {
+      const Epetra_MultiVector& x_epetra = *x.get_ptr_of_Epetra_MultiVector();
+      const Epetra_MultiVector& x_exact_epetra = *x_exact_.get_ptr_of_Epetra_MultiVector();
+
+      double my_error = 0.0;
+      for (int lrow = 0; lrow < map_.NumMyElements(); ++lrow)
+        my_error = std::max(my_error, std::abs(x_epetra[0][lrow] - x_exact_epetra[0][lrow]));
+      double error;
+      comm_.MaxAll(&my_error, &error, 1);
+      return error;
+    }
+
+    //! set up @p solver for @p A with a right-hand side from x_exact and solve
+    std::shared_ptr<Core::LinAlg::MultiVector<double>> solve(DirectSolver& solver,
+        const std::shared_ptr<Epetra_CrsMatrix>& A, const Epetra_CrsMatrix& A_rhs, bool refactor)
+    {
+      auto x = std::make_shared<Core::LinAlg::MultiVector<double>>(map_, 1);
+      solver.setup(A, x, rhs(A_rhs), refactor, false);
+      solver.solve();
+      return x;
+    }
+
+    Epetra_MpiComm comm_{MPI_COMM_WORLD};
+    const int num_rows_ = 20;
+    Epetra_Map map_{num_rows_, 0, comm_};
+    Core::LinAlg::MultiVector<double> x_exact_ = [this]()
+    {
+      Core::LinAlg::MultiVector<double> x(map_, 1);
+      for (int lrow = 0; lrow < map_.NumMyElements(); ++lrow)
+        (*x.get_ptr_of_Epetra_MultiVector())[0][lrow] = 1.0 + 0.5 * map_.GID(lrow);
+      return x;
+    }();
+  };
+
+  TEST_F(DirectSolverTest, SameGraphWithNewValues)
+  {
+    DirectSolver solver("klu");
+    EXPECT_LT(error(*solve(solver, band_matrix(1, 4.0), *band_matrix(1, 4.0), true)), 1e-10);
+    EXPECT_TRUE(solver.is_factored());
+
+    // a new matrix object with the same graph keeps the symbolic factorization, the numeric one
+    // is based on the new values
+    const std::shared_ptr<Epetra_CrsMatrix> A = band_matrix(1, 7.0);
+    EXPECT_LT(error(*solve(solver, A, *A, true)), 1e-10);
+
+    // values changed in place in the very same matrix object
+    A->Scale(2.0);
+    EXPECT_LT(error(*solve(solver, A, *A, true)), 1e-10);
+  }
+
+  TEST_F(DirectSolverTest, ChangedGraph)
+  {
+    DirectSolver solver("klu");
+    EXPECT_LT(error(*solve(solver, band_matrix(1, 4.0), *band_matrix(1, 4.0), true)), 1e-10);
+
+    // the wider band needs a new symbolic factorization
+    const std::shared_ptr<Epetra_CrsMatrix> A = band_matrix(2, 5.0);
+    EXPECT_LT(error(*solve(solver, A, *A, true)), 1e-10);
+
+    // and back to the original graph
+    const std::shared_ptr<Epetra_CrsMatrix> B = band_matrix(1, 3.0);
+    EXPECT_LT(error(*solve(solver, B, *B, true)), 1e-10);
+  }
+
+  TEST_F(DirectSolverTest, NoRefactorReusesFactorization)
+  {
+    DirectSolver solver("klu");
+    const std::shared_ptr<Epetra_CrsMatrix> A = band_matrix(1, 4.0);
+    EXPECT_LT(error(*solve(solver, A, *A, true)), 1e-10);
+
+    // without refactorization, the old factors are applied to the system of the new matrix, i.e.
+    // the right-hand side of the old matrix gives the exact solution again
+    const std::shared_ptr<Epetra_CrsMatrix> B = band_matrix(1, 9.0);
+    EXPECT_LT(error(*solve(solver, B, *A, false)), 1e-10);
+    EXPECT_GT(error(*solve(solver, B, *B, false)), 1e-2);
+
+    // the next refactorization uses the values of the new matrix
+    EXPECT_LT(error(*solve(solver, B, *B, true)), 1e-10);
+  }
+}  // namespace
@@ -416,6 +416,30 @@ double Core::Utils::SymbolicFunctionOfSpaceTime::evaluate(
   return expr_[component_mod]->value(variable_values);
 }
 
+void Core::Utils::SymbolicFunctionOfSpaceTime::evaluate_at_points(const double* x,
+    const std::size_t num_points, const double t, const std::size_t component,
+    double* values) const
+{
+  std::size_t component_mod = find_modified_component(component, expr_);
+
+  if (component_mod >= expr_.size())
+    FOUR_C_THROW(
+        "There are %d expressions but tried to access component %d", expr_.size(), component);
+
+  // the spatial variables change from point to point, all others are shared by all points
+  std::vector<double> variable_values(variables_.size());
+  std::vector<Core::Utils::SymbolicExpression<double>::BatchVariable> batch_variables = {
+      {"x", x, 3}, {"y", x + 1, 3}, {"z", x + 2, 3}, {"t", &t, 0}};
+  for (std::size_t i = 0; i < variables_.size(); ++i)
+  {
+    variable_values[i] = variables_[i]->value(t);
+    batch_variables.push_back({variables_[i]->name(), &variable_values[i], 0});
+  }
+
+  // evaluate F = F ( x, y, z, t, v1, ..., vn ) at all points
+  expr_[component_mod]->value(batch_variables, num_points, values);
+}
+
 std::vector<double> Core::Utils::SymbolicFunctionOfSpaceTime::evaluate_spatial_derivative(
     const double* x, const double t, const std::size_t component) const
 {
@@ -56,6 +56,25 @@ namespace Core::Utils
      */
     virtual double evaluate(const double* x, double t, std::size_t component) const = 0;
 
+    /*!
+     * @brief Evaluation of time and space dependent function at many points
+     *
+     * Evaluate the specified component of the function at @p num_points points in space at the
+     * same point in time. The default implementation calls evaluate() for every point.
+     *
+     * @param x  (i) Coordinates of all points, the three coordinates of point i start at x[3*i]
+     * @param num_points (i) Number of points
+     * @param t  (i) The point in time in which the function will be evaluated
+     * @param component (i) For vector-valued functions, index defines the function-component
+     *                      which should be evaluated
+     * @param values (o) Function values at all points
+     */
+    virtual void evaluate_at_points(const double* x, std::size_t num_points, double t,
+        std::size_t component, double* values) const
+    {
+      for (std::size_t i = 0; i < num_points; ++i) values[i] = evaluate(x + 3 * i, t, component);
+    }
+
     /*!
      * \brief Evaluation of first spatial derivative of time and space dependent function
      *
@@ -120,6 +139,9 @@ namespace Core::Utils
 
     double evaluate(const double* x, double t, std::size_t component) const override;
 
+    void evaluate_at_points(const double* x, std::size_t num_points, double t,
+        std::size_t component, double* values) const override;
+
     std::vector<double> evaluate_spatial_derivative(
         const double* x, double t, std::size_t component) const override;
 
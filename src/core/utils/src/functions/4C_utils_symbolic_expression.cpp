@@ -11,6 +11,8 @@
 
 #include <Sacado.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstring>
 #include <map>
@@ -18,6 +20,7 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -45,41 +48,13 @@ namespace Core::Utils::SymbolicExpressionDetails
   /*----------------------------------------------------------------------*/
   /*!
   \brief Syntax tree node holding binary, unary operator or literals
+
+  The syntax tree only exists while parsing. It is compiled into a CompiledExpression afterwards.
   */
-  template <class T>
   class SyntaxTreeNode
   {
    public:
-    using NodePtr = std::unique_ptr<SyntaxTreeNode<T>>;
-
-    //! destructor
-    ~SyntaxTreeNode() = default;
-
-    //! copy constructor
-    SyntaxTreeNode(const SyntaxTreeNode& other)
-        : type_{other.type_},
-          variable_{other.variable_},
-          function_{other.function_},
-          lhs_{std::make_unique<SyntaxTreeNode>(*other.lhs_)},
-          rhs_{std::make_unique<SyntaxTreeNode>(*other.rhs_)} {};
-
-    //! copy assignment operator
-    SyntaxTreeNode& operator=(const SyntaxTreeNode& other)
-    {
-      if (&other == this) return *this;
-      type_ = other.type_;
-      variable_ = other.variable_;
-      function_ = other.function_;
-      lhs_ = std::make_unique<SyntaxTreeNode>(*other.lhs_);
-      rhs_ = std::make_unique<SyntaxTreeNode>(*other.rhs_);
-      return *this;
-    };
-
-    //! move constructor
-    SyntaxTreeNode(SyntaxTreeNode&& other) noexcept = default;
-
-    //! move assignment operator
-    SyntaxTreeNode& operator=(SyntaxTreeNode&& other) noexcept = default;
+    using NodePtr = std::unique_ptr<SyntaxTreeNode>;
 
     enum NodeType
     {
@@ -115,6 +90,7 @@ namespace Core::Utils::SymbolicExpressionDetails
   };
 
 
+
   /*----------------------------------------------------------------------*/
   /*!
   \brief Class holds auxiliar variables for Lexan method which steps through
@@ -158,114 +134,128 @@ namespace Core::Utils::SymbolicExpressionDetails
     double real_;        // translated real number
   };
 
-  //! helper structs
-  template <typename T>
-  struct IsFAD : public std::false_type
+
+  //! operations of the stack machine that evaluates a compiled expression
+  enum class OpCode
   {
+    push_number,    // push numbers_[index]
+    push_variable,  // push the value of variable slot index
+    add,
+    subtract,
+    multiply,
+    divide,
+    power,
+    acos,
+    asin,
+    atan,
+    cos,
+    sin,
+    tan,
+    cosh,
+    sinh,
+    tanh,
+    exp,
+    log,
+    log10,
+    sqrt,
+    fabs,
+    heaviside,
+    atan2,
+    unknown_function  // function that is parsed but cannot be evaluated: unknown_functions_[index]
   };
 
-  template <typename T>
-  struct IsFAD<Sacado::Fad::DFad<T>> : public std::true_type
+  //! a single instruction of a compiled expression
+  struct Instruction
   {
+    OpCode op;
+    int index;
   };
 
 
   /*----------------------------------------------------------------------*/
   /*!
-  \brief Parser
+  \brief Symbolic expression compiled into postfix instructions of a stack machine
+
+  All variables and constants of the expression are bound to integer slots. The values of the slots
+  are passed to evaluate() in the order of variable_names().
   */
-  template <class T>
-  class Parser
+  class CompiledExpression
   {
    public:
-    using NodePtr = typename SyntaxTreeNode<T>::NodePtr;
+    //! Parse and compile the expression @p funct
+    explicit CompiledExpression(const std::string& funct);
 
-    //! constructor
-    Parser(std::string funct);
+    //! Evaluate the expression for the given @p slot_values using @p stack as workspace. The
+    //! returned result is stored in @p stack.
+    template <typename T>
+    const T& evaluate(const std::vector<T>& slot_values, std::vector<T>& stack) const;
 
-    //! destructor
-    ~Parser() = default;
+    //! names of all variables in slot order
+    [[nodiscard]] const std::vector<std::string>& variable_names() const { return variable_names_; }
 
-    //! copy constuctor
-    Parser(const Parser& other)
-        : symbolicexpression_{other.symbolicexpression_},
-          expr_{std::make_unique<SyntaxTreeNode<T>>(*other.expr_)},
-          parsed_variable_constant_names_{other.parsed_variable_constant_names_} {};
+    //! number of stack entries needed to evaluate the expression
+    [[nodiscard]] std::size_t max_stack_size() const { return max_stack_size_; }
 
-    //! copy assignment operator
-    Parser& operator=(const Parser& other)
-    {
-      if (&other == this) return *this;
-      symbolicexpression_ = other.symbolicexpression_;
-      expr_ = std::make_unique<NodePtr>(*other.expr_);
-      parsed_variable_constant_names_ = other.parsed_variable_constant_names_;
-      return *this;
-    };
-
-    //! move constructor
-    Parser(Parser&& other) noexcept = default;
-
-    //! move assignment operator
-    Parser& operator=(Parser&& other) noexcept = default;
-
-    /*!
-     * @brief evaluates the parsed expression for a given set of variables
-     *
-     * @param[in] variable_values A map containing all variables (variablename, value) necessary to
-     * evaluate the parsed expression
-     * @return Value of the parsed expression
-     */
-    T evaluate_expression(const std::map<std::string, T>& variable_values) const;
-
-    /*!
-     * @brief evaluates the derivative of the parsed expression with respect to a given set of
-     * variables
-     *
-     * @param[in] variable_values A map containing all variables (variablename, value) necessary to
-     * evaluate the parsed expression. Since the derivative of the parsed expression is evaluated,
-     * only  Sacado::Fad::DFad<T> types are allowed
-     * @param[in] constants A map containing all constants (constantname, value) necessary
-     * to evaluate the parsed expression
-     * @return  Derivative of the parsed expression with respect to the variables
-     */
-    template <typename T2, std::enable_if_t<IsFAD<T2>::value, void*> = nullptr>
-    T evaluate_derivative(const std::map<std::string, T2>& variable_values,
-        const std::map<std::string, double>& constants = {}) const;
-
-    //! Check if a variable with name 'varname' exists
-    [[nodiscard]] bool is_variable(const std::string& varname) const;
+    //! given symbolic expression
+    [[nodiscard]] const std::string& expression() const { return symbolicexpression_; }
 
    private:
-    NodePtr parse_primary(Lexer& lexer);
-    NodePtr parse_pow(Lexer& lexer);
-    NodePtr parse_term(Lexer& lexer);
-    NodePtr parse_expr(Lexer& lexer);
-    NodePtr parse(Lexer& lexer);
+    //! append the instructions of @p node and its children in postfix order
+    void compile(const SyntaxTreeNode& node, std::size_t& stack_size);
+
+    //! append an instruction and keep track of the required stack size
+    void emit(OpCode op, int index, int stack_change, std::size_t& stack_size);
 
     //! given symbolic expression
     std::string symbolicexpression_;
 
-    //! evaluates the parsed expression
-    T evaluate(const std::map<std::string, T>& variable_values,
-        const std::map<std::string, double>& constants = {}) const;
+    //! postfix instructions
+    std::vector<Instruction> instructions_;
+
+    //! literal numbers referenced by OpCode::push_number
+    std::vector<double> numbers_;
+
+    //! names of the variables referenced by OpCode::push_variable
+    std::vector<std::string> variable_names_;
 
-    //! recursively extract corresponding number out of a syntax tree node
-    T interpret(const SyntaxTreeNode<T>& node) const;
+    //! names of the functions referenced by OpCode::unknown_function
+    std::vector<std::string> unknown_functions_;
+
+    //! maximum number of stack entries during evaluation
+    std::size_t max_stack_size_{0};
+  };
 
-    //! syntax tree root
-    NodePtr expr_;
+
+  /*----------------------------------------------------------------------*/
+  /*!
+  \brief Parser that builds the syntax tree of a symbolic expression
+  */
+  class Parser
+  {
+   public:
+    using NodePtr = SyntaxTreeNode::NodePtr;
+
+    //! parse the expression held by @p lexer and return the root of the syntax tree
+    NodePtr parse(Lexer& lexer);
 
     //! set of all parsed variables
-    std::set<std::string> parsed_variable_constant_names_;
+    [[nodiscard]] const std::set<std::string>& parsed_variable_constant_names() const
+    {
+      return parsed_variable_constant_names_;
+    }
 
-    //! necessary variable values for evaluating the parsed expression
-    mutable const std::map<std::string, T>* variable_values_{nullptr};
+   private:
+    NodePtr parse_primary(Lexer& lexer);
+    NodePtr parse_pow(Lexer& lexer);
+    NodePtr parse_term(Lexer& lexer);
+    NodePtr parse_expr(Lexer& lexer);
 
-    //! necessary constant values for evaluating the parsed expression
-    mutable const std::map<std::string, double>* constant_values_{nullptr};
+    //! set of all parsed variables
+    std::set<std::string> parsed_variable_constant_names_;
   };
 
 
+
   /*======================================================================*/
   /* Lexer methods */
 
@@ -442,119 +432,16 @@ namespace Core::Utils::SymbolicExpressionDetails
     }
   }
 
-  /*===================================== da=================================*/
+  /*======================================================================*/
   /* Parser methods */
 
-  /*----------------------------------------------------------------------*/
-  /*!
-  \brief Constructor of parser object
-  */
-  template <class T>
-  Parser<T>::Parser(std::string funct)
-  {
-    //! set symbolic expression
-    symbolicexpression_ = funct;
-
-    //! create Lexer which stores all token of funct
-    Lexer lexer{std::move(funct)};
-
-    //! retrieve first token of funct
-    lexer.lexan();
-
-    //! create syntax tree equivalent to funct
-    expr_ = parse(lexer);
-  }
-
-  /*----------------------------------------------------------------------*/
-  /*!
-  \brief Check if input is a variable name
-  */
-  template <class T>
-  bool Parser<T>::is_variable(const std::string& varname) const
-  {
-    //! check if variable exists
-    return (parsed_variable_constant_names_.count(varname) != 0);
-  }
-
-
-  template <class T>
-  T Parser<T>::evaluate_expression(const std::map<std::string, T>& variable_values) const
-  {
-    return evaluate(variable_values);
-  }
-
-
-  template <class T>
-  template <typename T2, std::enable_if_t<IsFAD<T2>::value, void*>>
-  T Parser<T>::evaluate_derivative(const std::map<std::string, T2>& variable_values,
-      const std::map<std::string, double>& constants) const
-  {
-    return evaluate(variable_values, constants);
-  }
-
-
-  template <class T>
-  T Parser<T>::evaluate(const std::map<std::string, T>& variable_values,
-      const std::map<std::string, double>& constants) const
-  {
-#ifdef FOUR_C_ENABLE_ASSERTIONS
-    const bool all_required_variables_passed =
-        std::all_of(parsed_variable_constant_names_.begin(), parsed_variable_constant_names_.end(),
-            [&](const auto& var_name)
-            { return (variable_values.count(var_name) + constants.count(var_name)) == 1; });
-
-    if (!all_required_variables_passed)
-    {
-      std::string evaluate_variable_names =
-          std::accumulate(variable_values.begin(), variable_values.end(), std::string(),
-              [](const std::string& acc, const auto& v)
-              { return acc.empty() ? v.first : acc + ", " + v.first; });
-
-      std::string evaluate_constant_names =
-          std::accumulate(constants.begin(), constants.end(), std::string(),
-              [](const std::string& acc, const auto& v)
-              { return acc.empty() ? v.first : acc + ", " + v.first; });
-
-      FOUR_C_THROW(
-          "Some variables that this parser encountered in the expression are not passed to "
-          "the Evaluate function.\n\n"
-          "Expression:  %s \n"
-          "Variables passed to Evaluate: %s \n"
-          "Constants passed to Evaluate: %s",
-          symbolicexpression_.c_str(), evaluate_variable_names.c_str(),
-          evaluate_constant_names.c_str());
-    }
-#endif
-
-    //! safety check if variable_values_ and constant_values_ are nullptr
-    FOUR_C_ASSERT(variable_values_ == nullptr, "Internal error");
-    FOUR_C_ASSERT(constant_values_ == nullptr, "Internal error");
-
-    //! set variable values
-    variable_values_ = &variable_values;
-    //! set constant values if map of constants is not empty
-    if (constants.size() != 0) constant_values_ = &constants;
-
-    //! check if function has been parsed
-    FOUR_C_ASSERT(expr_ != nullptr, "Internal error");
-
-    //! evaluate syntax tree of function depending on set variables
-    auto result = this->interpret(*expr_);
-
-    //! set variable_values_ and constant_values_ as nullptr again for safety reasons
-    variable_values_ = nullptr;
-    constant_values_ = nullptr;
-
-    return result;
-  }
 
   /*----------------------------------------------------------------------*/
   /*!
   \brief Parse primary entities, i.e. literals and unary operators,
          such as numbers, parentheses, independent variables, operator names
   */
-  template <class T>
-  auto Parser<T>::parse_primary(Lexer& lexer) -> NodePtr
+  auto Parser::parse_primary(Lexer& lexer) -> NodePtr
   {
     NodePtr lhs = nullptr;
 
@@ -567,12 +454,12 @@ namespace Core::Utils::SymbolicExpressionDetails
         lexer.lexan();
         break;
       case Lexer::tok_int:
-        lhs = std::make_unique<SyntaxTreeNode<T>>(SyntaxTreeNode<T>::lt_number, nullptr, nullptr);
+        lhs = std::make_unique<SyntaxTreeNode>(SyntaxTreeNode::lt_number, nullptr, nullptr);
         lhs->v_.number = lexer.integer_;
         lexer.lexan();
         break;
       case Lexer::tok_real:
-        lhs = std::make_unique<SyntaxTreeNode<T>>(SyntaxTreeNode<T>::lt_number, nullptr, nullptr);
+        lhs = std::make_unique<SyntaxTreeNode>(SyntaxTreeNode::lt_number, nullptr, nullptr);
         lhs->v_.number = lexer.real_;
         lexer.lexan();
         break;
@@ -582,17 +469,17 @@ namespace Core::Utils::SymbolicExpressionDetails
         lexer.lexan();
         /*rhs = parse_primary();*/
         rhs = parse_pow(lexer);
-        if (rhs->type_ == SyntaxTreeNode<T>::lt_number)
+        if (rhs->type_ == SyntaxTreeNode::lt_number)
         {
           rhs->v_.number *= -1;
           lhs = std::move(rhs);
         }
         else
         {
-          lhs = std::make_unique<SyntaxTreeNode<T>>(SyntaxTreeNode<T>::lt_number, nullptr, nullptr);
+          lhs = std::make_unique<SyntaxTreeNode>(SyntaxTreeNode::lt_number, nullptr, nullptr);
           lhs->v_.number = -1;
-          lhs = std::make_unique<SyntaxTreeNode<T>>(
-              SyntaxTreeNode<T>::lt_operator, std::move(lhs), std::move(rhs));
+          lhs = std::make_unique<SyntaxTreeNode>(
+              SyntaxTreeNode::lt_operator, std::move(lhs), std::move(rhs));
           lhs->v_.op = '*';
         }
         break;
@@ -603,7 +490,7 @@ namespace Core::Utils::SymbolicExpressionDetails
         std::string name(lexer.str_, lexer.integer_);
         if ((lexer.integer_ == 2) && (std::strncmp("pi", lexer.str_, lexer.integer_) == 0))
         {
-          lhs = std::make_unique<SyntaxTreeNode<T>>(SyntaxTreeNode<T>::lt_number, nullptr, nullptr);
+          lhs = std::make_unique<SyntaxTreeNode>(SyntaxTreeNode::lt_number, nullptr, nullptr);
           lhs->v_.number = M_PI;
           lexer.lexan();
           break;
@@ -616,8 +503,8 @@ namespace Core::Utils::SymbolicExpressionDetails
               name == "sqrt" or name == "ceil" or name == "heaviside" or name == "fabs" or
               name == "floor")
           {
-            lhs = std::make_unique<SyntaxTreeNode<T>>(
-                SyntaxTreeNode<T>::lt_function, nullptr, nullptr);
+            lhs = std::make_unique<SyntaxTreeNode>(
+                SyntaxTreeNode::lt_function, nullptr, nullptr);
             lhs->function_ = name;
             lexer.lexan();
             if (lexer.tok_ != Lexer::tok_lpar)
@@ -630,8 +517,8 @@ namespace Core::Utils::SymbolicExpressionDetails
           }
           else if (name == "atan2")
           {
-            lhs = std::make_unique<SyntaxTreeNode<T>>(
-                SyntaxTreeNode<T>::lt_function, nullptr, nullptr);
+            lhs = std::make_unique<SyntaxTreeNode>(
+                SyntaxTreeNode::lt_function, nullptr, nullptr);
             lhs->function_ = name;
             lexer.lexan();
             if (lexer.tok_ != Lexer::tok_lpar)
@@ -648,8 +535,8 @@ namespace Core::Utils::SymbolicExpressionDetails
           }
           else
           {
-            lhs = std::make_unique<SyntaxTreeNode<T>>(
-                SyntaxTreeNode<T>::lt_variable, nullptr, nullptr);
+            lhs = std::make_unique<SyntaxTreeNode>(
+                SyntaxTreeNode::lt_variable, nullptr, nullptr);
             lhs->variable_ = name;
             parsed_variable_constant_names_.insert(name);
             lexer.lexan();
@@ -670,8 +557,7 @@ namespace Core::Utils::SymbolicExpressionDetails
   /*!
   \brief Parse entities connected by power: a^b
   */
-  template <class T>
-  auto Parser<T>::parse_pow(Lexer& lexer) -> NodePtr
+  auto Parser::parse_pow(Lexer& lexer) -> NodePtr
   {
     NodePtr lhs;
     NodePtr rhs;
@@ -683,8 +569,8 @@ namespace Core::Utils::SymbolicExpressionDetails
       {
         lexer.lexan();
         rhs = parse_primary(lexer);
-        lhs = std::make_unique<SyntaxTreeNode<T>>(
-            SyntaxTreeNode<T>::lt_operator, std::move(lhs), std::move(rhs));
+        lhs = std::make_unique<SyntaxTreeNode>(
+            SyntaxTreeNode::lt_operator, std::move(lhs), std::move(rhs));
         lhs->v_.op = '^';
       }
       else
@@ -701,8 +587,7 @@ namespace Core::Utils::SymbolicExpressionDetails
   /*!
   \brief Parse entities connected by multiplication or division: a*b, a/b
   */
-  template <class T>
-  auto Parser<T>::parse_term(Lexer& lexer) -> NodePtr
+  auto Parser::parse_term(Lexer& lexer) -> NodePtr
   {
     NodePtr lhs;
     NodePtr rhs;
@@ -714,16 +599,16 @@ namespace Core::Utils::SymbolicExpressionDetails
       {
         lexer.lexan();
         rhs = parse_pow(lexer);
-        lhs = std::make_unique<SyntaxTreeNode<T>>(
-            SyntaxTreeNode<T>::lt_operator, std::move(lhs), std::move(rhs));
+        lhs = std::make_unique<SyntaxTreeNode>(
+            SyntaxTreeNode::lt_operator, std::move(lhs), std::move(rhs));
         lhs->v_.op = '*';
       }
       else if (lexer.tok_ == Lexer::tok_div)
       {
         lexer.lexan();
         rhs = parse_pow(lexer);
-        lhs = std::make_unique<SyntaxTreeNode<T>>(
-            SyntaxTreeNode<T>::lt_operator, std::move(lhs), std::move(rhs));
+        lhs = std::make_unique<SyntaxTreeNode>(
+            SyntaxTreeNode::lt_operator, std::move(lhs), std::move(rhs));
         lhs->v_.op = '/';
       }
       else
@@ -739,8 +624,7 @@ namespace Core::Utils::SymbolicExpressionDetails
   /*!
   \brief Parse entity
   */
-  template <class T>
-  auto Parser<T>::parse(Lexer& lexer) -> NodePtr
+  auto Parser::parse(Lexer& lexer) -> NodePtr
   {
     NodePtr lhs;
 
@@ -760,11 +644,10 @@ namespace Core::Utils::SymbolicExpressionDetails
   /*!
   \brief Parse entities connected by addition or subtraction: a+b, a-b
   */
-  template <class T>
-  auto Parser<T>::parse_expr(Lexer& lexer) -> NodePtr
+  auto Parser::parse_expr(Lexer& lexer) -> NodePtr
   {
-    typename SyntaxTreeNode<T>::NodePtr lhs;
-    typename SyntaxTreeNode<T>::NodePtr rhs;
+    NodePtr lhs;
+    NodePtr rhs;
 
     lhs = parse_term(lexer);
     for (;;)
@@ -773,16 +656,16 @@ namespace Core::Utils::SymbolicExpressionDetails
       {
         lexer.lexan();
         rhs = parse_term(lexer);
-        lhs = std::make_unique<SyntaxTreeNode<T>>(
-            SyntaxTreeNode<T>::lt_operator, std::move(lhs), std::move(rhs));
+        lhs = std::make_unique<SyntaxTreeNode>(
+            SyntaxTreeNode::lt_operator, std::move(lhs), std::move(rhs));
         lhs->v_.op = '+';
       }
       else if (lexer.tok_ == Lexer::tok_sub)
       {
         lexer.lexan();
         rhs = parse_term(lexer);
-        lhs = std::make_unique<SyntaxTreeNode<T>>(
-            SyntaxTreeNode<T>::lt_operator, std::move(lhs), std::move(rhs));
+        lhs = std::make_unique<SyntaxTreeNode>(
+            SyntaxTreeNode::lt_operator, std::move(lhs), std::move(rhs));
         lhs->v_.op = '-';
       }
       else
@@ -795,174 +678,347 @@ namespace Core::Utils::SymbolicExpressionDetails
   }
 
 
+
+  /*======================================================================*/
+  /* CompiledExpression methods */
+
   /*----------------------------------------------------------------------*/
   /*!
-  \brief Recursively extract corresponding number out of a syntax tree node
+  \brief Parse the expression and compile the syntax tree into postfix instructions
   */
-  template <class T>
-  T Parser<T>::interpret(const SyntaxTreeNode<T>& node) const
+  CompiledExpression::CompiledExpression(const std::string& funct) : symbolicexpression_(funct)
   {
-    T res = 0;  // the result
+    //! create Lexer which stores all token of funct
+    Lexer lexer{funct};
+
+    //! retrieve first token of funct
+    lexer.lexan();
+
+    //! create syntax tree equivalent to funct
+    Parser parser;
+    const auto expr = parser.parse(lexer);
+
+    //! bind every variable to a slot
+    const auto& names = parser.parsed_variable_constant_names();
+    variable_names_.assign(names.begin(), names.end());
 
+    //! flatten the syntax tree
+    std::size_t stack_size = 0;
+    compile(*expr, stack_size);
+    FOUR_C_ASSERT(stack_size == 1, "Internal error");
+  }
+
+  /*----------------------------------------------------------------------*/
+  /*!
+  \brief Append an instruction and track the required stack size
+  */
+  void CompiledExpression::emit(OpCode op, int index, int stack_change, std::size_t& stack_size)
+  {
+    instructions_.push_back({op, index});
+    stack_size += stack_change;
+    max_stack_size_ = std::max(max_stack_size_, stack_size);
+  }
+
+  /*----------------------------------------------------------------------*/
+  /*!
+  \brief Recursively append the instructions of a syntax tree node in postfix order
+  */
+  void CompiledExpression::compile(const SyntaxTreeNode& node, std::size_t& stack_size)
+  {
     switch (node.type_)
     {
       // literal numbers: leaf of syntax tree node
-      case SyntaxTreeNode<T>::lt_number:
-        res = node.v_.number;
+      case SyntaxTreeNode::lt_number:
+      {
+        numbers_.push_back(node.v_.number);
+        emit(OpCode::push_number, static_cast<int>(numbers_.size()) - 1, 1, stack_size);
+        break;
+      }
+      // independent variables: bound to their slot
+      case SyntaxTreeNode::lt_variable:
+      {
+        const auto slot =
+            std::lower_bound(variable_names_.begin(), variable_names_.end(), node.variable_);
+        if (slot == variable_names_.end() or *slot != node.variable_)
+          FOUR_C_THROW("unknown variable '%s'", node.variable_.c_str());
+        emit(OpCode::push_variable, static_cast<int>(slot - variable_names_.begin()), 1,
+            stack_size);
         break;
+      }
       // binary operators: bifurcating branch of syntax tree node
-      case SyntaxTreeNode<T>::lt_operator:
+      case SyntaxTreeNode::lt_operator:
       {
-        T lhs;
-        T rhs;
-
-        // recursively visit branches and obtain sub-results
-        lhs = interpret(*node.lhs_);
-        rhs = interpret(*node.rhs_);
+        compile(*node.lhs_, stack_size);
+        compile(*node.rhs_, stack_size);
 
-        // evaluate the node operator
+        OpCode op;
         switch (node.v_.op)
         {
           case '+':
-            res = lhs + rhs;
+            op = OpCode::add;
             break;
           case '-':
-            res = lhs - rhs;
+            op = OpCode::subtract;
             break;
           case '*':
-            res = lhs * rhs;
+            op = OpCode::multiply;
             break;
           case '/':
-            /* check for rhs==0.0? */
-            res = lhs / rhs;
+            op = OpCode::divide;
             break;
           case '^':
-            res = std::pow(lhs, rhs);
+            op = OpCode::power;
             break;
           default:
             FOUR_C_THROW("unsupported operator '%c'", node.v_.op);
         }
+        emit(op, 0, -1, stack_size);
         break;
       }
-      // independent variables: as set by user
-      case SyntaxTreeNode<T>::lt_variable:
+      // functions
+      case SyntaxTreeNode::lt_function:
       {
-        if (parsed_variable_constant_names_.count(node.variable_) != 0)
+        compile(*node.lhs_, stack_size);
+
+        if (node.function_ == "atan2")
         {
-          if (constant_values_ == nullptr)
-          {
-            if (variable_values_->find(node.variable_) == variable_values_->end())
-            {
-              FOUR_C_THROW("variable or constant '%s' not given as input in evaluate()",
-                  node.variable_.c_str());
-            }
-            else
-            {
-              res = variable_values_->at(std::string(node.variable_));
-            }
-          }
-          else
-          {
-            if ((variable_values_->find(node.variable_) == variable_values_->end()) &&
-                (constant_values_->find(node.variable_) == constant_values_->end()))
-            {
-              FOUR_C_THROW("variable or constant '%s' not given as input in EvaluateDeriv()",
-                  node.variable_.c_str());
-            }
-            else
-            {
-              if (variable_values_->find(node.variable_) != variable_values_->end())
-              {
-                res = variable_values_->at(node.variable_);
-              }
-              else if (constant_values_->find(node.variable_) != constant_values_->end())
-              {
-                res = constant_values_->at(node.variable_);
-              }
-              else
-                FOUR_C_THROW("Something went really wrong!");
-            }
-          }
+          compile(*node.rhs_, stack_size);
+          emit(OpCode::atan2, 0, -1, stack_size);
+          break;
         }
-        else
-          FOUR_C_THROW("unknown variable '%s'", node.variable_.c_str());
-        break;
-      }
-      // unary operators
-      case SyntaxTreeNode<T>::lt_function:
-      {
-        T arg;
-        arg = interpret(*node.lhs_);
-        if (node.function_ == "acos")
-          res = acos(arg);
-        else if (node.function_ == "asin")
-          res = asin(arg);
-        else if (node.function_ == "atan")
-          res = atan(arg);
-        else if (node.function_ == "cos")
-          res = cos(arg);
-        else if (node.function_ == "sin")
-          res = sin(arg);
-        else if (node.function_ == "tan")
-          res = tan(arg);
-        else if (node.function_ == "cosh")
-          res = cosh(arg);
-        else if (node.function_ == "sinh")
-          res = sinh(arg);
-        else if (node.function_ == "tanh")
-          res = tanh(arg);
-        else if (node.function_ == "exp")
-          res = exp(arg);
-        else if (node.function_ == "log")
-          res = log(arg);
-        else if (node.function_ == "log10")
-          res = log10(arg);
-        else if (node.function_ == "sqrt")
-          res = sqrt(arg);
-        else if (node.function_ == "atan2")
+
+        static const std::map<std::string, OpCode> unary_functions = {{"acos", OpCode::acos},
+            {"asin", OpCode::asin}, {"atan", OpCode::atan}, {"cos", OpCode::cos},
+            {"sin", OpCode::sin}, {"tan", OpCode::tan}, {"cosh", OpCode::cosh},
+            {"sinh", OpCode::sinh}, {"tanh", OpCode::tanh}, {"exp", OpCode::exp},
+            {"log", OpCode::log}, {"log10", OpCode::log10}, {"sqrt", OpCode::sqrt},
+            {"fabs", OpCode::fabs}, {"heaviside", OpCode::heaviside}};
+
+        if (const auto function = unary_functions.find(node.function_);
+            function != unary_functions.end())
         {
-          T arg2;
-          // recursively visit branches and obtain sub-results
-          arg2 = interpret(*node.rhs_);
-          res = atan2(arg, arg2);
+          emit(function->second, 0, 0, stack_size);
         }
-        else if (node.function_ == "fabs")
-          res = fabs(arg);
-        else if (node.function_ == "heaviside")
+        else
         {
-          if (arg > 0)
-          {
-            res = 1.0;
-          }
-          else
-          {
-            res = 0.0;
-          }
+          // the parser accepts a few functions that cannot be evaluated. Keep the error at
+          // evaluation time.
+          unknown_functions_.push_back(node.function_);
+          emit(OpCode::unknown_function, static_cast<int>(unknown_functions_.size()) - 1, 0,
+              stack_size);
         }
-        else
-          FOUR_C_THROW("unknown function_ '%s'", node.function_.c_str());
         break;
       }
       default:
         FOUR_C_THROW("unknown syntax tree node type");
         break;
     }
+  }
+
+  /*----------------------------------------------------------------------*/
+  /*!
+  \brief Execute the instructions. The result is the only entry left on the stack.
+  */
+  template <typename T>
+  const T& CompiledExpression::evaluate(
+      const std::vector<T>& slot_values, std::vector<T>& stack) const
+  {
+    FOUR_C_ASSERT(slot_values.size() == variable_names_.size(), "Internal error");
+    if (stack.size() < max_stack_size_) stack.resize(max_stack_size_);
+
+    // index of the next free stack entry
+    std::size_t top = 0;
+
+    for (const auto& [op, index] : instructions_)
+    {
+      switch (op)
+      {
+        case OpCode::push_number:
+          stack[top++] = numbers_[index];
+          break;
+        case OpCode::push_variable:
+          stack[top++] = slot_values[index];
+          break;
+        case OpCode::add:
+          stack[top - 2] += stack[top - 1];
+          --top;
+          break;
+        case OpCode::subtract:
+          stack[top - 2] -= stack[top - 1];
+          --top;
+          break;
+        case OpCode::multiply:
+          stack[top - 2] *= stack[top - 1];
+          --top;
+          break;
+        case OpCode::divide:
+          stack[top - 2] /= stack[top - 1];
+          --top;
+          break;
+        case OpCode::power:
+        {
+          T res = std::pow(stack[top - 2], stack[top - 1]);
+          stack[top - 2] = res;
+          --top;
+          break;
+        }
+        case OpCode::atan2:
+        {
+          T res = atan2(stack[top - 2], stack[top - 1]);
+          stack[top - 2] = res;
+          --top;
+          break;
+        }
+        case OpCode::acos:
+          stack[top - 1] = acos(stack[top - 1]);
+          break;
+        case OpCode::asin:
+          stack[top - 1] = asin(stack[top - 1]);
+          break;
+        case OpCode::atan:
+          stack[top - 1] = atan(stack[top - 1]);
+          break;
+        case OpCode::cos:
+          stack[top - 1] = cos(stack[top - 1]);
+          break;
+        case OpCode::sin:
+          stack[top - 1] = sin(stack[top - 1]);
+          break;
+        case OpCode::tan:
+          stack[top - 1] = tan(stack[top - 1]);
+          break;
+        case OpCode::cosh:
+          stack[top - 1] = cosh(stack[top - 1]);
+          break;
+        case OpCode::sinh:
+          stack[top - 1] = sinh(stack[top - 1]);
+          break;
+        case OpCode::tanh:
+          stack[top - 1] = tanh(stack[top - 1]);
+          break;
+        case OpCode::exp:
+          stack[top - 1] = exp(stack[top - 1]);
+          break;
+        case OpCode::log:
+          stack[top - 1] = log(stack[top - 1]);
+          break;
+        case OpCode::log10:
+          stack[top - 1] = log10(stack[top - 1]);
+          break;
+        case OpCode::sqrt:
+          stack[top - 1] = sqrt(stack[top - 1]);
+          break;
+        case OpCode::fabs:
+          stack[top - 1] = fabs(stack[top - 1]);
+          break;
+        case OpCode::heaviside:
+          if (stack[top - 1] > 0)
+            stack[top - 1] = 1.0;
+          else
+            stack[top - 1] = 0.0;
+          break;
+        case OpCode::unknown_function:
+          FOUR_C_THROW("unknown function_ '%s'", unknown_functions_[index].c_str());
+          break;
+      }
+    }
 
-    return res;
+    FOUR_C_ASSERT(top == 1, "Internal error");
+    return stack[0];
   }
 
 }  // namespace Core::Utils::SymbolicExpressionDetails
 
+namespace
+{
+  using Core::Utils::SymbolicExpressionDetails::CompiledExpression;
+
+  //! throw an error listing all passed names if a variable of @p expression is not passed exactly
+  //! once
+  template <typename T>
+  void assert_all_variables_passed(const CompiledExpression& expression,
+      const std::map<std::string, T>& variable_values,
+      const std::map<std::string, double>& constants)
+  {
+#ifdef FOUR_C_ENABLE_ASSERTIONS
+    const auto& names = expression.variable_names();
+    const bool all_required_variables_passed =
+        std::all_of(names.begin(), names.end(),
+            [&](const auto& var_name)
+            { return (variable_values.count(var_name) + constants.count(var_name)) == 1; });
+
+    if (!all_required_variables_passed)
+    {
+      std::string evaluate_variable_names =
+          std::accumulate(variable_values.begin(), variable_values.end(), std::string(),
+              [](const std::string& acc, const auto& v)
+              { return acc.empty() ? v.first : acc + ", " + v.first; });
+
+      std::string evaluate_constant_names =
+          std::accumulate(constants.begin(), constants.end(), std::string(),
+              [](const std::string& acc, const auto& v)
+              { return acc.empty() ? v.first : acc + ", " + v.first; });
+
+      FOUR_C_THROW(
+          "Some variables that this parser encountered in the expression are not passed to "
+          "the Evaluate function.\n\n"
+          "Expression:  %s \n"
+          "Variables passed to Evaluate: %s \n"
+          "Constants passed to Evaluate: %s",
+          expression.expression().c_str(), evaluate_variable_names.c_str(),
+          evaluate_constant_names.c_str());
+    }
+#endif
+  }
+
+  //! gather the values of all variable slots of @p expression from @p variable_values and
+  //! @p constants into @p slot_values
+  template <typename T>
+  void gather_slot_values(const CompiledExpression& expression,
+      const std::map<std::string, T>& variable_values,
+      const std::map<std::string, double>& constants, std::vector<T>& slot_values)
+  {
+    assert_all_variables_passed(expression, variable_values, constants);
+
+    const auto& names = expression.variable_names();
+    slot_values.resize(names.size());
+    for (std::size_t slot = 0; slot < names.size(); ++slot)
+    {
+      if (const auto variable = variable_values.find(names[slot]);
+          variable != variable_values.end())
+        slot_values[slot] = variable->second;
+      else if (const auto constant = constants.find(names[slot]); constant != constants.end())
+        slot_values[slot] = constant->second;
+      else
+        FOUR_C_THROW(
+            "variable or constant '%s' not given as input in evaluate()", names[slot].c_str());
+    }
+  }
+
+  //! find the batch variable for every variable slot of @p expression
+  template <typename BatchVariable>
+  std::vector<const BatchVariable*> find_batch_variables(
+      const CompiledExpression& expression, const std::vector<BatchVariable>& variables)
+  {
+    const auto& names = expression.variable_names();
+    std::vector<const BatchVariable*> slot_variables(names.size());
+    for (std::size_t slot = 0; slot < names.size(); ++slot)
+    {
+      const auto variable = std::find_if(variables.begin(), variables.end(),
+          [&](const BatchVariable& v) { return v.name == names[slot]; });
+      if (variable == variables.end())
+        FOUR_C_THROW(
+            "variable or constant '%s' not given as input in evaluate()", names[slot].c_str());
+      slot_variables[slot] = &*variable;
+    }
+    return slot_variables;
+  }
+}  // namespace
+
 template <typename T>
 Core::Utils::SymbolicExpression<T>::SymbolicExpression(const std::string& expression)
-    : parser_for_value_(
-          std::make_unique<Core::Utils::SymbolicExpressionDetails::Parser<ValueType>>(expression)),
-      parser_for_firstderivative_(
-          std::make_unique<Core::Utils::SymbolicExpressionDetails::Parser<FirstDerivativeType>>(
-              expression)),
-      parser_for_secondderivative_(
-          std::make_unique<Core::Utils::SymbolicExpressionDetails::Parser<SecondDerivativeType>>(
-              expression))
+    : expression_(
+          std::make_shared<Core::Utils::SymbolicExpressionDetails::CompiledExpression>(expression))
 {
 }
 
@@ -972,7 +1028,14 @@ template <typename T>
 auto Core::Utils::SymbolicExpression<T>::value(
     const std::map<std::string, ValueType>& variable_values) const -> ValueType
 {
-  return parser_for_value_->evaluate_expression(variable_values);
+  // Scratch space reused by all calls of this thread. Copies of an expression share the compiled
+  // expression and may be evaluated concurrently, so the scratch space cannot be a member.
+  thread_local std::vector<ValueType> slot_values;
+  thread_local std::vector<ValueType> stack;
+  if (stack.size() < expression_->max_stack_size()) stack.resize(expression_->max_stack_size());
+
+  gather_slot_values(*expression_, variable_values, {}, slot_values);
+  return expression_->evaluate(slot_values, stack);
 }
 
 
@@ -981,7 +1044,10 @@ auto Core::Utils::SymbolicExpression<T>::first_derivative(
     std::map<std::string, FirstDerivativeType> variable_values,
     const std::map<std::string, ValueType>& constant_values) const -> FirstDerivativeType
 {
-  return parser_for_firstderivative_->evaluate_derivative(variable_values, constant_values);
+  std::vector<FirstDerivativeType> slot_values;
+  gather_slot_values(*expression_, variable_values, constant_values, slot_values);
+  std::vector<FirstDerivativeType> stack;
+  return expression_->evaluate(slot_values, stack);
 }
 
 
@@ -990,41 +1056,90 @@ auto Core::Utils::SymbolicExpression<T>::second_derivative(
     const std::map<std::string, SecondDerivativeType>& variable_values,
     const std::map<std::string, ValueType>& constant_values) const -> SecondDerivativeType
 {
-  return parser_for_secondderivative_->evaluate_derivative(variable_values, constant_values);
+  std::vector<SecondDerivativeType> slot_values;
+  gather_slot_values(*expression_, variable_values, constant_values, slot_values);
+  std::vector<SecondDerivativeType> stack;
+  return expression_->evaluate(slot_values, stack);
 }
 
 
-template <typename Number>
-Core::Utils::SymbolicExpression<Number>::SymbolicExpression(
-    const Core::Utils::SymbolicExpression<Number>& other)
-    : parser_for_value_{std::make_unique<Core::Utils::SymbolicExpressionDetails::Parser<ValueType>>(
-          *other.parser_for_value_)},
-      parser_for_firstderivative_{
-          std::make_unique<Core::Utils::SymbolicExpressionDetails::Parser<FirstDerivativeType>>(
-              *other.parser_for_firstderivative_)},
-      parser_for_secondderivative_{
-          std::make_unique<Core::Utils::SymbolicExpressionDetails::Parser<SecondDerivativeType>>(
-              *other.parser_for_secondderivative_)}
+template <typename T>
+void Core::Utils::SymbolicExpression<T>::value(
+    const std::vector<BatchVariable>& variables, std::size_t num_points, ValueType* values) const
 {
+  const auto slot_variables = find_batch_variables(*expression_, variables);
+
+  std::vector<ValueType> slot_values(slot_variables.size());
+  std::vector<ValueType> stack(expression_->max_stack_size());
+
+  for (std::size_t point = 0; point < num_points; ++point)
+  {
+    for (std::size_t slot = 0; slot < slot_variables.size(); ++slot)
+      slot_values[slot] = slot_variables[slot]->values[point * slot_variables[slot]->stride];
+
+    values[point] = expression_->evaluate(slot_values, stack);
+  }
 }
 
 
-template <typename Number>
-Core::Utils::SymbolicExpression<Number>& Core::Utils::SymbolicExpression<Number>::operator=(
-    const Core::Utils::SymbolicExpression<Number>& other)
+template <typename T>
+void Core::Utils::SymbolicExpression<T>::value_and_first_derivative(
+    const std::vector<BatchVariable>& variables,
+    const std::vector<std::string>& derivative_variables, std::size_t num_points,
+    ValueType* values, ValueType* derivatives) const
 {
-  parser_for_value_ = std::make_unique<Core::Utils::SymbolicExpressionDetails::Parser<ValueType>>(
-      *other.parser_for_value_);
-  parser_for_firstderivative_ =
-      std::make_unique<Core::Utils::SymbolicExpressionDetails::Parser<FirstDerivativeType>>(
-          *other.parser_for_firstderivative_);
-  parser_for_secondderivative_ =
-      std::make_unique<Core::Utils::SymbolicExpressionDetails::Parser<SecondDerivativeType>>(
-          *other.parser_for_secondderivative_);
-  return *this;
+  const auto slot_variables = find_batch_variables(*expression_, variables);
+  const auto& names = expression_->variable_names();
+  const std::size_t num_derivatives = derivative_variables.size();
+
+  // seed the derivative directions once. Only the values change from point to point.
+  std::vector<FirstDerivativeType> slot_values(slot_variables.size());
+  for (std::size_t slot = 0; slot < slot_variables.size(); ++slot)
+  {
+    const auto direction =
+        std::find(derivative_variables.begin(), derivative_variables.end(), names[slot]);
+    if (direction != derivative_variables.end())
+    {
+      slot_values[slot] = FirstDerivativeType(static_cast<int>(num_derivatives),
+          static_cast<int>(direction - derivative_variables.begin()), 0.0);
+    }
+  }
+  std::vector<FirstDerivativeType> stack(expression_->max_stack_size());
+
+  for (std::size_t point = 0; point < num_points; ++point)
+  {
+    for (std::size_t slot = 0; slot < slot_variables.size(); ++slot)
+      slot_values[slot].val() = slot_variables[slot]->values[point * slot_variables[slot]->stride];
+
+    const auto& result = expression_->evaluate(slot_values, stack);
+
+    values[point] = result.val();
+    for (std::size_t i = 0; i < num_derivatives; ++i)
+    {
+      derivatives[point * num_derivatives + i] =
+          (result.size() == 0) ? 0.0 : result.dx(static_cast<int>(i));
+    }
+  }
+}
+
+
+template <typename T>
+auto Core::Utils::SymbolicExpression<T>::variable_names() const -> const std::vector<std::string>&
+{
+  return expression_->variable_names();
 }
 
 
+template <typename Number>
+Core::Utils::SymbolicExpression<Number>::SymbolicExpression(
+    const Core::Utils::SymbolicExpression<Number>& other) = default;
+
+
+template <typename Number>
+Core::Utils::SymbolicExpression<Number>& Core::Utils::SymbolicExpression<Number>::operator=(
+    const Core::Utils::SymbolicExpression<Number>& other) = default;
+
+
 
 template <typename Number>
 Core::Utils::SymbolicExpression<Number>::~SymbolicExpression() = default;
@@ -14,10 +14,12 @@
 
 #include <Sacado.hpp>
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <numeric>
 #include <string>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -27,8 +29,7 @@ namespace Core::Utils
   // forward declaration
   namespace SymbolicExpressionDetails
   {
-    template <typename Number>
-    class Parser;
+    class CompiledExpression;
   }
 
 
@@ -44,9 +45,16 @@ namespace Core::Utils
    * or supported function is parsed as a variable. When calling Value(), FirstDerivative() or
    * SecondDerivative(), the variables that have been parsed need to be supplied with a value.
    *
+   * The expression is parsed once on construction and compiled into a flat sequence of
+   * instructions for a stack machine. Every variable is bound to an integer slot, such that an
+   * evaluation only resolves variable names once per call instead of once per occurrence. Large
+   * numbers of evaluations, e.g. at all nodes of a discretization, should use the batch versions of
+   * value() and value_and_first_derivative() which resolve the names once for all points.
+   *
    * \note If you want to evaluate the same expression more than once, it is better to reuse that
    * object of the SymbolicExpression instead of creating a new object of that class with the same
-   * expression so that the expression only needs to be parsed once.
+   * expression so that the expression only needs to be parsed once. Copies of a SymbolicExpression
+   * share the compiled expression.
    *
    * @tparam Number: Only an arithmetic type is allowed for template parameter. So far only double
    * is supported.
@@ -65,6 +73,19 @@ namespace Core::Utils
     //! Type returned by the SecondDerivative() function
     using SecondDerivativeType = Sacado::Fad::DFad<Sacado::Fad::DFad<Number>>;
 
+    /*!
+     * @brief Values of one variable at all points of a batch evaluation
+     *
+     * The value of variable @p name at point i is located at @p values[i * @p stride]. A stride of
+     * zero passes the same value for all points, e.g. the time.
+     */
+    struct BatchVariable
+    {
+      std::string name;
+      const ValueType* values;
+      std::size_t stride = 1;
+    };
+
     //! Construct a SymbolicExpression from the given @p expression string. The expression must only
     //! contain supported functions, literals and operators, as well as arbitrary number of
     //! variables. See the class documentation for more details.
@@ -132,17 +153,43 @@ namespace Core::Utils
         const std::map<std::string, SecondDerivativeType>& variable_values,
         const std::map<std::string, ValueType>& constant_values) const;
 
-   private:
-    //! Parser for the symbolic expression evaluation
-    std::unique_ptr<Core::Utils::SymbolicExpressionDetails::Parser<ValueType>> parser_for_value_;
+    /*!
+     * @brief evaluates the parsed expression at @p num_points points
+     *
+     * @param[in] variables Values of all variables at all points. Variables that do not appear in
+     * the expression are ignored. If a parsed variable is not specified, an error is thrown naming
+     * the missing variable.
+     * @param[in] num_points Number of points
+     * @param[out] values Array of size @p num_points holding the value at each point
+     */
+    void value(const std::vector<BatchVariable>& variables, std::size_t num_points,
+        ValueType* values) const;
 
-    //! Parser for the symbolic expression first derivative evaluation
-    std::unique_ptr<Core::Utils::SymbolicExpressionDetails::Parser<FirstDerivativeType>>
-        parser_for_firstderivative_;
+    /*!
+     * @brief evaluates the parsed expression and its first derivative at @p num_points points
+     *
+     * The derivatives are formed with respect to the variables named in @p derivative_variables.
+     * All other variables are treated as constants.
+     *
+     * @param[in] variables Values of all variables at all points. If a parsed variable is not
+     * specified, an error is thrown naming the missing variable.
+     * @param[in] derivative_variables Names of the variables to differentiate with respect to
+     * @param[in] num_points Number of points
+     * @param[out] values Array of size @p num_points holding the value at each point
+     * @param[out] derivatives Array of size @p num_points * @p derivative_variables.size(). The
+     * derivative with respect to variable j at point i is stored at index
+     * i * derivative_variables.size() + j.
+     */
+    void value_and_first_derivative(const std::vector<BatchVariable>& variables,
+        const std::vector<std::string>& derivative_variables, std::size_t num_points,
+        ValueType* values, ValueType* derivatives) const;
+
+    //! Names of all variables and constants that appear in the expression (sorted)
+    [[nodiscard]] const std::vector<std::string>& variable_names() const;
 
-    //! Parser for the symbolic expression second derivative evaluation
-    std::unique_ptr<Core::Utils::SymbolicExpressionDetails::Parser<SecondDerivativeType>>
-        parser_for_secondderivative_;
+   private:
+    //! Compiled expression shared by all copies of this object
+    std::shared_ptr<const Core::Utils::SymbolicExpressionDetails::CompiledExpression> expression_;
   };
 
 }  // namespace Core::Utils
@@ -10,6 +10,6 @@
 FOUR_C_NAMESPACE_OPEN
 
 // initial value of precision_
-unsigned int Core::CLN::ClnWrapper::precision_ = CLN_START_PRECISION;
+thread_local unsigned int Core::CLN::ClnWrapper::precision_ = CLN_START_PRECISION;
 
 FOUR_C_NAMESPACE_CLOSE
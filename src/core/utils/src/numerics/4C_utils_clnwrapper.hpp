@@ -152,7 +152,7 @@ namespace Core::CLN
       int prec_id = (Core::CLN::ClnWrapper::precision_ - CLN_START_PRECISION) / CLN_INCREMENT_STEP;
       // we create special vector for zeroes, for faster lookup in the table, since they are
       // needed more often
-      static std::vector<std::pair<cln::cl_F, bool>> zeros_cache(
+      static thread_local std::vector<std::pair<cln::cl_F, bool>> zeros_cache(
           static_cast<int>(double(CLN_REFERENCE_PREC) / double(CLN_INCREMENT_STEP)));
       // for some reason, native conversion from double 0.0 to CLN loses precision, so we convert
       // explicitly
@@ -172,7 +172,7 @@ namespace Core::CLN
       }
       using maptype = std::unordered_map<double, cln::cl_F>;
       // initialize look-up vector  with maximum number of different precisions
-      static std::vector<maptype> clnval_cache(
+      static thread_local std::vector<maptype> clnval_cache(
           static_cast<int>(double(CLN_REFERENCE_PREC) / double(CLN_INCREMENT_STEP)));
       auto it = clnval_cache[prec_id].find(a);
       if (it != clnval_cache[prec_id].end())
@@ -211,8 +211,9 @@ namespace Core::CLN
    private:
     // real CLN value
     cln::cl_F value_;
-    // precision of value_
-    static unsigned int precision_;
+    // precision of new values, every thread has its own precision such that the cut kernel can
+    // run concurrently
+    static thread_local unsigned int precision_;
   };
 
 
@@ -0,0 +1,169 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_UTILS_DOUBLE_DOUBLE_HPP
+#define FOUR_C_UTILS_DOUBLE_DOUBLE_HPP
+
+#include "4C_config.hpp"
+
+#include <cmath>
+#include <ostream>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core
+{
+  /*!
+   * \brief Floating point number with about 32 significant decimal digits
+   *
+   * The value is the unevaluated sum of two doubles hi + lo with |lo| <= ulp(hi) / 2. All
+   * operations are built from error-free transformations of the native double operations and are
+   * therefore much cheaper than arbitrary precision arithmetic, but the precision is fixed. The
+   * exponent range is the one of double.
+   *
+   * Reference: Y. Hida, X.S. Li, D.H. Bailey: Library for double-double and quad-double
+   * arithmetic, 2007.
+   */
+  class DoubleDouble
+  {
+   public:
+    constexpr DoubleDouble() = default;
+
+    //! Conversion from double is exact
+    constexpr DoubleDouble(double a) : hi_(a) {}
+
+    //! Construct from @p hi and @p lo, which have to be normalized already
+    constexpr DoubleDouble(double hi, double lo) : hi_(hi), lo_(lo) {}
+
+    //! Leading part of the value, i.e. the value rounded to double
+    [[nodiscard]] constexpr double hi() const { return hi_; }
+
+    //! Trailing part of the value
+    [[nodiscard]] constexpr double lo() const { return lo_; }
+
+    DoubleDouble operator-() const { return {-hi_, -lo_}; }
+
+    inline DoubleDouble& operator+=(const DoubleDouble& other);
+    inline DoubleDouble& operator-=(const DoubleDouble& other);
+    inline DoubleDouble& operator*=(const DoubleDouble& other);
+    inline DoubleDouble& operator/=(const DoubleDouble& other);
+
+    //! Sum of two doubles including the rounding error
+    static DoubleDouble two_sum(double a, double b)
+    {
+      const double s = a + b;
+      const double bb = s - a;
+      return {s, (a - (s - bb)) + (b - bb)};
+    }
+
+    //! Sum of two doubles including the rounding error, requires |a| >= |b|
+    static DoubleDouble quick_two_sum(double a, double b)
+    {
+      const double s = a + b;
+      return {s, b - (s - a)};
+    }
+
+    //! Product of two doubles including the rounding error
+    static DoubleDouble two_prod(double a, double b)
+    {
+      const double p = a * b;
+      return {p, std::fma(a, b, -p)};
+    }
+
+    friend std::ostream& operator<<(std::ostream& stream, const DoubleDouble& a)
+    {
+      stream << a.hi_;
+      return stream;
+    }
+
+   private:
+    double hi_ = 0.0;
+    double lo_ = 0.0;
+  };
+
+  inline DoubleDouble operator+(const DoubleDouble& a, const DoubleDouble& b)
+  {
+    DoubleDouble s = DoubleDouble::two_sum(a.hi(), b.hi());
+    const DoubleDouble t = DoubleDouble::two_sum(a.lo(), b.lo());
+    s = DoubleDouble::quick_two_sum(s.hi(), s.lo() + t.hi());
+    return DoubleDouble::quick_two_sum(s.hi(), s.lo() + t.lo());
+  }
+
+  inline DoubleDouble operator-(const DoubleDouble& a, const DoubleDouble& b) { return a + (-b); }
+
+  inline DoubleDouble operator*(const DoubleDouble& a, const DoubleDouble& b)
+  {
+    const DoubleDouble p = DoubleDouble::two_prod(a.hi(), b.hi());
+    return DoubleDouble::quick_two_sum(p.hi(), p.lo() + (a.hi() * b.lo() + a.lo() * b.hi()));
+  }
+
+  inline DoubleDouble operator/(const DoubleDouble& a, const DoubleDouble& b)
+  {
+    // long division with three quotient digits
+    const double q1 = a.hi() / b.hi();
+    DoubleDouble r = a - q1 * b;
+    const double q2 = r.hi() / b.hi();
+    r -= q2 * b;
+    const double q3 = r.hi() / b.hi();
+    return DoubleDouble::quick_two_sum(q1, q2) + q3;
+  }
+
+  inline DoubleDouble& DoubleDouble::operator+=(const DoubleDouble& other)
+  {
+    return *this = *this + other;
+  }
+
+  inline DoubleDouble& DoubleDouble::operator-=(const DoubleDouble& other)
+  {
+    return *this = *this - other;
+  }
+
+  inline DoubleDouble& DoubleDouble::operator*=(const DoubleDouble& other)
+  {
+    return *this = *this * other;
+  }
+
+  inline DoubleDouble& DoubleDouble::operator/=(const DoubleDouble& other)
+  {
+    return *this = *this / other;
+  }
+
+  inline bool operator==(const DoubleDouble& a, const DoubleDouble& b)
+  {
+    return a.hi() == b.hi() and a.lo() == b.lo();
+  }
+
+  inline bool operator!=(const DoubleDouble& a, const DoubleDouble& b) { return not(a == b); }
+
+  inline bool operator<(const DoubleDouble& a, const DoubleDouble& b)
+  {
+    return a.hi() < b.hi() or (a.hi() == b.hi() and a.lo() < b.lo());
+  }
+
+  inline bool operator>(const DoubleDouble& a, const DoubleDouble& b) { return b < a; }
+
+  inline bool operator<=(const DoubleDouble& a, const DoubleDouble& b) { return not(b < a); }
+
+  inline bool operator>=(const DoubleDouble& a, const DoubleDouble& b) { return not(a < b); }
+
+  //! Absolute value of @p a
+  inline DoubleDouble abs(const DoubleDouble& a) { return a.hi() < 0.0 ? -a : a; }
+
+  //! Square root of @p a by one Newton step on the double square root
+  inline DoubleDouble sqrt(const DoubleDouble& a)
+  {
+    if (a.hi() <= 0.0) return std::sqrt(a.hi());
+
+    const double x = std::sqrt(a.hi());
+    const DoubleDouble x2 = DoubleDouble::two_prod(x, x);
+    return DoubleDouble::quick_two_sum(x, (a - x2).hi() / (2.0 * x));
+  }
+}  // namespace Core
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
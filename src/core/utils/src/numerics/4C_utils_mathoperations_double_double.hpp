@@ -0,0 +1,38 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_UTILS_MATHOPERATIONS_DOUBLE_DOUBLE_HPP
+#define FOUR_C_UTILS_MATHOPERATIONS_DOUBLE_DOUBLE_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_utils_double_double.hpp"
+#include "4C_utils_mathoperations.hpp"
+
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core
+{
+  template <typename T>
+  struct MathOperations<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, Core::DoubleDouble>>>
+  {
+    static T abs(const T& t) { return Core::abs(t); }
+    static T sqrt(const T& t) { return Core::sqrt(t); }
+    static T pow(const T& base, const int exponent)
+    {
+      T result = 1.0;
+      for (int i = 0; i < std::abs(exponent); ++i) result *= base;
+      return exponent < 0 ? T(1.0) / result : result;
+    }
+    static double get_double(const T& t) { return t.hi(); }
+  };
+
+}  // namespace Core
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
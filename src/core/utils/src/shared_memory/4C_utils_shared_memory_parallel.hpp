@@ -0,0 +1,98 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_UTILS_SHARED_MEMORY_PARALLEL_HPP
+#define FOUR_C_UTILS_SHARED_MEMORY_PARALLEL_HPP
+
+#include "4C_config.hpp"
+
+#include <exception>
+
+#ifdef FOUR_C_WITH_OPENMP
+#include <omp.h>
+#endif
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::Utils
+{
+  /**
+   * Return the maximum number of threads that are available to a parallel region on this MPI
+   * rank. Without OpenMP support, this is always 1.
+   */
+  inline int max_threads()
+  {
+#ifdef FOUR_C_WITH_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+  }
+
+  /**
+   * Return the id of the calling thread inside a parallel region. The id is in the range
+   * [0, number of threads of the region). Outside of a parallel region or without OpenMP support,
+   * this is always 0.
+   */
+  inline int thread_id()
+  {
+#ifdef FOUR_C_WITH_OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+  }
+
+  /**
+   * Call @p body for every index in the range [0, @p n) using up to @p num_threads threads.
+   *
+   * The indices are handed out dynamically in chunks of @p chunk_size, so the order of execution is
+   * not defined. Thread-local data can be stored in a container of size @p num_threads and
+   * accessed via thread_id() from within @p body.
+   *
+   * An exception thrown from @p body does not leave the parallel region. Instead, the first
+   * caught exception is rethrown on the calling thread after all threads have finished.
+   *
+   * If 4C is built without OpenMP or @p num_threads is 1, the loop is executed serially in
+   * ascending order.
+   */
+  template <typename Body>
+  void parallel_for(int n, int num_threads, Body&& body, int chunk_size = 1)
+  {
+#ifdef FOUR_C_WITH_OPENMP
+    if (num_threads > 1 and n > 1)
+    {
+      std::exception_ptr first_exception = nullptr;
+
+#pragma omp parallel for schedule(dynamic, chunk_size) num_threads(num_threads)
+      for (int i = 0; i < n; ++i)
+      {
+        try
+        {
+          body(i);
+        }
+        catch (...)
+        {
+#pragma omp critical(four_c_utils_parallel_for_exception)
+          {
+            if (!first_exception) first_exception = std::current_exception();
+          }
+        }
+      }
+
+      if (first_exception) std::rethrow_exception(first_exception);
+      return;
+    }
+#endif
+
+    for (int i = 0; i < n; ++i) body(i);
+  }
+}  // namespace Core::Utils
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
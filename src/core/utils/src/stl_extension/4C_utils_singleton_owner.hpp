@@ -10,10 +10,12 @@
 
 #include "4C_config.hpp"
 
+#include <atomic>
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 
 FOUR_C_NAMESPACE_OPEN
@@ -157,6 +159,8 @@ namespace Core::Utils
      * In case any parameters are needed to call the constructor of the singleton object, they have
      * to be passed as well. Unfortunately, this is necessary regardless of the @p action flag.
      *
+     * Creation is thread-safe, i.e., concurrent calls with SingletonAction::create create the
+     * instance only once. Destruction must not happen concurrently with any other call.
      */
     T* instance(SingletonAction action, CreationArgs... args);
 
@@ -169,6 +173,12 @@ namespace Core::Utils
     //! singleton instance
     std::unique_ptr<T> instance_;
 
+    //! raw pointer to the singleton instance for lock-free access once it is created
+    std::atomic<T*> instance_ptr_{nullptr};
+
+    //! serializes the creation of the singleton instance
+    std::mutex creation_mutex_;
+
     //! Function that creates a singleton object
     std::function<std::unique_ptr<T>(CreationArgs...)> creator_;
   };
@@ -295,9 +305,17 @@ namespace Core::Utils
   template <typename T, typename... CreationArgs>
   T* SingletonOwner<T, CreationArgs...>::instance(SingletonAction action, CreationArgs... args)
   {
-    if (action == SingletonAction::create and !instance_)
+    if (action == SingletonAction::create)
     {
-      instance_ = creator_(args...);
+      T* existing = instance_ptr_.load(std::memory_order_acquire);
+      if (existing) return existing;
+
+      std::lock_guard<std::mutex> lock(creation_mutex_);
+      if (!instance_)
+      {
+        instance_ = creator_(args...);
+        instance_ptr_.store(instance_.get(), std::memory_order_release);
+      }
     }
     else if (action == SingletonAction::destruct)
     {
@@ -310,6 +328,7 @@ namespace Core::Utils
   template <typename T, typename... CreationArgs>
   void SingletonOwner<T, CreationArgs...>::destroy_instance()
   {
+    instance_ptr_.store(nullptr, std::memory_order_release);
     instance_.reset();
   }
 
@@ -0,0 +1,53 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_utils_function.hpp"
+#include "4C_utils_functionvariables.hpp"
+
+#include <memory>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  TEST(SymbolicFunctionOfSpaceTimeTest, EvaluateAtPointsMatchesEvaluate)
+  {
+    std::vector<std::shared_ptr<Core::Utils::FunctionVariable>> variables = {
+        std::make_shared<Core::Utils::ParsedFunctionVariable>("a", "2*t")};
+    const Core::Utils::SymbolicFunctionOfSpaceTime function(
+        {"x + 2*y - z*t", "a * sin(x) + y^2"}, variables);
+
+    const std::vector<double> coordinates = {0.0, 1.0, 2.0, -1.5, 0.5, 3.0, 2.0, -4.0, 0.25};
+    const double time = 0.75;
+
+    for (std::size_t component = 0; component < 2; ++component)
+    {
+      std::vector<double> values(3);
+      function.evaluate_at_points(coordinates.data(), 3, time, component, values.data());
+
+      for (std::size_t i = 0; i < 3; ++i)
+        EXPECT_DOUBLE_EQ(values[i], function.evaluate(&coordinates[3 * i], time, component));
+    }
+  }
+
+  TEST(SymbolicFunctionOfSpaceTimeTest, EvaluateAtPointsOfScalarFunctionIgnoresComponent)
+  {
+    const Core::Utils::SymbolicFunctionOfSpaceTime function({"x * y * z + t"}, {});
+
+    const std::vector<double> coordinates = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    std::vector<double> values(2);
+    function.evaluate_at_points(coordinates.data(), 2, 1.0, 2, values.data());
+
+    EXPECT_DOUBLE_EQ(values[0], 7.0);
+    EXPECT_DOUBLE_EQ(values[1], 121.0);
+  }
+}  // namespace
+
+FOUR_C_NAMESPACE_CLOSE
@@ -160,6 +160,87 @@ namespace
   }
 
 
+  TEST(SymbolicExpressionTest, TestVariableNames)
+  {
+    Core::Utils::SymbolicExpression<double> symbolicexpression("y * sin(x) + 2 * y + c");
+
+    EXPECT_EQ(symbolicexpression.variable_names(), (std::vector<std::string>{"c", "x", "y"}));
+  }
+
+  TEST(SymbolicExpressionTest, TestCopyEvaluatesSameExpression)
+  {
+    Core::Utils::SymbolicExpression<double> symbolicexpression("2*x - (x - 1)^2");
+    Core::Utils::SymbolicExpression<double> copy(symbolicexpression);
+
+    EXPECT_DOUBLE_EQ(copy.value({{"x", 3.0}}), 2.0);
+    EXPECT_DOUBLE_EQ(symbolicexpression.value({{"x", 3.0}}), copy.value({{"x", 3.0}}));
+  }
+
+  TEST(SymbolicExpressionTest, TestAlternatingExpressionsEvaluateIndependently)
+  {
+    // both expressions share the scratch space of value() with different stack sizes
+    Core::Utils::SymbolicExpression<double> deep("x * (y + (x * (y + (x * (y + 1)))))");
+    Core::Utils::SymbolicExpression<double> flat("x - y");
+
+    for (double x : {1.0, 2.0, -3.0})
+    {
+      EXPECT_DOUBLE_EQ(deep.value({{"x", x}, {"y", 2.0}}), x * (2.0 + x * (2.0 + x * 3.0)));
+      EXPECT_DOUBLE_EQ(flat.value({{"x", x}, {"y", 2.0}}), x - 2.0);
+    }
+  }
+
+  TEST(SymbolicExpressionTest, TestBatchValue)
+  {
+    Core::Utils::SymbolicExpression<double> symbolicexpression("x * y + heaviside(x - 1) * t");
+
+    // interleaved coordinates (x, y) of three points and a time shared by all points
+    const std::vector<double> coordinates = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0};
+    const double time = 0.5;
+
+    std::vector<double> values(3);
+    symbolicexpression.value(
+        {{"x", coordinates.data(), 2}, {"y", coordinates.data() + 1, 2}, {"t", &time, 0}}, 3,
+        values.data());
+
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+      EXPECT_DOUBLE_EQ(values[i], symbolicexpression.value({{"x", coordinates[2 * i]},
+                                      {"y", coordinates[2 * i + 1]}, {"t", time}}));
+    }
+  }
+
+  TEST(SymbolicExpressionTest, TestBatchValueAndFirstDerivative)
+  {
+    Core::Utils::SymbolicExpression<double> symbolicexpression("x^2 * y + c * y");
+
+    const std::vector<double> x = {1.0, 2.0};
+    const std::vector<double> y = {3.0, 4.0};
+    const double c = 5.0;
+
+    std::vector<double> values(2);
+    std::vector<double> derivatives(2 * 3);
+    symbolicexpression.value_and_first_derivative({{"x", x.data()}, {"y", y.data()}, {"c", &c, 0}},
+        {"x", "y", "z"}, 2, values.data(), derivatives.data());
+
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+      EXPECT_DOUBLE_EQ(values[i], x[i] * x[i] * y[i] + c * y[i]);
+      EXPECT_DOUBLE_EQ(derivatives[3 * i + 0], 2.0 * x[i] * y[i]);
+      EXPECT_DOUBLE_EQ(derivatives[3 * i + 1], x[i] * x[i] + c);
+      EXPECT_DOUBLE_EQ(derivatives[3 * i + 2], 0.0);
+    }
+  }
+
+  TEST(SymbolicExpressionTest, BatchEvaluateWithMissingVariableThrows)
+  {
+    Core::Utils::SymbolicExpression<double> symbolicexpression("x * y");
+
+    const double x = 1.0;
+    double value;
+    FOUR_C_EXPECT_THROW_WITH_MESSAGE(symbolicexpression.value({{"x", &x, 0}}, 1, &value),
+        Core::Exception, "variable or constant 'y' not given as input in evaluate()");
+  }
+
 
 }  // namespace
 FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,58 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_utils_double_double.hpp"
+
+#include "4C_utils_mathoperations_double_double.hpp"
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  TEST(CoreUtilsDoubleDoubleTest, KeepsRoundingErrorOfSum)
+  {
+    // 1 + 1e-20 - 1 is zero in double
+    const Core::DoubleDouble a = Core::DoubleDouble(1.0) + 1e-20;
+    EXPECT_EQ(a.hi(), 1.0);
+    EXPECT_EQ((a - 1.0).hi(), 1e-20);
+  }
+
+  TEST(CoreUtilsDoubleDoubleTest, ProductAndQuotient)
+  {
+    const Core::DoubleDouble third = Core::DoubleDouble(1.0) / 3.0;
+    const Core::DoubleDouble residual = third * 3.0 - 1.0;
+    EXPECT_LT(std::abs(residual.hi()), 1e-31);
+
+    // (1 + 2^-30)^2 = 1 + 2^-29 + 2^-60 is not representable in double
+    const Core::DoubleDouble x = 1.0 + std::ldexp(1.0, -30);
+    const Core::DoubleDouble x2 = x * x;
+    EXPECT_EQ(x2.hi(), 1.0 + std::ldexp(1.0, -29));
+    EXPECT_EQ(x2.lo(), std::ldexp(1.0, -60));
+  }
+
+  TEST(CoreUtilsDoubleDoubleTest, SquareRoot)
+  {
+    const Core::DoubleDouble two = 2.0;
+    const Core::DoubleDouble root = Core::MathOperations<Core::DoubleDouble>::sqrt(two);
+    EXPECT_LT(std::abs((root * root - two).hi()), 1e-31);
+    EXPECT_EQ(Core::MathOperations<Core::DoubleDouble>::sqrt(0.0).hi(), 0.0);
+  }
+
+  TEST(CoreUtilsDoubleDoubleTest, Comparison)
+  {
+    const Core::DoubleDouble a = Core::DoubleDouble(1.0) + 1e-20;
+    EXPECT_TRUE(a > 1.0);
+    EXPECT_TRUE(-a < -1.0);
+    EXPECT_TRUE(a != 1.0);
+    EXPECT_EQ(Core::MathOperations<Core::DoubleDouble>::abs(-a), a);
+    EXPECT_EQ(Core::MathOperations<Core::DoubleDouble>::pow(a, 2), a * a);
+  }
+}  // namespace
+
+FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,50 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_utils_shared_memory_parallel.hpp"
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+  using namespace FourC::Core::Utils;
+
+  TEST(SharedMemoryParallel, ParallelForVisitsEveryIndexOnce)
+  {
+    const int n = 1000;
+    std::vector<int> visited(n, 0);
+
+    parallel_for(n, max_threads(), [&](int i) { visited[i] += 1; });
+
+    for (int i = 0; i < n; ++i) EXPECT_EQ(visited[i], 1);
+  }
+
+  TEST(SharedMemoryParallel, ParallelForThreadLocalAccumulation)
+  {
+    const int n = 1000;
+    const int num_threads = max_threads();
+    std::vector<long> partial_sums(num_threads, 0);
+
+    parallel_for(n, num_threads, [&](int i) { partial_sums[thread_id()] += i; }, 16);
+
+    EXPECT_EQ(std::accumulate(partial_sums.begin(), partial_sums.end(), 0L), n * (n - 1L) / 2);
+  }
+
+  TEST(SharedMemoryParallel, ParallelForRethrowsException)
+  {
+    EXPECT_THROW(parallel_for(100, max_threads(),
+                     [&](int i)
+                     {
+                       if (i == 42) throw std::runtime_error("error in loop body");
+                     }),
+        std::runtime_error);
+  }
+}  // namespace
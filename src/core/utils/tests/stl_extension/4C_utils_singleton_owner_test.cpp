@@ -9,8 +9,12 @@
 
 #include <gmock/gmock.h>
 
+#include "4C_utils_shared_memory_parallel.hpp"
 #include "4C_utils_singleton_owner.hpp"
 
+#include <atomic>
+#include <vector>
+
 namespace
 {
   using namespace FourC;
@@ -24,6 +28,7 @@ namespace
     FRIEND_TEST(TestSingletonOwner, CreatesSingleton);
     FRIEND_TEST(TestSingletonOwner, DestructsSingleton);
     FRIEND_TEST(TestSingletonOwner, ReturnsExistingInstance);
+    FRIEND_TEST(TestSingletonOwner, ConcurrentCreationCreatesOnce);
     FRIEND_TEST(TestSingletonMap, DifferentKeys);
   };
 
@@ -71,6 +76,25 @@ namespace
     EXPECT_EQ(ptr_1, ptr_2);
   }
 
+  TEST(TestSingletonOwner, ConcurrentCreationCreatesOnce)
+  {
+    std::atomic<int> num_created = 0;
+    Core::Utils::SingletonOwner<DummySingleton> singleton_owner{
+        [&num_created]()
+        {
+          ++num_created;
+          return std::unique_ptr<DummySingleton>(new DummySingleton());
+        }};
+
+    const int n = 1000;
+    std::vector<DummySingleton*> ptrs(n, nullptr);
+    Core::Utils::parallel_for(n, Core::Utils::max_threads(),
+        [&](int i) { ptrs[i] = singleton_owner.instance(Core::Utils::SingletonAction::create); });
+
+    EXPECT_EQ(num_created, 1);
+    for (DummySingleton* ptr : ptrs) EXPECT_EQ(ptr, ptrs[0]);
+  }
+
   TEST(TestSingletonMap, DifferentKeys)
   {
     struct Creator
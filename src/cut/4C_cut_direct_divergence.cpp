@@ -26,6 +26,16 @@ std::shared_ptr<Core::FE::GaussPoints> Cut::DirectDivergence::vc_integration_rul
 {
   // TEUCHOS_FUNC_TIME_MONITOR( "Cut::DirectDivergence::VCIntegrationRule" );
 
+  divergence_cells(RefPlaneEqn);
+  return main_gauss_rule();
+}
+
+/*------------------------------------------------------------------------------------------------*
+ * Integration facets, reference plane and the divergence cells of all integration facets
+ *------------------------------------------------------------------------------------------------*/
+void Cut::DirectDivergence::divergence_cells(std::vector<double>& RefPlaneEqn)
+{
+
   std::vector<plain_facet_set::const_iterator>
       facetIterator;  // iterators of facets which need to be considered for integration rule
   plain_facet_set::const_iterator IteratorRefFacet;  // iterator for the reference facet
@@ -86,22 +96,35 @@ std::shared_ptr<Core::FE::GaussPoints> Cut::DirectDivergence::vc_integration_rul
     }
   }
 
-  std::shared_ptr<Core::FE::CollectedGaussPoints> cgp =
-      std::make_shared<Core::FE::CollectedGaussPoints>(0);
-
 #ifdef DIRECTDIV_EXTENDED_DEBUG_OUTPUT
   std::cout << "Number of facets: " << volcell_->Facets().size() << std::endl;
   std::cout << "Size of facetIterator: " << facetIterator.size() << std::endl;
 #endif
 
+  facet_div_cells_.clear();
+  facet_div_cells_.reserve(facetIterator.size());
   for (unsigned i = 0; i < facetIterator.size(); i++)
   {
     plain_facet_set::const_iterator iter = facetIterator[i];
     Facet* fe = *iter;
-    FacetIntegration faee1(fe, elem1_, position_, false, false);
+    FacetDivergenceCells& facet_cells = facet_div_cells_.emplace_back(
+        FacetDivergenceCells{FacetIntegration(fe, elem1_, position_, false, false), {}, {}});
 
-    faee1.divergence_integration_rule_new(mesh_, *cgp);
+    facet_cells.integration.divergence_cells(mesh_, facet_cells.cells, facet_cells.eqn_planes);
   }
+}
+
+/*------------------------------------------------------------------------------------------------*
+ * Integration points on the divergence cells of all integration facets
+ *------------------------------------------------------------------------------------------------*/
+std::shared_ptr<Core::FE::GaussPoints> Cut::DirectDivergence::main_gauss_rule()
+{
+  std::shared_ptr<Core::FE::CollectedGaussPoints> cgp =
+      std::make_shared<Core::FE::CollectedGaussPoints>(0);
+
+  for (FacetDivergenceCells& facet_cells : facet_div_cells_)
+    facet_cells.integration.divergence_cells_integration_rule(
+        facet_cells.cells, facet_cells.eqn_planes, *cgp);
 
   return cgp;
 }
@@ -585,39 +608,34 @@ void Cut::DirectDivergence::debug_volume(const Core::FE::GaussIntegration& gpv,
   volGlobal = TotalInteg;
 #endif
 
+  // No output and no debug dump here, this may run concurrently for different volumecells. The
+  // caller reports negligible volumecells and dumps the element on failure.
   if (volGlobal < 0.0 || TotalInteg < 0.0)
   {
     if (fabs(TotalInteg) < REF_VOL_DIRDIV)
     {
       isNeg = true;
       volcell_->set_volume(0.0);
-      std::cout << "----WARNING:::negligible volumecell parent id = "
-                << volcell_->parent_element()->id() << "---------------" << std::endl;
-      std::cout << "volume in local coordinates = " << TotalInteg
-                << "\t volume in global coordinates = " << volGlobal << std::endl;
-
       return;
     }
 
-    mesh_.debug_dump(elem1_, __FILE__, __LINE__);
-    std::cout << "volume: " << TotalInteg << std::endl;
-    FOUR_C_THROW("negative volume predicted by the DirectDivergence integration rule;");
+    FOUR_C_THROW(
+        "negative volume predicted by the DirectDivergence integration rule; volume in local "
+        "coordinates = %g, volume in global coordinates = %g",
+        TotalInteg, volGlobal);
   }
 
   volcell_->set_volume(volGlobal);
   if (std::isnan(volGlobal))
   {
-    std::cout << "-------------------------------------------------------------\n";
-    std::cout << "There are two possible sources of this problem \n";
-    std::cout
-        << "1. divCells created from facet may fall on a line. Print the main Gauss points from "
-           "Cut::FacetIntegration::divergence_integration_rule(),"
-           " if this is the case, all points belong to a particular divCells have NaN weights\n";
-    std::cout << "2. Global::: The reference plane is not correctly chosen. Print the equation of "
-                 "reference plane and if the first component "
-                 "is close to zero, then the volume is infinity. Check "
-                 "Cut::DirectDivergenceGlobalRefplane::GetReferencePlane() \n";
-    FOUR_C_THROW("Volume is not a number.");
+    FOUR_C_THROW(
+        "Volume is not a number. There are two possible sources of this problem:\n"
+        "1. divCells created from facet may fall on a line. Print the main Gauss points from "
+        "Cut::FacetIntegration::divergence_integration_rule(), if this is the case, all points "
+        "belong to a particular divCells have NaN weights\n"
+        "2. Global::: The reference plane is not correctly chosen. Print the equation of reference "
+        "plane and if the first component is close to zero, then the volume is infinity. Check "
+        "Cut::DirectDivergenceGlobalRefplane::GetReferencePlane()");
   }
 }
 
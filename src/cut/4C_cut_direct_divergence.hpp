@@ -11,8 +11,13 @@
 #include "4C_config.hpp"
 
 #include "4C_cut_element.hpp"
+#include "4C_cut_facet_integration.hpp"
 #include "4C_cut_volumecell.hpp"
 
+#include <list>
+#include <memory>
+#include <vector>
+
 // Choose whether to output divirgence cell information in global coordinates (for easier comparison
 // to Tesselation).
 #define OUTPUT_GLOBAL_DIVERGENCE_CELLS
@@ -45,6 +50,20 @@ namespace Cut
     */
     std::shared_ptr<Core::FE::GaussPoints> vc_integration_rule(std::vector<double>& RefPlaneEqn);
 
+    /*!
+    \brief First part of vc_integration_rule(): identify the integration facets and the reference
+    plane and create the divergence cells of all integration facets. This may triangulate or split
+    the facets of the volumecell.
+    */
+    void divergence_cells(std::vector<double>& RefPlaneEqn);
+
+    /*!
+    \brief Second part of vc_integration_rule(): integration points on the divergence cells of
+    divergence_cells(). Neither the facets nor the mesh are modified, so this may run concurrently
+    for different volumecells.
+    */
+    std::shared_ptr<Core::FE::GaussPoints> main_gauss_rule();
+
     /*!
     \brief Compute and set correspondingly the volume of the considered volumecell from the
     generated integration rule and compare it with full application of divergence theorem
@@ -59,6 +78,14 @@ namespace Cut
         const Core::FE::GaussIntegration& gpv, Core::FE::GaussPoints& gpmain);
 
    private:
+    //! divergence cells of one integration facet
+    struct FacetDivergenceCells
+    {
+      FacetIntegration integration;
+      std::list<std::shared_ptr<BoundaryCell>> cells;
+      std::vector<std::vector<double>> eqn_planes;
+    };
+
     /*!
     \brief Identify the list of facets which need to be triangulated, and also get the reference
     facet that will be used in xfluid part
@@ -89,6 +116,9 @@ namespace Cut
 
     //! Points that define the reference plane used for this volumecell
     std::vector<Point*> ref_pts_gmsh_;
+
+    //! divergence cells of all integration facets, see divergence_cells()
+    std::vector<FacetDivergenceCells> facet_div_cells_;
   };
 }  // namespace Cut
 
@@ -1281,6 +1281,28 @@ void Cut::Element::direct_divergence_gauss_rule(
   }
 }
 
+/*----------------------------------------------------------------------------*
+ * Divergence cells of the DirectDivergence rules of all volumecells
+ *----------------------------------------------------------------------------*/
+void Cut::Element::prepare_direct_divergence_gauss_rules(Mesh& mesh, bool include_inner,
+    Cut::BCellGaussPts Bcellgausstype,
+    std::vector<std::pair<VolumeCell*, std::shared_ptr<DirectDivergence>>>& prepared_cells)
+{
+  if (not active_) return;
+
+  // try to create one single simple shaped integration cell if possible
+  if (create_simple_shaped_integration_cells(mesh)) return;
+
+  eleinttype_ = Cut::EleIntType_DirectDivergence;
+
+  for (VolumeCell* cell : cells_)
+  {
+    std::shared_ptr<DirectDivergence> dd =
+        cell->prepare_direct_divergence_gauss_rule(this, mesh, include_inner, Bcellgausstype);
+    if (dd) prepared_cells.emplace_back(cell, dd);
+  }
+}
+
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 bool Cut::Element::has_level_set_side()
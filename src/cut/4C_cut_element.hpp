@@ -17,6 +17,10 @@
 
 FOUR_C_NAMESPACE_OPEN
 
+namespace Core::FE
+{
+  class GaussPoints;
+}  // namespace Core::FE
 
 namespace Cut
 {
@@ -24,6 +28,7 @@ namespace Cut
   class IntegrationCell;
   class BoundaryCell;
   class BoundingBox;
+  class DirectDivergence;
 
   /*--------------------------------------------------------------------------*/
   /*! \brief Base class of all elements.
@@ -182,6 +187,14 @@ namespace Cut
     void direct_divergence_gauss_rule(
         Mesh& mesh, bool include_inner, Cut::BCellGaussPts Bcellgausstype);
 
+    /*! \brief First part of direct_divergence_gauss_rule(): the divergence cells of all
+     *  volumecells that need a DirectDivergence rule are appended to @p prepared_cells. The
+     *  Gauss points are generated afterwards with
+     *  VolumeCell::evaluate_direct_divergence_gauss_rule(). */
+    void prepare_direct_divergence_gauss_rules(Mesh& mesh, bool include_inner,
+        Cut::BCellGaussPts Bcellgausstype,
+        std::vector<std::pair<VolumeCell*, std::shared_ptr<DirectDivergence>>>& prepared_cells);
+
     /*! \brief Return the level set value at the given global coordinate
      *  which has to be INSIDE the element. */
     template <class T>
@@ -757,6 +757,18 @@ void Cut::FacetIntegration::divergence_integration_rule_new(
   // the last two parameters has no influence when called from the first parameter is set to true
   std::vector<std::vector<double>> eqn_plane_divCell;
 
+  divergence_cells(mesh, divCells, eqn_plane_divCell);
+  divergence_cells_integration_rule(divCells, eqn_plane_divCell, cgp);
+}
+
+/*------------------------------------------------------------------------------------------------*
+ * Divergence cells of the facet and the equation of plane of each cell. The facet is triangulated
+ * or split on the way if necessary.
+ *------------------------------------------------------------------------------------------------*/
+void Cut::FacetIntegration::divergence_cells(Mesh &mesh,
+    std::list<std::shared_ptr<BoundaryCell>> &divCells,
+    std::vector<std::vector<double>> &eqn_plane_divCell)
+{
   // If the facet is not planar it will be triangulated in DirectDivergence::list_facets().
   // Might want to split the facet for the case it is a planar quad -> less divCells.
 
@@ -821,17 +833,25 @@ void Cut::FacetIntegration::divergence_integration_rule_new(
   // SAFETY-CHECK
   if (eqn_plane_divCell.size() != divCells.size())
     FOUR_C_THROW("Something wrong with divCell and clockwise assignment.");
+}
 
+/*------------------------------------------------------------------------------------------------*
+ * Gauss points of the divergence cells. Neither the facet nor the mesh is modified here.
+ *------------------------------------------------------------------------------------------------*/
+void Cut::FacetIntegration::divergence_cells_integration_rule(
+    const std::list<std::shared_ptr<BoundaryCell>> &divCells,
+    const std::vector<std::vector<double>> &eqn_plane_divCell, Core::FE::CollectedGaussPoints &cgp)
+{
   double normalX;
 
   int zz = 0;
-  for (std::list<std::shared_ptr<BoundaryCell>>::iterator i = divCells.begin(); i != divCells.end();
-       ++i)
+  for (std::list<std::shared_ptr<BoundaryCell>>::const_iterator i = divCells.begin();
+       i != divCells.end(); ++i)
   {
     BoundaryCell *bcell = &**i;
 
     // Get equation of plane for divergence Cell.
-    std::vector<double> eqn_plane_bcell = eqn_plane_divCell[zz];
+    const std::vector<double> &eqn_plane_bcell = eqn_plane_divCell[zz];
 
     double normalScale = 0.0;
     for (unsigned i = 0; i < 3; i++) normalScale += eqn_plane_bcell[i] * eqn_plane_bcell[i];
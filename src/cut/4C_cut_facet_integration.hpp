@@ -80,6 +80,23 @@ namespace Cut
     */
     void divergence_integration_rule_new(Mesh &mesh, Core::FE::CollectedGaussPoints &cgp);
 
+    /*!
+    \brief First part of divergence_integration_rule_new(): create the divergence cells of the
+    facet and the equation of plane of each cell. This may triangulate or split the facet.
+    */
+    void divergence_cells(Mesh &mesh, std::list<std::shared_ptr<BoundaryCell>> &divCells,
+        std::vector<std::vector<double>> &eqn_plane_divCell);
+
+    /*!
+    \brief Second part of divergence_integration_rule_new(): append the Gauss points of the
+    divergence cells to @p cgp. Neither the facet nor the mesh is modified, so this may run
+    concurrently for different volumecells.
+    */
+    void divergence_cells_integration_rule(
+        const std::list<std::shared_ptr<BoundaryCell>> &divCells,
+        const std::vector<std::vector<double>> &eqn_plane_divCell,
+        Core::FE::CollectedGaussPoints &cgp);
+
    private:
     /*!
     \brief Check whether the vertices numbering of the facet is clockwise
@@ -870,6 +870,9 @@ bool Cut::Kernel::close_to_zero(const Core::CLN::ClnWrapper& a)
   return ((a < lpf) and (a > lnf));
 };
 
+
+bool Cut::Kernel::close_to_zero(const Core::DoubleDouble& a) { return close_to_zero(a.hi()); }
+
   // non templated static data from cut_kernel
 
 #ifdef DEBUG_MEMORY_ALLOCATION
@@ -18,6 +18,7 @@
 #include "4C_utils_cln_matrix_conversion.hpp"
 #include "4C_utils_clnwrapper.hpp"
 #include "4C_utils_mathoperations_cln.hpp"
+#include "4C_utils_mathoperations_double_double.hpp"
 
 #include <unordered_map>
 
@@ -39,6 +40,8 @@ namespace Cut::Kernel
 
   bool close_to_zero(const Core::CLN::ClnWrapper& a);
 
+  bool close_to_zero(const Core::DoubleDouble& a);
+
   // Class to collects statistics about runs on double and cln in the cut intersection
   class CutKernelStatistics
   {
@@ -746,6 +749,23 @@ namespace Cut::Kernel
         xyze, px, initial_rhs);  // forwarding to normal function
   }
 
+  /// computes the tolerance for the strategies in double-double arithmetic
+  template <class T1, class T2, class T3>
+  Core::DoubleDouble adaptive_combined_newton_tolerance(
+      const T1& xyze, const T2& px, const T3& initial_rhs, Core::DoubleDouble&)
+  {
+    /* --- Build the absolute tolerance */
+    Core::DoubleDouble tol = xyze.norm_inf();
+    Core::DoubleDouble linescale = px.norm_inf();
+    if (linescale > tol) tol = linescale;
+    tol *= DOUBLE_DOUBLE_LINSOLVETOL;
+
+    /* --- Add the relative tolerance */
+    tol += DOUBLE_DOUBLE_LINSOLVETOL * initial_rhs.norm_inf();
+
+    return tol;
+  }
+
 #ifdef CUT_CLN_CALC
 
   /// computes adaptive precision for AdaptivePrecision strategies
@@ -818,6 +838,11 @@ namespace Cut::Kernel
    public:
     /// constructor
     NewtonSolve(Core::LinAlg::Matrix<dim, 1>& xsi, bool checklimits) : Strategy(xsi, checklimits) {}
+    /// constructor for the double-double strategies
+    NewtonSolve(Core::LinAlg::Matrix<dim, 1, Core::DoubleDouble>& xsi, bool checklimits)
+        : Strategy(xsi, checklimits)
+    {
+    }
 #ifdef CUT_CLN_CALC
     /// required constructor for CLN
     NewtonSolve(Core::LinAlg::Matrix<dim, 1, Core::CLN::ClnWrapper>& xsi, bool checklimits)
@@ -2991,6 +3016,9 @@ namespace Cut::Kernel
 
         if (major_fail or result_fail)
         {
+#if DOUBLE_DOUBLE_BEFORE_CLN
+          if (compute_double_double(xyze_side, px, distance, signeddistance)) return true;
+#endif
           // CutKernelStatistics::get_cut_kernel_statistics().ClnDistanceCounter();
 
 #endif
@@ -3129,6 +3157,59 @@ namespace Cut::Kernel
 
     void write_to_gmsh(std::ofstream& file) { Strategy::write_to_gmsh(file); }
 
+    // Repeat the Newton scheme in double-double arithmetic. If the error of its solution is below
+    // the limit of the cln computation, the solution replaces the double solution and the topology
+    // information is computed again. Otherwise false is returned and cln has to be used.
+    bool compute_double_double(const Core::LinAlg::Matrix<prob_dim, num_nodes_side>& xyze_side,
+        const Core::LinAlg::Matrix<prob_dim, 1>& px, double& distance, bool signeddistance)
+    {
+      Core::LinAlg::Matrix<prob_dim, num_nodes_side, Core::DoubleDouble> dd_xyze_side;
+      for (unsigned i = 0; i < prob_dim * num_nodes_side; ++i)
+        dd_xyze_side.data()[i] = xyze_side.data()[i];
+      Core::LinAlg::Matrix<prob_dim, 1, Core::DoubleDouble> dd_px;
+      for (unsigned i = 0; i < prob_dim; ++i) dd_px(i) = px(i);
+
+      Core::LinAlg::Matrix<prob_dim, 1, Core::DoubleDouble> dd_xsi;
+      NewtonSolve<ComputeDistanceStrategy<false, prob_dim, side_type, dim_side, num_nodes_side,
+                      Core::DoubleDouble, ComputeDistanceNoStaticMembers>,
+          prob_dim>
+          dd_solver(dd_xsi, checklimits_ref_);
+      dd_solver.setup(dd_xyze_side, dd_px, false);
+      if ((not dd_solver.solve()) or dd_solver.zero_area()) return false;
+
+      std::pair<bool, Core::DoubleDouble> cond_pair = dd_solver.condition_number();
+      if (not cond_pair.first) return false;
+
+      // difference between the point and the point given by the local coordinates and distance
+      const Core::LinAlg::Matrix<prob_dim, 2, Core::DoubleDouble>& n_vec =
+          dd_solver.get_normal_vector();
+      const Core::DoubleDouble* dd_distance = dd_solver.signed_distance();
+      Core::LinAlg::Matrix<num_nodes_side, 1, Core::DoubleDouble> surfaceFunct;
+      const Core::LinAlg::Matrix<dim_side, 1, Core::DoubleDouble> xsi_side(dd_xsi.data(), true);
+      Core::FE::shape_function<side_type>(xsi_side, surfaceFunct);
+      Core::LinAlg::Matrix<prob_dim, 1, Core::DoubleDouble> b(dd_px);
+      b.multiply(-1.0, dd_xyze_side, surfaceFunct, 1.0);
+      const Core::LinAlg::Matrix<prob_dim, 1, Core::DoubleDouble> n1(n_vec.data(), true);
+      b.update(-dd_distance[0] / n1.norm2(), n1, 1.0);
+      if (prob_dim == 3 and dim_side == 1)
+      {
+        const Core::LinAlg::Matrix<prob_dim, 1, Core::DoubleDouble> n2(
+            n_vec.data() + prob_dim, true);
+        b.update(-dd_distance[1] / n2.norm2(), n2, 1.0);
+      }
+      if (b.norm2() * cond_pair.second > CLN_LIMIT_ERROR) return false;
+
+      // take over the solution and update the linearization of the double strategy at it, which
+      // defines the local tolerances
+      for (unsigned i = 0; i < prob_dim; ++i) xsi_ref_(i) = dd_xsi(i).hi();
+      this->setup_step(1);
+      if (not get_topology_information()) return false;
+
+      distance = signeddistance ? dd_distance[0].hi() : dd_solver.distance().hi();
+      cond_infinity_ = false;
+      return true;
+    }
+
     // Evaluate difference between inital global coordinates passed to compute_distance and
     // and global coordinates based on loc coordinates and distance  calculated in the
     // compute_distance
@@ -4380,6 +4461,9 @@ namespace Cut::Kernel
 
         if (major_fail or result_fail)
         {
+#if DOUBLE_DOUBLE_BEFORE_CLN
+          if (compute_double_double(xyze_side, xyze_edge)) return true;
+#endif
 //             CutKernelStatistics::get_cut_kernel_statistics().cln_intersection_counter();
 #endif
           {
@@ -4531,6 +4615,59 @@ namespace Cut::Kernel
     }
 
 
+    // Repeat the Newton scheme in double-double arithmetic. If the error of its solution is below
+    // the limit of the cln computation, the solution replaces the double solution and the topology
+    // information is computed again. Otherwise false is returned and cln has to be used.
+    bool compute_double_double(const Core::LinAlg::Matrix<prob_dim, num_nodes_side>& xyze_side,
+        const Core::LinAlg::Matrix<prob_dim, num_nodes_edge>& xyze_edge)
+    {
+      Core::LinAlg::Matrix<prob_dim, num_nodes_side, Core::DoubleDouble> dd_xyze_side;
+      for (unsigned i = 0; i < prob_dim * num_nodes_side; ++i)
+        dd_xyze_side.data()[i] = xyze_side.data()[i];
+      Core::LinAlg::Matrix<prob_dim, num_nodes_edge, Core::DoubleDouble> dd_xyze_edge;
+      for (unsigned i = 0; i < prob_dim * num_nodes_edge; ++i)
+        dd_xyze_edge.data()[i] = xyze_edge.data()[i];
+
+      Core::LinAlg::Matrix<dim_edge + dim_side, 1, Core::DoubleDouble> dd_xsi;
+      NewtonSolve<ComputeIntersectionStrategy<false, prob_dim, edge_type, side_type, dim_edge,
+                      dim_side, num_nodes_edge, num_nodes_side, Core::DoubleDouble,
+                      ComputeIntersectionNoStaticMembers>,
+          dim_edge + dim_side>
+          dd_solver(dd_xsi, checklimits_);
+      dd_solver.setup(dd_xyze_side, dd_xyze_edge);
+      if (not dd_solver.solve()) return false;
+
+      std::pair<bool, Core::DoubleDouble> cond_pair = dd_solver.condition_number();
+      if (not cond_pair.first) return false;
+
+      // difference between the global coordinates based on the side and based on the edge
+      const Core::LinAlg::Matrix<dim_side, 1, Core::DoubleDouble> xsi_side(dd_xsi.data(), true);
+      const Core::LinAlg::Matrix<dim_edge, 1, Core::DoubleDouble> xsi_edge(
+          dd_xsi.data() + dim_side, true);
+      Core::LinAlg::Matrix<num_nodes_side, 1, Core::DoubleDouble> sideFunct;
+      Core::LinAlg::Matrix<num_nodes_edge, 1, Core::DoubleDouble> edgeFunct;
+      Core::FE::shape_function<side_type>(xsi_side, sideFunct);
+      Core::FE::shape_function<edge_type>(xsi_edge, edgeFunct);
+      Core::LinAlg::Matrix<prob_dim, 1, Core::DoubleDouble> diffVec;
+      diffVec.multiply(dd_xyze_edge, edgeFunct);
+      diffVec.multiply(-1.0, dd_xyze_side, sideFunct, 1.0);
+      Core::DoubleDouble error = 0.0;
+      for (unsigned int i = 0; i < (dim_edge + dim_side); ++i) error += diffVec(i) * diffVec(i);
+      error = Core::MathOperations<Core::DoubleDouble>::sqrt(error) * cond_pair.second;
+      if (error > CLN_LIMIT_ERROR) return false;
+
+      // take over the solution and update the linearization of the double strategy at it, which
+      // defines the local tolerances
+      for (unsigned i = 0; i < dim_edge + dim_side; ++i) xsi_(i) = dd_xsi(i).hi();
+      this->setup_step(1);
+      if (not get_topology_information()) return false;
+
+      if (prob_dim > dim_edge + dim_side)
+        distance_between_ = dd_solver.distance_between().hi();
+      cond_infinity_ = false;
+      return true;
+    }
+
     // Evaluate difference between global coordinates in the intersection when computed based on
     // side and based on edge
     double compute_error(const Core::LinAlg::Matrix<prob_dim, num_nodes_side>& side_xyz,
@@ -8,6 +8,7 @@
 #include "4C_cut_mesh.hpp"
 
 #include "4C_cut_boundarycell.hpp"
+#include "4C_cut_direct_divergence.hpp"
 #include "4C_cut_integrationcell.hpp"
 #include "4C_cut_levelsetside.hpp"
 #include "4C_cut_output.hpp"
@@ -17,10 +18,13 @@
 #include "4C_fem_discretization.hpp"
 #include "4C_fem_geometry_element_volume.hpp"
 #include "4C_fem_geometry_searchtree.hpp"
+#include "4C_utils_shared_memory_parallel.hpp"
 #include "4C_utils_shared_ptr_from_ref.hpp"
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <mutex>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*
@@ -1503,13 +1507,17 @@ void Cut::Mesh::moment_fit_gauss_weights(bool include_inner, Cut::BCellGaussPts
  *-------------------------------------------------------------------------------------*/
 void Cut::Mesh::direct_divergence_gauss_rule(bool include_inner, Cut::BCellGaussPts Bcellgausstype)
 {
+  // The divergence cells are generated element by element since facets are triangulated and
+  // boundary cells are created on the way.
+  std::vector<std::pair<VolumeCell*, std::shared_ptr<DirectDivergence>>> prepared_cells;
   for (std::map<int, std::shared_ptr<Element>>::iterator i = elements_.begin();
        i != elements_.end(); ++i)
   {
     Element& e = *i->second;
     try
     {
-      e.direct_divergence_gauss_rule(*this, include_inner, Bcellgausstype);
+      e.prepare_direct_divergence_gauss_rules(
+          *this, include_inner, Bcellgausstype, prepared_cells);
     }
     catch (Core::Exception& err)
     {
@@ -1523,7 +1531,8 @@ void Cut::Mesh::direct_divergence_gauss_rule(bool include_inner, Cut::BCellGauss
     Element& e = *i->second;
     try
     {
-      e.direct_divergence_gauss_rule(*this, include_inner, Bcellgausstype);
+      e.prepare_direct_divergence_gauss_rules(
+          *this, include_inner, Bcellgausstype, prepared_cells);
     }
     catch (Core::Exception& err)
     {
@@ -1531,6 +1540,35 @@ void Cut::Mesh::direct_divergence_gauss_rule(bool include_inner, Cut::BCellGauss
       throw;
     }
   }
+
+  // The main and internal Gauss points and their projection to the local coordinates of the
+  // element only modify the respective volumecell. This is the expensive part and done
+  // thread-parallel. Only the first failing thread writes the debug output.
+  std::mutex debug_dump_mutex;
+  bool debug_dump_written = false;
+  Core::Utils::parallel_for(static_cast<int>(prepared_cells.size()), Core::Utils::max_threads(),
+      [&](int i)
+      {
+        auto& [cell, dd] = prepared_cells[i];
+        try
+        {
+          cell->evaluate_direct_divergence_gauss_rule(*dd);
+        }
+        catch (Core::Exception& err)
+        {
+          std::lock_guard<std::mutex> lock(debug_dump_mutex);
+          if (not debug_dump_written) debug_dump(cell->parent_element(), __FILE__, __LINE__);
+          debug_dump_written = true;
+          throw;
+        }
+      });
+
+  for (const auto& [cell, dd] : prepared_cells)
+  {
+    if (cell->is_negligibly_small())
+      std::cout << "----WARNING:::negligible volumecell parent id = "
+                << cell->parent_element()->id() << "---------------" << std::endl;
+  }
 }
 
 
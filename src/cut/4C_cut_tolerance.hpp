@@ -108,6 +108,12 @@
 // whether we run on double + (soemtimes) cln or double + (always) cln
 #define DOUBLE_PLUS_CLN_COMPUTE true
 
+// tolerance of the Newton scheme in double-double arithmetic, analogous to LINSOLVETOL
+#define DOUBLE_DOUBLE_LINSOLVETOL (1e-30 / sqrt(3) * 10.0)
+
+// whether a double-double computation is tried before cln in the cut_kernel
+#define DOUBLE_DOUBLE_BEFORE_CLN true
+
 // global tolerance for detecting sides near the point in the cut_kernel
 #define SIDE_DETECTION_TOLERANCE 1e-14
 
@@ -1482,6 +1482,22 @@ is identified which will be used to find the modified integral in fluid integrat
 *----------------------------------------------------------------------------------------------------------------*/
 void Cut::VolumeCell::direct_divergence_gauss_rule(
     Element* elem, Mesh& mesh, bool include_inner, Cut::BCellGaussPts BCellgausstype)
+{
+  std::shared_ptr<DirectDivergence> dd =
+      prepare_direct_divergence_gauss_rule(elem, mesh, include_inner, BCellgausstype);
+  if (not dd) return;
+
+  evaluate_direct_divergence_gauss_rule(*dd);
+  if (is_negligible_small_)
+    std::cout << "----WARNING:::negligible volumecell parent id = " << elem->id()
+              << "---------------" << std::endl;
+}
+
+/*---------------------------------------------------------------------------------------------------------------*
+ * Divergence cells on the facets and boundary cells of the volumecell
+ *----------------------------------------------------------------------------------------------------------------*/
+std::shared_ptr<Cut::DirectDivergence> Cut::VolumeCell::prepare_direct_divergence_gauss_rule(
+    Element* elem, Mesh& mesh, bool include_inner, Cut::BCellGaussPts BCellgausstype)
 {
   if (elem->shape() != Core::FE::CellType::hex8 && elem->shape() != Core::FE::CellType::hex20)
     FOUR_C_THROW("direct_divergence_gauss_rule: Just hex8 and hex20 avaiable yet in DD!");
@@ -1504,7 +1520,7 @@ void Cut::VolumeCell::direct_divergence_gauss_rule(
 
   // if the volumecell is inside and includeinner is false, no need to compute the Gaussian points
   // as this vc will never be computed in xfem algorithm
-  if (position() == Point::inside and include_inner == false) return;
+  if (position() == Point::inside and include_inner == false) return nullptr;
 
   // If the Volume Cell consists of less than 4 facets, it can't span a volume in 3D.
   if (facets().size() < 4)
@@ -1515,12 +1531,26 @@ void Cut::VolumeCell::direct_divergence_gauss_rule(
   is_negligible_small_ = false;
 
 
-  DirectDivergence dd(this, elem, position(), mesh);
+  std::shared_ptr<DirectDivergence> dd =
+      std::make_shared<DirectDivergence>(this, elem, position(), mesh);
 
   ref_eqn_plane_.reserve(4);  // it has to store a,b,c,d in ax+by+cz=d
 
-  std::shared_ptr<Core::FE::GaussPoints> gp =
-      dd.vc_integration_rule(ref_eqn_plane_);  // compute main gauss points
+  dd->divergence_cells(ref_eqn_plane_);  // triangulate facets and create divergence cells
+
+  // generate boundary cells -- when using tessellation this is automatically done
+  generate_boundary_cells(mesh, position(), elem, 0, BCellgausstype);
+
+  return dd;
+}
+
+/*---------------------------------------------------------------------------------------------------------------*
+ * Main and internal gauss points of the volumecell from the divergence cells on the facets
+ *----------------------------------------------------------------------------------------------------------------*/
+void Cut::VolumeCell::evaluate_direct_divergence_gauss_rule(DirectDivergence& dd)
+{
+  std::shared_ptr<Core::FE::GaussPoints> gp = dd.main_gauss_rule();  // compute main gauss points
+
   gp_ =
       generate_internal_gauss_rule(gp);  // compute internal gauss points for every main gauss point
 
@@ -1551,8 +1581,6 @@ void Cut::VolumeCell::direct_divergence_gauss_rule(
     project_gauss_points_to_local_coodinates();
 #endif
   }
-  // generate boundary cells -- when using tessellation this is automatically done
-  generate_boundary_cells(mesh, position(), elem, 0, BCellgausstype);
 }
 
 /*----------------------------------------------------------------------------------------------------*
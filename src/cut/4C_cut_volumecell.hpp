@@ -23,6 +23,7 @@ namespace Cut
   class Facet;
   class Element;
   class BoundaryCell;
+  class DirectDivergence;
   class IntegrationCell;
   class IntegrationCellCreator;
   class Mesh;
@@ -94,6 +95,22 @@ namespace Cut
     void direct_divergence_gauss_rule(Element* elem, Mesh& mesh, bool include_inner,
         Cut::BCellGaussPts BCellgausstype = Cut::BCellGaussPts_Tessellation);
 
+    /*!
+    \brief First part of direct_divergence_gauss_rule(): divergence cells on the facets and
+    boundarycells. This triangulates facets and adds boundarycells to the mesh. Returns nullptr if
+    no integration rule is needed for this volumecell.
+     */
+    std::shared_ptr<DirectDivergence> prepare_direct_divergence_gauss_rule(Element* elem,
+        Mesh& mesh, bool include_inner,
+        Cut::BCellGaussPts BCellgausstype = Cut::BCellGaussPts_Tessellation);
+
+    /*!
+    \brief Second part of direct_divergence_gauss_rule(): main Gauss points on the divergence
+    cells of @p dd, internal Gauss points, volume check and projection to local coordinates. Only
+    this volumecell is modified, so this may run concurrently for different volumecells.
+     */
+    void evaluate_direct_divergence_gauss_rule(DirectDivergence& dd);
+
     /*!
     \brief Project the integration rule generated w.r to the global coordinates of the element to
     its local coordinate system
@@ -0,0 +1,162 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_fsi_nox_iqnils.hpp"
+
+#include <NOX_Abstract_Group.H>
+#include <NOX_Abstract_Vector.H>
+#include <NOX_GlobalData.H>
+#include <Teuchos_ParameterList.hpp>
+
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+NOX::FSI::QuasiNewtonILS::QuasiNewtonILS(
+    const Teuchos::RCP<::NOX::Utils>& utils, Teuchos::ParameterList& params)
+    : utils_(utils), step_(0)
+{
+  Teuchos::ParameterList& iqnparams = params.sublist("IQN-ILS");
+  omega_ = iqnparams.get("omega", 1.0);
+  reuse_steps_ = iqnparams.get("reuse steps", 0);
+  max_columns_ = iqnparams.get("max columns", 0);
+  filter_tol_ = iqnparams.get("filter tolerance", 1e-8);
+}
+
+
+
+bool NOX::FSI::QuasiNewtonILS::reset(
+    const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& params)
+{
+  // A new nonlinear solve, i.e. a new time step, starts. There are no
+  // differences to the previous coupling iteration yet.
+  step_ += 1;
+  old_residual_ = Teuchos::null;
+  old_x_tilde_ = Teuchos::null;
+  drop_old_secant_pairs();
+
+  utils_ = gd->getUtils();
+  return true;
+}
+
+
+bool NOX::FSI::QuasiNewtonILS::compute(::NOX::Abstract::Vector& dir,
+    ::NOX::Abstract::Group& group, const ::NOX::Solver::Generic& solver)
+{
+  ::NOX::Abstract::Group::ReturnType status;
+
+  // Compute F at current solution
+  status = group.computeF();
+  if (status != ::NOX::Abstract::Group::Ok) throw_error("compute", "Unable to compute F");
+
+  const ::NOX::Abstract::Vector& x = group.getX();
+  const ::NOX::Abstract::Vector& r = group.getF();
+
+  // result of the field sweep
+  Teuchos::RCP<::NOX::Abstract::Vector> x_tilde = x.clone();
+  x_tilde->update(1.0, r, 1.0);
+
+  // new secant pair from the differences to the previous coupling iteration
+  if (old_residual_ != Teuchos::null)
+  {
+    SecantPair secant;
+    secant.v = r.clone();
+    secant.v->update(-1.0, *old_residual_, 1.0);
+    secant.w = x_tilde->clone();
+    secant.w->update(-1.0, *old_x_tilde_, 1.0);
+    secant.step = step_;
+    secants_.push_front(secant);
+    drop_old_secant_pairs();
+  }
+  old_residual_ = r.clone();
+  old_x_tilde_ = x_tilde;
+
+  // QR decomposition of V by modified Gram-Schmidt. Columns that are
+  // (nearly) linearly dependent on newer ones are removed on the fly.
+  std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> q;
+  std::vector<std::vector<double>> rcols;
+  for (auto secant = secants_.begin(); secant != secants_.end();)
+  {
+    Teuchos::RCP<::NOX::Abstract::Vector> y = secant->v->clone();
+    const double norm = y->norm();
+
+    std::vector<double> rcol(q.size() + 1);
+    for (std::size_t j = 0; j < q.size(); ++j)
+    {
+      rcol[j] = y->innerProduct(*q[j]);
+      y->update(-rcol[j], *q[j], 1.0);
+    }
+    rcol.back() = y->norm();
+
+    if (norm == 0.0 or rcol.back() < filter_tol_ * norm)
+    {
+      secant = secants_.erase(secant);
+      continue;
+    }
+
+    y->scale(1.0 / rcol.back());
+    q.push_back(y);
+    rcols.push_back(rcol);
+    ++secant;
+  }
+
+  const int numcols = static_cast<int>(q.size());
+
+  if (utils_->isPrintType(::NOX::Utils::InnerIteration))
+  {
+    utils_->out() << "IQN-ILS:  secant pairs=" << numcols << "  step=" << step_ << std::endl;
+  }
+
+  if (numcols == 0)
+  {
+    // no information about the Jacobian yet, simple relaxation
+    dir.update(omega_, r, 0.0);
+    return true;
+  }
+
+  // solve R c = -Q^T r by back substitution, R(i,j) = rcols[j][i]
+  std::vector<double> c(numcols);
+  for (int i = numcols - 1; i >= 0; --i)
+  {
+    double ci = -r.innerProduct(*q[i]);
+    for (int j = i + 1; j < numcols; ++j) ci -= rcols[j][i] * c[j];
+    c[i] = ci / rcols[i][i];
+  }
+
+  // d = r + W c
+  dir.update(1.0, r, 0.0);
+  for (int i = 0; i < numcols; ++i) dir.update(c[i], *secants_[i].w, 1.0);
+
+  return true;
+}
+
+
+bool NOX::FSI::QuasiNewtonILS::compute(::NOX::Abstract::Vector& dir,
+    ::NOX::Abstract::Group& group, const ::NOX::Solver::LineSearchBased& solver)
+{
+  return ::NOX::Direction::Generic::compute(dir, group, solver);
+}
+
+
+void NOX::FSI::QuasiNewtonILS::drop_old_secant_pairs()
+{
+  while (!secants_.empty() and secants_.back().step < step_ - reuse_steps_) secants_.pop_back();
+
+  if (max_columns_ > 0)
+    while (static_cast<int>(secants_.size()) > max_columns_) secants_.pop_back();
+}
+
+
+void NOX::FSI::QuasiNewtonILS::throw_error(
+    const std::string& functionName, const std::string& errorMsg)
+{
+  if (utils_->isPrintType(::NOX::Utils::Error))
+    utils_->err() << "QuasiNewtonILS::" << functionName << " - " << errorMsg << std::endl;
+  throw "NOX Error";
+}
+
+FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,170 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_FSI_NOX_IQNILS_HPP
+#define FOUR_C_FSI_NOX_IQNILS_HPP
+
+#include "4C_config.hpp"
+
+#include <NOX_Abstract_Vector.H>
+#include <NOX_Direction_Generic.H>  // base class
+#include <NOX_Direction_UserDefinedFactory.H>
+#include <NOX_GlobalData.H>
+#include <NOX_Utils.H>
+#include <Teuchos_RCP.hpp>
+
+#include <deque>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace NOX
+{
+  namespace FSI
+  {
+    //! %Interface quasi-Newton with inverse Jacobian from a least-squares model (IQN-ILS).
+    /*!
+
+      With the interface displacement \f$x^k\f$ and the result of one
+      sweep over the fields \f$\tilde{x}^k = x^k + r^k\f$, every
+      coupling iteration adds the secant pair
+      \f[
+      v = r^k - r^{k-1}, \quad w = \tilde{x}^k - \tilde{x}^{k-1}
+      \f]
+      to the matrices \f$V\f$ and \f$W\f$. The new interface displacement
+      is \f$x^{k+1} = \tilde{x}^k + W c\f$, where \f$c\f$ solves the
+      least-squares problem \f$\min \|V c + r^k\|\f$. That is the
+      direction is
+      \f[
+      d = r^k + W c.
+      \f]
+
+      The least-squares problem is solved with a QR decomposition of
+      \f$V\f$ by modified Gram-Schmidt. Secant pairs that are nearly
+      linearly dependent on newer ones are removed while the
+      decomposition is computed (QR1 filter). If there is no secant pair
+      yet, a fixed relaxation \f$d = \omega r^k\f$ is used.
+
+      The secant pairs of the last time steps are kept and reused in the
+      following time steps. This gives a good Jacobian approximation
+      already in the first coupling iteration of a time step and
+      typically reduces the number of coupling iterations considerably
+      compared to Aitken relaxation. The secant pairs are not written on
+      restart, i.e. the history starts empty after a restart.
+
+      To be used with the full step line search.
+
+    <h2>Parameters</h2>
+
+      - "omega" - fixed relaxation parameter if there is no secant pair
+                  (defaults to 1.0)
+
+      - "reuse steps" - number of previous time steps whose secant pairs
+                        are reused (defaults to 0)
+
+      - "max columns" - maximum number of secant pairs, the oldest ones
+                        are removed first (0 means no constraint,
+                        defaults to 0)
+
+      - "filter tolerance" - secant pairs whose orthogonalized residual
+                             difference is smaller than this tolerance
+                             times its original norm are removed
+                             (defaults to 1e-8)
+
+    <h2>References</h2>
+
+    J. Degroote, K.-J. Bathe, J. Vierendeels: Performance of a new
+    partitioned procedure versus a monolithic procedure in
+    fluid-structure interaction. Computers & Structures 87(11): 793-801,
+    2009. doi:10.1016/j.compstruc.2008.11.013
+    */
+    class QuasiNewtonILS : public ::NOX::Direction::Generic
+    {
+     public:
+      //! Constructor
+      QuasiNewtonILS(const Teuchos::RCP<::NOX::Utils>& utils, Teuchos::ParameterList& params);
+
+
+      // derived
+      bool reset(
+          const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& params) override;
+
+      // derived
+      bool compute(::NOX::Abstract::Vector& dir, ::NOX::Abstract::Group& group,
+          const ::NOX::Solver::Generic& solver) override;
+
+      // derived
+      bool compute(::NOX::Abstract::Vector& dir, ::NOX::Abstract::Group& group,
+          const ::NOX::Solver::LineSearchBased& solver) override;
+
+      //! number of secant pairs currently stored
+      int num_secant_pairs() const { return static_cast<int>(secants_.size()); }
+
+     private:
+      //! remove secant pairs of time steps that are too old and those beyond the maximum number
+      void drop_old_secant_pairs();
+
+      //! Print error message and throw error
+      void throw_error(const std::string& functionName, const std::string& errorMsg);
+
+     private:
+      //! One column of V and W together with the time step it was computed in
+      struct SecantPair
+      {
+        Teuchos::RCP<::NOX::Abstract::Vector> v;
+        Teuchos::RCP<::NOX::Abstract::Vector> w;
+        int step;
+      };
+
+      //! Printing Utils
+      Teuchos::RCP<::NOX::Utils> utils_;
+
+      //! secant pairs, the newest first
+      std::deque<SecantPair> secants_;
+
+      //! residual of the previous coupling iteration in this time step
+      Teuchos::RCP<::NOX::Abstract::Vector> old_residual_;
+
+      //! field sweep result of the previous coupling iteration in this time step
+      Teuchos::RCP<::NOX::Abstract::Vector> old_x_tilde_;
+
+      //! counter of the time steps, i.e. of the nonlinear solves
+      int step_;
+
+      double omega_;
+      int reuse_steps_;
+      int max_columns_;
+      double filter_tol_;
+    };
+
+    /// simple factory that creates the IQN-ILS direction object
+    /*!
+      The direction object is kept such that its secant pairs survive
+      the nonlinear solver of a time step.
+     */
+    class QuasiNewtonILSFactory : public ::NOX::Direction::UserDefinedFactory
+    {
+     public:
+      Teuchos::RCP<::NOX::Direction::Generic> buildDirection(
+          const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& params) const override
+      {
+        if (iqnils_ == Teuchos::null)
+          iqnils_ = Teuchos::make_rcp<QuasiNewtonILS>(gd->getUtils(), params);
+        else
+          iqnils_->reset(gd, params);
+        return iqnils_;
+      }
+
+     private:
+      mutable Teuchos::RCP<QuasiNewtonILS> iqnils_;
+    };
+
+  }  // namespace FSI
+}  // namespace NOX
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -17,7 +17,9 @@
 #include "4C_inpar_problemtype.hpp"
 #include "4C_inpar_validparameters.hpp"
 #include "4C_io.hpp"
+#include "4C_io_asynchronous_output.hpp"
 #include "4C_io_control.hpp"
+#include "4C_io_hdf_shared_file.hpp"
 #include "4C_io_input_file_utils.hpp"
 #include "4C_mat_materialdefinition.hpp"
 #include "4C_rebalance_graph_based.hpp"
@@ -138,6 +140,22 @@ void Global::Problem::open_control_file(const Epetra_Comm& comm, const std::stri
       spatial_approximation_type(), inputfile, restartkenner, std::move(prefix), n_dim(), restart(),
       io_params().get<int>("FILESTEPS"), io_params().get<bool>("OUTPUT_BIN"), true);
 
+  if (io_params().get<bool>("HDF5_SHARED_FILE"))
+  {
+    if (!Core::IO::hdf5_supports_shared_files())
+      FOUR_C_THROW("HDF5_SHARED_FILE requires an HDF5 library with MPI support.");
+    // collective MPI-IO calls cannot be issued from the background output thread
+    if (io_params().get<bool>("ASYNCHRONOUS_OUTPUT"))
+      FOUR_C_THROW("HDF5_SHARED_FILE cannot be combined with ASYNCHRONOUS_OUTPUT.");
+    const int compression_level = io_params().get<int>("HDF5_COMPRESSION_LEVEL");
+    if (compression_level < 0 or compression_level > 9)
+      FOUR_C_THROW("HDF5_COMPRESSION_LEVEL must be between 0 and 9, got %d.", compression_level);
+    outputcontrol_->set_shared_hdf5_file(true, compression_level);
+  }
+
+  Core::IO::AsynchronousOutput::instance().set_enabled(
+      io_params().get<bool>("OUTPUT_BIN") and io_params().get<bool>("ASYNCHRONOUS_OUTPUT"));
+
   if (!io_params().get<bool>("OUTPUT_BIN") && Core::Communication::my_mpi_rank(comm) == 0)
   {
     Core::IO::cout << "==================================================\n"
@@ -1919,6 +1919,8 @@ void Global::read_parameter(Global::Problem& problem, Core::IO::InputFile& input
   Core::IO::read_parameters_in_section(input, "STRUCT NOX/Direction", *list);
   Core::IO::read_parameters_in_section(input, "STRUCT NOX/Direction/Newton", *list);
   Core::IO::read_parameters_in_section(input, "STRUCT NOX/Direction/Newton/Modified", *list);
+  Core::IO::read_parameters_in_section(
+      input, "STRUCT NOX/Direction/Newton/Jacobian Reuse", *list);
   Core::IO::read_parameters_in_section(input, "STRUCT NOX/Direction/Newton/Linear Solver", *list);
   Core::IO::read_parameters_in_section(input, "STRUCT NOX/Direction/Steepest Descent", *list);
   Core::IO::read_parameters_in_section(input, "STRUCT NOX/Line Search", *list);
@@ -44,9 +44,13 @@ namespace Inpar
 
       // data format for written numeric data
       setStringToIntegralParameter<Core::IO::OutputDataFormat>("OUTPUT_DATA_FORMAT", "binary",
-          "data format for written numeric data", tuple<std::string>("binary", "ascii"),
-          tuple<Core::IO::OutputDataFormat>(
-              Core::IO::OutputDataFormat::binary, Core::IO::OutputDataFormat::ascii),
+          "data format for written numeric data. The appended formats write all data as "
+          "compressed raw binary data at the end of each file, which is smaller and faster to "
+          "write. appended_lz4 requires 4C to be built with LZ4.",
+          tuple<std::string>("binary", "ascii", "appended_zlib", "appended_lz4"),
+          tuple<Core::IO::OutputDataFormat>(Core::IO::OutputDataFormat::binary,
+              Core::IO::OutputDataFormat::ascii, Core::IO::OutputDataFormat::appended_zlib,
+              Core::IO::OutputDataFormat::appended_lz4),
           &sublist_IO_VTK_structure);
 
       // specify the maximum digits in the number of time steps that shall be written
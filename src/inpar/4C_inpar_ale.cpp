@@ -71,6 +71,9 @@ void Inpar::ALE::set_valid_parameters(Teuchos::ParameterList& list)
   // linear solver id used for scalar ale problems
   Core::Utils::int_parameter(
       "LINEAR_SOLVER", -1, "number of linear solver used for ale problems...", &adyn);
+
+  Core::Utils::int_parameter("NUM_EVALUATION_THREADS", 1,
+      "number of threads per rank used to evaluate the ale elements (requires OpenMP)", &adyn);
 }
 
 
@@ -22,8 +22,8 @@ void Inpar::FSI::set_valid_parameters(Teuchos::ParameterList& list)
       "Fluid Structure Interaction\n"
       "FSI solver with various coupling methods");
 
-  Teuchos::Tuple<std::string, 21> name;
-  Teuchos::Tuple<FsiCoupling, 21> label;
+  Teuchos::Tuple<std::string, 22> name;
+  Teuchos::Tuple<FsiCoupling, 22> label;
 
   name[0] = "basic_sequ_stagg";
   label[0] = fsi_basic_sequ_stagg;
@@ -67,6 +67,8 @@ void Inpar::FSI::set_valid_parameters(Teuchos::ParameterList& list)
   label[19] = fsi_iter_sliding_monolithicstructuresplit;
   name[20] = "iter_mortar_monolithicfluidsplit_saddlepoint";
   label[20] = fsi_iter_mortar_monolithicfluidsplit_saddlepoint;
+  name[21] = "iter_stagg_IQNILS";
+  label[21] = fsi_iter_stagg_IQNILS;
 
 
   setStringToIntegralParameter<FsiCoupling>("COUPALGO", "iter_stagg_AITKEN_rel_param",
@@ -377,6 +379,16 @@ void Inpar::FSI::set_valid_parameters(Teuchos::ParameterList& list)
   Core::Utils::bool_parameter("DIVPROJECTION", "no",
       "Project velocity into divergence-free subspace for partitioned fsi", &fsipart);
 
+  Core::Utils::double_parameter("IQN_FILTER_TOL", 1e-8,
+      "Relative tolerance for removing nearly linearly dependent secant pairs in IQN-ILS",
+      &fsipart);
+
+  Core::Utils::int_parameter("IQN_MAX_COLUMNS", 50,
+      "Maximum number of secant pairs kept by IQN-ILS (0 means no constraint)", &fsipart);
+
+  Core::Utils::int_parameter("IQN_REUSE_STEPS", 8,
+      "Number of previous time steps whose secant pairs are reused by IQN-ILS", &fsipart);
+
   Core::Utils::int_parameter("ITEMAX", 100, "Maximum number of iterations over fields", &fsipart);
 
   Core::Utils::double_parameter("MAXOMEGA", 0.0,
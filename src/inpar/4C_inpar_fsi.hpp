@@ -56,7 +56,8 @@ typedef enum FsiCoupling
   fsi_iter_fluidfluid_monolithicfluidsplit_nonox,
   fsi_iter_sliding_monolithicfluidsplit,
   fsi_iter_sliding_monolithicstructuresplit,
-  fsi_iter_mortar_monolithicfluidsplit_saddlepoint
+  fsi_iter_mortar_monolithicfluidsplit_saddlepoint,
+  fsi_iter_stagg_IQNILS /*!< interface quasi-Newton with least-squares Jacobian approximation */
 } FSI_COUPLING;
 
 namespace Inpar
@@ -108,6 +108,17 @@ void Inpar::IO::set_valid_parameters(Teuchos::ParameterList& list)
 
   Core::Utils::int_parameter(
       "FILESTEPS", 1000, "Amount of timesteps written to a single result file", &io);
+  Core::Utils::bool_parameter("ASYNCHRONOUS_OUTPUT", "No",
+      "Write the binary result and restart data in a background thread while the computation "
+      "continues. The control file may refer to data that is not yet written if the simulation "
+      "is aborted.",
+      &io);
+  Core::Utils::bool_parameter("HDF5_SHARED_FILE", "No",
+      "Write the binary result data of all processors into one shared file via MPI-IO instead of "
+      "one file per processor. Requires an HDF5 library with MPI support.",
+      &io);
+  Core::Utils::int_parameter("HDF5_COMPRESSION_LEVEL", 0,
+      "Deflate level (0-9) of the datasets in shared result files. 0 disables compression.", &io);
   Core::Utils::int_parameter("STDOUTEVRY", 1, "Print to screen every n step", &io);
 
   Core::Utils::bool_parameter("WRITE_TO_SCREEN", "Yes", "Write screen output", &io);
@@ -71,6 +71,11 @@ void Inpar::PARTICLE::set_valid_parameters(Teuchos::ParameterList& list)
   Core::Utils::bool_parameter(
       "TRANSFER_EVERY", "no", "transfer particles to new bins every time step", &particledyn);
 
+  // skin distance of verlet lists of candidate particle pairs
+  Core::Utils::double_parameter("VERLET_SKIN", 0.0,
+      "skin distance of verlet lists of candidate particle pairs (no verlet lists if not positive)",
+      &particledyn);
+
   // considered particle phases with dynamic load balance weighting factor
   Core::Utils::string_parameter("PHASE_TO_DYNLOADBALFAC", "none",
       "considered particle phases with dynamic load balance weighting factor", &particledyn);
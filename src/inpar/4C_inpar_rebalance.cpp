@@ -33,6 +33,11 @@ void Inpar::Rebalance::set_valid_parameters(Teuchos::ParameterList& list)
       "Tolerance for relative imbalance of subdomain sizes for graph partitioning of unstructured "
       "meshes read from input files.",
       &meshpartitioning);
+
+  Core::Utils::bool_parameter("PARALLEL_READ", "No",
+      "Read elements and nodes of meshes in input files on all processors instead of reading "
+      "them on processor 0 and distributing them in blocks.",
+      &meshpartitioning);
 }
 
 FOUR_C_NAMESPACE_CLOSE
@@ -107,6 +107,23 @@ void Inpar::NlnSol::set_valid_parameters(Teuchos::ParameterList& list)
         &modnewton);
   }
 
+  // sub-sub-sub-list "Jacobian Reuse"
+  Teuchos::ParameterList& jacreuse = newton.sublist("Jacobian Reuse", false, "");
+  {
+    Core::Utils::bool_parameter("Reuse Jacobian", "No",
+        "Keep the jacobian of previous iterations as long as the residual contracts fast "
+        "enough (modified Newton).",
+        &jacreuse);
+
+    Core::Utils::double_parameter("Max Contraction Rate", 0.5,
+        "The jacobian is recomputed, if the ratio of two consecutive residual norms exceeds "
+        "this value.",
+        &jacreuse);
+
+    Core::Utils::int_parameter("Max Number of Reuses", 10,
+        "Maximal number of consecutive iterations with the same jacobian.", &jacreuse);
+  }
+
   // sub-list "Pseudo Transient"
   Teuchos::ParameterList& ptc = snox.sublist("Pseudo Transient", false, "");
 
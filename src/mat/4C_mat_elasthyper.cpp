@@ -171,6 +171,10 @@ void Mat::ElastHyper::unpack(Core::Communication::UnpackBuffer& buffer)
       p->unpack_summand(buffer);
       p->register_anisotropy_extensions(anisotropy_);
     }
+
+    // the compiled kernel of the summand combination is not communicated
+    summandProperties_.invariantDerivativesKernel =
+        elast_hyper_invariant_derivatives_kernel(potsum_);
   }
 }
 
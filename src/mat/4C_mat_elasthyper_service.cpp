@@ -12,10 +12,90 @@
 #include "4C_linalg_fixedsizematrix_voigt_notation.hpp"
 #include "4C_linalg_utils_densematrix_eigen.hpp"
 #include "4C_linalg_vector.hpp"
+#include "4C_mat_elast_coupanisoexpo.hpp"
+#include "4C_mat_elast_coupneohooke.hpp"
+#include "4C_mat_elast_isoneohooke.hpp"
+#include "4C_mat_elast_volsussmanbathe.hpp"
 #include "4C_mat_service.hpp"
 
+#include <typeinfo>
+#include <utility>
+
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  /*!
+   * \brief Invariant derivatives of a fixed combination of summands
+   *
+   * The summands are cast to their exact types, such that all calls are statically bound and the
+   * derivatives of summands defined inline are fused into one kernel.
+   */
+  template <typename... Summands, std::size_t... i>
+  void evaluate_invariant_derivatives_fused_impl(const Core::LinAlg::Matrix<3, 1>& prinv,
+      Core::LinAlg::Matrix<3, 1>& dPI, Core::LinAlg::Matrix<6, 1>& ddPII,
+      const std::vector<std::shared_ptr<Mat::Elastic::Summand>>& potsum,
+      const Mat::SummandProperties& properties, const int gp, const int eleGID,
+      std::index_sequence<i...>)
+  {
+    FOUR_C_ASSERT(potsum.size() == sizeof...(Summands),
+        "Kernel for %d summands called with %d summands", static_cast<int>(sizeof...(Summands)),
+        static_cast<int>(potsum.size()));
+
+    // derivatives of principal materials
+    if (properties.isoprinc)
+    {
+      (static_cast<Summands&>(*potsum[i]).Summands::add_derivatives_principal(
+           dPI, ddPII, prinv, gp, eleGID),
+          ...);
+    }
+
+    // derivatives of decoupled (volumetric or isochoric) materials
+    if (properties.isomod)
+    {
+      Core::LinAlg::Matrix<3, 1> modinv(false);
+      Core::LinAlg::Matrix<3, 1> dPmodI(true);
+      Core::LinAlg::Matrix<6, 1> ddPmodII(true);
+
+      // Evaluate modified invariants
+      Mat::invariants_modified(modinv, prinv);
+
+      (static_cast<Summands&>(*potsum[i]).Summands::add_derivatives_modified(
+           dPmodI, ddPmodII, modinv, gp, eleGID),
+          ...);
+
+      // convert decoupled derivatives to principal derivatives
+      Mat::convert_mod_to_princ(prinv, dPmodI, ddPmodII, dPI, ddPII);
+    }
+  }
+
+  template <typename... Summands>
+  void evaluate_invariant_derivatives_fused(const Core::LinAlg::Matrix<3, 1>& prinv,
+      Core::LinAlg::Matrix<3, 1>& dPI, Core::LinAlg::Matrix<6, 1>& ddPII,
+      const std::vector<std::shared_ptr<Mat::Elastic::Summand>>& potsum,
+      const Mat::SummandProperties& properties, const int gp, const int eleGID)
+  {
+    evaluate_invariant_derivatives_fused_impl<Summands...>(prinv, dPI, ddPII, potsum, properties,
+        gp, eleGID, std::index_sequence_for<Summands...>());
+  }
+
+  template <typename... Summands, std::size_t... i>
+  bool summands_match_impl(const std::vector<std::shared_ptr<Mat::Elastic::Summand>>& potsum,
+      std::index_sequence<i...>)
+  {
+    return ((typeid(*potsum[i]) == typeid(Summands)) and ...);
+  }
+
+  //! check whether the summands have exactly the given types in the given order
+  template <typename... Summands>
+  bool summands_match(const std::vector<std::shared_ptr<Mat::Elastic::Summand>>& potsum)
+  {
+    if (potsum.size() != sizeof...(Summands)) return false;
+
+    return summands_match_impl<Summands...>(potsum, std::index_sequence_for<Summands...>());
+  }
+}  // namespace
+
 void Mat::elast_hyper_evaluate(const Core::LinAlg::Matrix<3, 3>& defgrd,
     const Core::LinAlg::Matrix<6, 1>& glstrain, Teuchos::ParameterList& params,
     Core::LinAlg::Matrix<6, 1>& stress, Core::LinAlg::Matrix<6, 6>& cmat, const int gp, int eleGID,
@@ -92,6 +172,13 @@ void Mat::elast_hyper_evaluate_invariant_derivatives(const Core::LinAlg::Matrix<
     const std::vector<std::shared_ptr<Mat::Elastic::Summand>>& potsum,
     const SummandProperties& properties, const int gp, int eleGID)
 {
+  // compiled kernel for a known combination of summands
+  if (properties.invariantDerivativesKernel != nullptr)
+  {
+    properties.invariantDerivativesKernel(prinv, dPI, ddPII, potsum, properties, gp, eleGID);
+    return;
+  }
+
   // derivatives of principla materials
   if (properties.isoprinc)
   {
@@ -441,6 +528,33 @@ void Mat::elast_hyper_properties(const std::vector<std::shared_ptr<Mat::Elastic:
     properties.coeffStretchesPrinc |= p->have_coefficients_stretches_principal();
     properties.coeffStretchesMod |= p->have_coefficients_stretches_modified();
   }
+
+  properties.invariantDerivativesKernel = elast_hyper_invariant_derivatives_kernel(potsum);
+}
+
+Mat::ElastHyperInvariantDerivativesKernel Mat::elast_hyper_invariant_derivatives_kernel(
+    const std::vector<std::shared_ptr<Mat::Elastic::Summand>>& potsum)
+{
+  using Mat::Elastic::CoupAnisoExpo;
+  using Mat::Elastic::CoupNeoHooke;
+  using Mat::Elastic::IsoNeoHooke;
+  using Mat::Elastic::VolSussmanBathe;
+
+  if (summands_match<CoupNeoHooke>(potsum))
+    return &evaluate_invariant_derivatives_fused<CoupNeoHooke>;
+  if (summands_match<CoupNeoHooke, VolSussmanBathe>(potsum))
+    return &evaluate_invariant_derivatives_fused<CoupNeoHooke, VolSussmanBathe>;
+  if (summands_match<IsoNeoHooke, VolSussmanBathe>(potsum))
+    return &evaluate_invariant_derivatives_fused<IsoNeoHooke, VolSussmanBathe>;
+  if (summands_match<CoupNeoHooke, CoupAnisoExpo>(potsum))
+    return &evaluate_invariant_derivatives_fused<CoupNeoHooke, CoupAnisoExpo>;
+  if (summands_match<CoupNeoHooke, VolSussmanBathe, CoupAnisoExpo>(potsum))
+    return &evaluate_invariant_derivatives_fused<CoupNeoHooke, VolSussmanBathe, CoupAnisoExpo>;
+  if (summands_match<IsoNeoHooke, VolSussmanBathe, CoupAnisoExpo>(potsum))
+    return &evaluate_invariant_derivatives_fused<IsoNeoHooke, VolSussmanBathe, CoupAnisoExpo>;
+
+  // generic loop over all summands
+  return nullptr;
 }
 
 void Mat::elast_hyper_check_polyconvexity(const Core::LinAlg::Matrix<3, 3>& defgrd,
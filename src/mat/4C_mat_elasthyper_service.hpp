@@ -22,6 +22,15 @@ namespace Mat
   // Forward declaration
   class SummandProperties;
 
+  /*!
+   * \brief Kernel evaluating the first and second derivatives of a fixed combination of summands
+   * w.r.t. principal invariants
+   */
+  using ElastHyperInvariantDerivativesKernel = void (*)(const Core::LinAlg::Matrix<3, 1>& prinv,
+      Core::LinAlg::Matrix<3, 1>& dPI, Core::LinAlg::Matrix<6, 1>& ddPII,
+      const std::vector<std::shared_ptr<Mat::Elastic::Summand>>& potsum,
+      const SummandProperties& properties, int gp, int eleGID);
+
   /*!
    * \brief Evaluate the stress response and the elasticity tensor of an hyperelastic material
    *
@@ -336,6 +345,19 @@ namespace Mat
   void elast_hyper_properties(const std::vector<std::shared_ptr<Mat::Elastic::Summand>>& potsum,
       SummandProperties& properties);
 
+  /**
+   * \brief Select a compiled kernel for the invariant derivatives of the given summands
+   *
+   * Known combinations of summands (e.g. CoupNeoHooke or IsoNeoHooke with VolSussmanBathe and an
+   * optional CoupAnisoExpo) are evaluated by a kernel with statically bound and inlined summand
+   * calls. The summation order equals the one of the generic loop.
+   *
+   * @param potsum List of the summands
+   * @return Kernel for the combination of summands or nullptr if the combination is not known
+   */
+  ElastHyperInvariantDerivativesKernel elast_hyper_invariant_derivatives_kernel(
+      const std::vector<std::shared_ptr<Mat::Elastic::Summand>>& potsum);
+
   /**
    * \brief Check if material state is polyconvex
    *
@@ -408,6 +430,10 @@ namespace Mat
     bool viscoGeneral = false;
     //@}
 
+    ///< Compiled kernel for the invariant derivatives of the summands (not communicated, nullptr
+    ///< for the generic loop over all summands)
+    ElastHyperInvariantDerivativesKernel invariantDerivativesKernel = nullptr;
+
     /**
      * Pack all data to distribute it on other processors
      * @param data data where to store the values
@@ -451,6 +477,7 @@ namespace Mat
       coeffStretchesPrinc = false;
       coeffStretchesMod = false;
       viscoGeneral = false;
+      invariantDerivativesKernel = nullptr;
     }
 
     /**
@@ -466,6 +493,8 @@ namespace Mat
       coeffStretchesPrinc |= other.coeffStretchesPrinc;
       coeffStretchesMod |= other.coeffStretchesMod;
       viscoGeneral |= other.viscoGeneral;
+      // merged properties do not belong to a single combination of summands
+      invariantDerivativesKernel = nullptr;
     }
 
     /**
@@ -481,6 +510,7 @@ namespace Mat
       coeffStretchesPrinc = other.coeffStretchesPrinc;
       coeffStretchesMod = other.coeffStretchesMod;
       viscoGeneral = other.viscoGeneral;
+      invariantDerivativesKernel = other.invariantDerivativesKernel;
     }
   };
 }  // namespace Mat
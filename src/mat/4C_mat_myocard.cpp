@@ -450,6 +450,34 @@ double Mat::Myocard::rea_coeff_deriv(const double phi, const double dt, int gp)
 }
 
 
+/*----------------------------------------------------------------------*
+ | reaction coefficients and derivatives at all points                  |
+ *----------------------------------------------------------------------*/
+void Mat::Myocard::rea_coeff_and_deriv_all_gp(const std::vector<double>& phi, const double dt,
+    std::vector<double>& reacoeff, std::vector<double>& reacoeffderiv) const
+{
+  reacoeffderiv.assign(phi.size(), 0.0);
+
+  // evaluate perturbed state first, such that the internal state corresponds to phi afterwards
+  if (params_->dt_deriv != 0.0)
+  {
+    std::vector<double> phiperturbed(phi);
+    for (double& phiperturbed_gp : phiperturbed) phiperturbed_gp += params_->dt_deriv;
+    myocard_mat_->rea_coeff_all_gp(phiperturbed, dt * params_->time_scale, reacoeffderiv);
+  }
+
+  myocard_mat_->rea_coeff_all_gp(phi, dt * params_->time_scale, reacoeff);
+
+  for (std::size_t gp = 0; gp < phi.size(); ++gp)
+  {
+    reacoeff[gp] *= params_->time_scale;
+    if (params_->dt_deriv != 0.0)
+      reacoeffderiv[gp] =
+          (params_->time_scale * reacoeffderiv[gp] - reacoeff[gp]) / params_->dt_deriv;
+  }
+}
+
+
 /*----------------------------------------------------------------------*
  |  returns number of internal state variables              cbert 08/13 |
  *----------------------------------------------------------------------*/
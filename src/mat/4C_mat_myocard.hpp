@@ -208,6 +208,10 @@ namespace Mat
     /// compute reaction coefficient derivative for multiple points per element
     double rea_coeff_deriv(const double phi, const double dt, int gp) const;
 
+    /// compute reaction coefficients and their derivatives for all points of the element at once
+    void rea_coeff_and_deriv_all_gp(const std::vector<double>& phi, const double dt,
+        std::vector<double>& reacoeff, std::vector<double>& reacoeffderiv) const;
+
     /// compute Heaviside step function
     double gating_function(const double Gate1, const double Gate2, const double p, const double var,
         const double thresh) const;
@@ -72,6 +72,19 @@ double MyocardFitzhughNagumo::rea_coeff(const double phi, const double dt, int g
   return reacoeff;
 }
 
+void MyocardFitzhughNagumo::rea_coeff_all_gp(
+    const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff)
+{
+  if (static_cast<int>(phi.size()) > get_number_of_gp())
+    FOUR_C_THROW("Reaction coefficients requested for %d Gauss points, but only %d are stored",
+        static_cast<int>(phi.size()), get_number_of_gp());
+
+  // sweep over all Gauss points with statically bound calls on the per Gauss point state vectors
+  reacoeff.resize(phi.size());
+  for (int gp = 0; gp < static_cast<int>(phi.size()); ++gp)
+    reacoeff[gp] = MyocardFitzhughNagumo::rea_coeff(phi[gp], dt, gp);
+}
+
 /*----------------------------------------------------------------------*
  |  returns number of internal state variables of the material  cbert 08/13 |
  *----------------------------------------------------------------------*/
@@ -58,6 +58,10 @@ class MyocardFitzhughNagumo : public MyocardGeneral
   /// compute reaction coefficient for multiple points per element
   double rea_coeff(const double phi, const double dt, int gp) override;
 
+  /// compute reaction coefficients for all Gauss points at once
+  void rea_coeff_all_gp(const std::vector<double>& phi, const double dt,
+      std::vector<double>& reacoeff) override;
+
   ///  returns number of internal state variables of the material
   int get_number_of_internal_state_variables() const override;
 
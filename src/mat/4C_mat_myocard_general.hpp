@@ -13,6 +13,7 @@
 #include "4C_utils_exceptions.hpp"
 
 #include <string>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -44,6 +45,18 @@ class MyocardGeneral
   /// compute reaction coefficient
   virtual double rea_coeff(const double phi, const double dt) = 0;
 
+  /// compute reaction coefficients for all Gauss points of the material in one call
+  ///
+  /// This is the same loop over rea_coeff() of the single Gauss points as in the element, only
+  /// moved in front of the Gauss point loop of the element.
+  virtual void rea_coeff_all_gp(
+      const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff)
+  {
+    reacoeff.resize(phi.size());
+    for (int gp = 0; gp < static_cast<int>(phi.size()); ++gp)
+      reacoeff[gp] = rea_coeff(phi[gp], dt, gp);
+  };
+
   /// compute reaction coefficient at timestep n
   virtual double rea_coeff_n(const double phi, const double dt) { return 0; };
 
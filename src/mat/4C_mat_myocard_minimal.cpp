@@ -337,6 +337,20 @@ double MyocardMinimal::rea_coeff(const double phi, const double dt, int gp)
 }
 
 
+void MyocardMinimal::rea_coeff_all_gp(
+    const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff)
+{
+  if (static_cast<int>(phi.size()) > get_number_of_gp())
+    FOUR_C_THROW("Reaction coefficients requested for %d Gauss points, but only %d are stored",
+        static_cast<int>(phi.size()), get_number_of_gp());
+
+  // sweep over all Gauss points with statically bound calls on the per Gauss point state vectors
+  reacoeff.resize(phi.size());
+  for (int gp = 0; gp < static_cast<int>(phi.size()); ++gp)
+    reacoeff[gp] = MyocardMinimal::rea_coeff(phi[gp], dt, gp);
+}
+
+
 double MyocardMinimal::rea_coeff_n(const double phi, const double dt, int gp)
 {
   double reacoeff = 0.0;
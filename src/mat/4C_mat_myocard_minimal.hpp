@@ -57,6 +57,10 @@ class MyocardMinimal : public MyocardGeneral
   /// compute reaction coefficient for multiple points per element
   double rea_coeff(const double phi, const double dt, int gp) override;
 
+  /// compute reaction coefficients for all Gauss points at once
+  void rea_coeff_all_gp(const std::vector<double>& phi, const double dt,
+      std::vector<double>& reacoeff) override;
+
   /// compute reaction coefficient for multiple points per element at timestep n
   double rea_coeff_n(const double phi, const double dt, int gp) override;
 
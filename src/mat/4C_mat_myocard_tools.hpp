@@ -10,6 +10,8 @@
 
 #include "4C_config.hpp"
 
+#include <cmath>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*----------------------------------------------------------------------*/
@@ -30,10 +32,17 @@ class MyocardTools
   virtual ~MyocardTools() = default;
   /// compute Heaviside step function
   double gating_function(const double Gate1, const double Gate2, const double p, const double var,
-      const double thresh) const;
+      const double thresh) const
+  {
+    return Gate1 + (Gate2 - Gate1) * (1.0 + std::tanh(p * (var - thresh))) / 2;
+  }
 
   /// compute gating variable 'y' from dy/dt = (y_inf-y)/y_tau
-  double gating_var_calc(const double dt, double y_0, const double y_inf, const double y_tau) const;
+  double gating_var_calc(const double dt, double y_0, const double y_inf, const double y_tau) const
+  {
+    // Solve dy/dt = (1/a)*(y_inf-y)
+    return 1.0 / (1.0 + dt / y_tau) * (y_0 + dt * y_inf / y_tau);
+  }
 
 };  // Myocard_Tools
 
@@ -158,6 +158,10 @@ void Mat::PlasticElastHyperVCU::unpack(Core::Communication::UnpackBuffer& buffer
     {
       potsum_[p]->unpack_summand(buffer);
     }
+
+    // the compiled kernel of the summand combination is not communicated
+    summandProperties_.invariantDerivativesKernel =
+        elast_hyper_invariant_derivatives_kernel(potsum_);
   }
 
   // plastic history data
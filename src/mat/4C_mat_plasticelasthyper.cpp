@@ -260,6 +260,10 @@ void Mat::PlasticElastHyper::unpack(Core::Communication::UnpackBuffer& buffer)
       potsum_[p]->unpack_summand(buffer);
       potsum_[p]->register_anisotropy_extensions(anisotropy_);
     }
+
+    // the compiled kernel of the summand combination is not communicated
+    summandProperties_.invariantDerivativesKernel =
+        elast_hyper_invariant_derivatives_kernel(potsum_);
   }
 
   // plastic history data
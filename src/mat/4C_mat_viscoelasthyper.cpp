@@ -242,6 +242,10 @@ void Mat::ViscoElastHyper::unpack(Core::Communication::UnpackBuffer& buffer)
       p->register_anisotropy_extensions(anisotropy_);
     }
 
+    // the compiled kernel of the summand combination is not communicated
+    summandProperties_.invariantDerivativesKernel =
+        elast_hyper_invariant_derivatives_kernel(potsum_);
+
     // history data 09/13
     isinitvis_ = true;
     int histsize;
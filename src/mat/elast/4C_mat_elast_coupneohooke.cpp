@@ -57,25 +57,6 @@ void Mat::Elastic::CoupNeoHooke::add_strain_energy(double& psi,
   psi += psiadd;
 }
 
-void Mat::Elastic::CoupNeoHooke::add_derivatives_principal(Core::LinAlg::Matrix<3, 1>& dPI,
-    Core::LinAlg::Matrix<6, 1>& ddPII, const Core::LinAlg::Matrix<3, 1>& prinv, const int gp,
-    const int eleGID)
-{
-  const double beta = params_->beta_;
-  const double c = params_->c_;
-
-  dPI(0) += c;
-  // computing exp(log(a)*b) is faster than pow(a,b)
-  if (prinv(2) > 0)
-  {
-    const double prinv2_to_beta_m1 = std::exp(std::log(prinv(2)) * (-beta - 1.));
-    dPI(2) -= c * prinv2_to_beta_m1;
-    ddPII(2) += c * (beta + 1.) * prinv2_to_beta_m1 / prinv(2);
-  }
-  else
-    dPI(2) = ddPII(2) = std::numeric_limits<double>::quiet_NaN();
-}
-
 void Mat::Elastic::CoupNeoHooke::add_third_derivatives_principal_iso(
     Core::LinAlg::Matrix<10, 1>& dddPIII_iso, const Core::LinAlg::Matrix<3, 1>& prinv_iso,
     const int gp, const int eleGID)
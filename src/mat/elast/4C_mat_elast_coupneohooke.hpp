@@ -13,6 +13,9 @@
 #include "4C_mat_elast_summand.hpp"
 #include "4C_material_parameter_base.hpp"
 
+#include <cmath>
+#include <limits>
+
 FOUR_C_NAMESPACE_OPEN
 
 namespace Mat
@@ -174,6 +177,25 @@ namespace Mat
   }  // namespace Elastic
 }  // namespace Mat
 
+inline void Mat::Elastic::CoupNeoHooke::add_derivatives_principal(Core::LinAlg::Matrix<3, 1>& dPI,
+    Core::LinAlg::Matrix<6, 1>& ddPII, const Core::LinAlg::Matrix<3, 1>& prinv, const int gp,
+    const int eleGID)
+{
+  const double beta = params_->beta_;
+  const double c = params_->c_;
+
+  dPI(0) += c;
+  // computing exp(log(a)*b) is faster than pow(a,b)
+  if (prinv(2) > 0)
+  {
+    const double prinv2_to_beta_m1 = std::exp(std::log(prinv(2)) * (-beta - 1.));
+    dPI(2) -= c * prinv2_to_beta_m1;
+    ddPII(2) += c * (beta + 1.) * prinv2_to_beta_m1 / prinv(2);
+  }
+  else
+    dPI(2) = ddPII(2) = std::numeric_limits<double>::quiet_NaN();
+}
+
 FOUR_C_NAMESPACE_CLOSE
 
 #endif
@@ -38,15 +38,6 @@ void Mat::Elastic::IsoNeoHooke::add_strain_energy(double& psi,
 }
 
 
-void Mat::Elastic::IsoNeoHooke::add_derivatives_modified(Core::LinAlg::Matrix<3, 1>& dPmodI,
-    Core::LinAlg::Matrix<6, 1>& ddPmodII, const Core::LinAlg::Matrix<3, 1>& modinv, const int gp,
-    const int eleGID)
-{
-  const double mue = params_->mue_;
-
-  dPmodI(0) += 0.5 * mue;
-}
-
 // void Mat::Elastic::IsoNeoHooke::add_coefficients_stretches_principal(
 //   Core::LinAlg::Matrix<3,1>& gamma,  ///< see above, [gamma_1, gamma_2, gamma_3]
 //   Core::LinAlg::Matrix<6,1>& delta,  ///< see above, [delta_11, delta_22, delta_33, delta_12,
@@ -142,6 +142,15 @@ namespace Mat
   }  // namespace Elastic
 }  // namespace Mat
 
+inline void Mat::Elastic::IsoNeoHooke::add_derivatives_modified(Core::LinAlg::Matrix<3, 1>& dPmodI,
+    Core::LinAlg::Matrix<6, 1>& ddPmodII, const Core::LinAlg::Matrix<3, 1>& modinv, const int gp,
+    const int eleGID)
+{
+  const double mue = params_->mue_;
+
+  dPmodI(0) += 0.5 * mue;
+}
+
 FOUR_C_NAMESPACE_CLOSE
 
 #endif
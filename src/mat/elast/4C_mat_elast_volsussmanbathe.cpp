@@ -33,17 +33,6 @@ void Mat::Elastic::VolSussmanBathe::add_strain_energy(double& psi,
   psi += kappa * 0.5 * (modinv(2) - 1.) * (modinv(2) - 1.);
 }
 
-void Mat::Elastic::VolSussmanBathe::add_derivatives_modified(Core::LinAlg::Matrix<3, 1>& dPmodI,
-    Core::LinAlg::Matrix<6, 1>& ddPmodII, const Core::LinAlg::Matrix<3, 1>& modinv, const int gp,
-    const int eleGID)
-{
-  const double kappa = params_->kappa_;
-
-  dPmodI(2) += kappa * (modinv(2) - 1.);
-
-  ddPmodII(2) += kappa;
-}
-
 void Mat::Elastic::VolSussmanBathe::add3rd_vol_deriv(
     const Core::LinAlg::Matrix<3, 1>& modinv, double& d3PsiVolDJ3)
 {
@@ -135,6 +135,17 @@ namespace Mat
   }  // namespace Elastic
 }  // namespace Mat
 
+inline void Mat::Elastic::VolSussmanBathe::add_derivatives_modified(
+    Core::LinAlg::Matrix<3, 1>& dPmodI, Core::LinAlg::Matrix<6, 1>& ddPmodII,
+    const Core::LinAlg::Matrix<3, 1>& modinv, const int gp, const int eleGID)
+{
+  const double kappa = params_->kappa_;
+
+  dPmodI(2) += kappa * (modinv(2) - 1.);
+
+  ddPmodII(2) += kappa;
+}
+
 FOUR_C_NAMESPACE_CLOSE
 
 #endif
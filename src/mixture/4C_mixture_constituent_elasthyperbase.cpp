@@ -152,6 +152,10 @@ void Mixture::MixtureConstituentElastHyperBase::unpack_constituent(
 
     // loop map of associated potential summands
     for (auto& summand : potsum_) summand->unpack_summand(buffer);
+
+    // the compiled kernel of the summand combination is not communicated
+    summand_properties_.invariantDerivativesKernel =
+        Mat::elast_hyper_invariant_derivatives_kernel(potsum_);
   }
 }
 
@@ -51,6 +51,20 @@ const Epetra_Comm& Mortar::Coupling3d::get_comm() const { return idiscret_.get_c
  |  Evaluate coupling (3D)                                    popp 03/09|
  *----------------------------------------------------------------------*/
 bool Mortar::Coupling3d::evaluate_coupling()
+{
+  if (!evaluate_cells()) return false;
+
+  // check / set  projection status of slave nodes
+  has_proj_status();
+
+  return true;
+}
+
+
+/*----------------------------------------------------------------------*
+ |  Evaluate coupling without projection status (3D)                   |
+ *----------------------------------------------------------------------*/
+bool Mortar::Coupling3d::evaluate_cells()
 {
   // rough check whether element centers are "near"
   // whether or not quadratic 3d coupling is performed, we only
@@ -99,9 +113,6 @@ bool Mortar::Coupling3d::evaluate_coupling()
   // proceed only if clipping polygon has non-zero area
   if (polygon_area() < MORTARINTLIM * slave_element_area()) return false;
 
-  // check / set  projection status of slave nodes
-  has_proj_status();
-
   // do triangulation (+linearization) of clip polygon
   triangulation(projpar, tol);
 
@@ -3974,10 +3985,11 @@ void Mortar::Coupling3dManager::integrate_coupling(
       // create Coupling3d object and push back
       coupling().push_back(std::make_shared<Coupling3d>(
           idiscret_, dim_, false, imortar_, slave_element(), master_element(m)));
-      // do coupling
-      coupling()[m]->evaluate_coupling();
     }
 
+    // do coupling
+    Coupling3d::evaluate_couplings(coupling());
+
     // special treatment of boundary elements
     // calculate consistent dual shape functions for this element
     consist_dual_shape();
@@ -4111,13 +4123,13 @@ void Mortar::Coupling3dQuadManager::integrate_coupling(
           // create instance of coupling class
           coupling().push_back(std::make_shared<Coupling3dQuad>(idiscret_, dim_, true, imortar_,
               slave_element(), *master_elements()[m], *sauxelements[i], *mauxelements[m][j]));
-
-          // do coupling
-          coupling()[coupling().size() - 1]->evaluate_coupling();
         }  // for maux
       }    // for saux
     }      // for m
 
+    // do coupling
+    Coupling3d::evaluate_couplings(coupling());
+
     consist_dual_shape();
 
     // do integration
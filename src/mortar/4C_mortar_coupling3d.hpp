@@ -13,10 +13,12 @@
 #include "4C_inpar_mortar.hpp"
 #include "4C_mortar_coupling3d_classes.hpp"
 #include "4C_utils_pairedvector.hpp"
+#include "4C_utils_shared_memory_parallel.hpp"
 
 #include <Epetra_Comm.h>
 #include <Teuchos_StandardParameterEntryValidators.hpp>
 
+#include <algorithm>
 #include <vector>
 
 FOUR_C_NAMESPACE_OPEN
@@ -214,6 +216,29 @@ namespace Mortar
      */
     virtual bool evaluate_coupling();
 
+    /*!
+     \brief Evaluate coupling (3D) without setting the projection status of the slave nodes
+
+     Projection, polygon clipping and triangulation only modify this object. Thus, this method
+     can be called concurrently for different slave/master pairs.
+
+     */
+    bool evaluate_cells();
+
+    /*!
+     \brief Call evaluate_cells() for all @p couplings and has_proj_status() for those with cells
+
+     The cells of the slave/master pairs are computed thread-parallel if there are at least
+     #min_couplings_per_thread pairs per thread. The projection status of the slave nodes is
+     shared by the pairs and set serially afterwards.
+
+     */
+    template <typename CouplingType>
+    static void evaluate_couplings(const std::vector<std::shared_ptr<CouplingType>>& couplings);
+
+    //! minimum number of slave/master pairs per thread in evaluate_couplings()
+    static constexpr int min_couplings_per_thread = 8;
+
     /*!
      \brief Checks roughly whether the two elements are near (3D)
 
@@ -472,6 +497,27 @@ namespace Mortar
   };
   // class Coupling3d
 
+  template <typename CouplingType>
+  void Coupling3d::evaluate_couplings(const std::vector<std::shared_ptr<CouplingType>>& couplings)
+  {
+    const int num_couplings = static_cast<int>(couplings.size());
+
+    // a slave element usually overlaps only a few master elements, for which starting a parallel
+    // region costs more than it saves
+    const int num_threads =
+        std::min(Core::Utils::max_threads(), num_couplings / min_couplings_per_thread);
+
+    std::vector<char> has_cells(couplings.size(), false);
+    Core::Utils::parallel_for(num_couplings, num_threads,
+        [&](int i) { has_cells[i] = couplings[i]->evaluate_cells(); });
+
+    for (std::size_t i = 0; i < couplings.size(); ++i)
+    {
+      Coupling3d& coupling = *couplings[i];
+      if (has_cells[i]) coupling.has_proj_status();
+    }
+  }
+
   /*!
    \brief A class representing the framework for mortar coupling of ONE
    slave element and ONE master element of a mortar interface in
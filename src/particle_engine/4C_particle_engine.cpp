@@ -39,6 +39,7 @@ PARTICLEENGINE::ParticleEngine::ParticleEngine(
       params_(params),
       minbinsize_(0.0),
       typevectorsize_(0),
+      numpotentialparticleneighborsbuilds_(0),
       validownedparticles_(false),
       validghostedparticles_(false),
       validparticleneighbors_(false),
@@ -585,6 +586,9 @@ void PARTICLEENGINE::ParticleEngine::build_particle_to_particle_neighbors()
     }
   }
 
+  // increase number of builds of potential particle neighbors
+  ++numpotentialparticleneighborsbuilds_;
+
   // validate flag denoting validity of particle neighbors map
   validparticleneighbors_ = true;
 }
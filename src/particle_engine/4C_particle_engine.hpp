@@ -354,6 +354,11 @@ namespace PARTICLEENGINE
 
     const PotentialParticleNeighbors& get_potential_particle_neighbors() const override;
 
+    int get_num_potential_particle_neighbors_builds() const override
+    {
+      return numpotentialparticleneighborsbuilds_;
+    };
+
     const std::vector<std::vector<int>>& get_communicated_particle_targets() const override
     {
       return communicatedparticletargets_;
@@ -820,6 +825,9 @@ namespace PARTICLEENGINE
     //! relate potential particle neighbors of all types and statuses
     PotentialParticleNeighbors potentialparticleneighbors_;
 
+    //! number of builds of potential particle neighbors
+    int numpotentialparticleneighborsbuilds_;
+
     //! owned particles being communicated (transfered/distributed) to target processors
     std::vector<std::vector<int>> communicatedparticletargets_;
 
@@ -9,6 +9,8 @@
 
 #include "4C_utils_exceptions.hpp"
 
+#include <algorithm>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
@@ -40,19 +42,14 @@ void PARTICLEENGINE::ParticleContainer::setup(
   // allocate memory for global ids
   globalids_.resize(containersize_, -1);
 
-  // allocate memory to hold particle states and dimension
-  states_.resize(statesvectorsize_);
-  statedim_.resize(statesvectorsize_);
-
-  // iterate over states to be stored in container
-  for (const auto& state : storedstates_)
-  {
-    // set particle state dimension for current state
-    statedim_[state] = enum_to_state_dim(state);
+  // set particle state dimension and mark states not stored in container
+  statedim_.assign(statesvectorsize_, 0);
+  stateoffset_.assign(statesvectorsize_, -1);
+  for (const auto& state : storedstates_) statedim_[state] = enum_to_state_dim(state);
 
-    // allocate memory for current state in particle container
-    states_[state].resize(containersize_ * statedim_[state]);
-  }
+  // allocate memory for particle states
+  statedata_.clear();
+  allocate_states();
 }
 
 void PARTICLEENGINE::ParticleContainer::increase_container_size()
@@ -63,12 +60,8 @@ void PARTICLEENGINE::ParticleContainer::increase_container_size()
   // resize vector of global ids
   globalids_.resize(containersize_);
 
-  // iterate over states stored in container
-  for (const auto& state : storedstates_)
-  {
-    // resize vector of current state
-    states_[state].resize(containersize_ * statedim_[state]);
-  }
+  // reallocate memory for particle states
+  allocate_states();
 }
 
 void PARTICLEENGINE::ParticleContainer::decrease_container_size()
@@ -89,12 +82,8 @@ void PARTICLEENGINE::ParticleContainer::decrease_container_size()
   // resize vector of global ids
   globalids_.resize(containersize_);
 
-  // iterate over states stored in container
-  for (const auto& state : storedstates_)
-  {
-    // resize vector of current state
-    states_[state].resize(containersize_ * statedim_[state]);
-  }
+  // reallocate memory for particle states
+  allocate_states();
 }
 
 void PARTICLEENGINE::ParticleContainer::add_particle(
@@ -109,12 +98,13 @@ void PARTICLEENGINE::ParticleContainer::add_particle(
   // iterate over states stored in container
   for (const auto& state : storedstates_)
   {
+    double* state_ptr = state_data(state) + particlestored_ * statedim_[state];
+
     // state not handed over
     if (states.size() <= state or states[state].empty())
     {
       // initialize to zero
-      for (int dim = 0; dim < statedim_[state]; ++dim)
-        (states_[state])[particlestored_ * statedim_[state] + dim] = 0.0;
+      for (int dim = 0; dim < statedim_[state]; ++dim) state_ptr[dim] = 0.0;
     }
     // state handed over
     else
@@ -126,8 +116,7 @@ void PARTICLEENGINE::ParticleContainer::add_particle(
 #endif
 
       // store state in container
-      for (int dim = 0; dim < statedim_[state]; ++dim)
-        (states_[state])[particlestored_ * statedim_[state] + dim] = states[state][dim];
+      for (int dim = 0; dim < statedim_[state]; ++dim) state_ptr[dim] = states[state][dim];
     }
   }
 
@@ -167,8 +156,8 @@ void PARTICLEENGINE::ParticleContainer::replace_particle(
 #endif
 
       // replace state in container
-      for (int dim = 0; dim < statedim_[state]; ++dim)
-        (states_[state])[index * statedim_[state] + dim] = states[state][dim];
+      double* state_ptr = state_data(state) + index * statedim_[state];
+      for (int dim = 0; dim < statedim_[state]; ++dim) state_ptr[dim] = states[state][dim];
     }
   }
 }
@@ -191,7 +180,7 @@ void PARTICLEENGINE::ParticleContainer::get_particle(
   for (const auto& state : storedstates_)
   {
     // get pointer to particle state
-    const double* state_ptr = &((states_[state])[index * statedim_[state]]);
+    const double* state_ptr = state_data(state) + index * statedim_[state];
 
     // fill particle state
     states[state].assign(state_ptr, state_ptr + statedim_[state]);
@@ -215,25 +204,26 @@ void PARTICLEENGINE::ParticleContainer::remove_particle(int index)
   for (const auto& state : storedstates_)
   {
     // overwrite state in container
+    double* state_ptr = state_data(state);
     for (int dim = 0; dim < statedim_[state]; ++dim)
-      (states_[state])[index * statedim_[state] + dim] =
-          (states_[state])[particlestored_ * statedim_[state] + dim];
+      state_ptr[index * statedim_[state] + dim] =
+          state_ptr[particlestored_ * statedim_[state] + dim];
   }
 }
 
 double PARTICLEENGINE::ParticleContainer::get_min_value_of_state(ParticleState state) const
 {
 #ifdef FOUR_C_ENABLE_ASSERTIONS
-  if (not storedstates_.count(state))
-    FOUR_C_THROW("particle state '%s' not stored in container!", enum_to_state_name(state).c_str());
+  check_stored_state(state);
 #endif
 
   if (particlestored_ <= 0) return 0.0;
 
-  double min = (states_[state])[0];
+  const double* values = state_data(state);
 
-  for (int i = 0; i < (particlestored_ * statedim_[state]); ++i)
-    min = std::min(min, states_[state][i]);
+  double min = values[0];
+
+  for (int i = 0; i < (particlestored_ * statedim_[state]); ++i) min = std::min(min, values[i]);
 
   return min;
 }
@@ -241,18 +231,51 @@ double PARTICLEENGINE::ParticleContainer::get_min_value_of_state(ParticleState s
 double PARTICLEENGINE::ParticleContainer::get_max_value_of_state(ParticleState state) const
 {
 #ifdef FOUR_C_ENABLE_ASSERTIONS
-  if (not storedstates_.count(state))
-    FOUR_C_THROW("particle state '%s' not stored in container!", enum_to_state_name(state).c_str());
+  check_stored_state(state);
 #endif
 
   if (particlestored_ <= 0) return 0.0;
 
-  double max = (states_[state])[0];
+  const double* values = state_data(state);
+
+  double max = values[0];
 
-  for (int i = 0; i < (particlestored_ * statedim_[state]); ++i)
-    max = std::max(max, states_[state][i]);
+  for (int i = 0; i < (particlestored_ * statedim_[state]); ++i) max = std::max(max, values[i]);
 
   return max;
 }
 
+void PARTICLEENGINE::ParticleContainer::allocate_states()
+{
+  // number of values fitting into the alignment of the particle states
+  constexpr int alignedvalues = Internal::particle_state_alignment / sizeof(double);
+
+  // determine offset of each state such that all states are aligned
+  std::vector<int> stateoffset(statesvectorsize_, -1);
+  int totalsize = 0;
+  for (const auto& state : storedstates_)
+  {
+    stateoffset[state] = totalsize;
+
+    const int statesize = containersize_ * statedim_[state];
+    totalsize += ((statesize + alignedvalues - 1) / alignedvalues) * alignedvalues;
+  }
+
+  std::vector<double, Internal::CacheLineAlignedAllocator<double>> statedata(totalsize, 0.0);
+
+  // copy values of particles stored in container
+  if (not statedata_.empty())
+  {
+    for (const auto& state : storedstates_)
+    {
+      const double* oldvalues = state_data(state);
+      std::copy(oldvalues, oldvalues + particlestored_ * statedim_[state],
+          statedata.data() + stateoffset[state]);
+    }
+  }
+
+  statedata_.swap(statedata);
+  stateoffset_.swap(stateoffset);
+}
+
 FOUR_C_NAMESPACE_CLOSE
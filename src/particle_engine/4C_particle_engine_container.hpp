@@ -16,6 +16,9 @@
 #include "4C_particle_engine_enums.hpp"
 #include "4C_particle_engine_typedefs.hpp"
 
+#include <cstddef>
+#include <new>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
@@ -23,6 +26,99 @@ FOUR_C_NAMESPACE_OPEN
  *---------------------------------------------------------------------------*/
 namespace PARTICLEENGINE
 {
+  namespace Internal
+  {
+    //! alignment of particle state storage in bytes (size of a cache line)
+    constexpr std::size_t particle_state_alignment = 64;
+
+    //! allocator providing memory aligned to the size of a cache line
+    template <typename T>
+    struct CacheLineAlignedAllocator
+    {
+      using value_type = T;
+
+      CacheLineAlignedAllocator() = default;
+
+      template <typename U>
+      CacheLineAlignedAllocator(const CacheLineAlignedAllocator<U>&)
+      {
+      }
+
+      T* allocate(std::size_t n)
+      {
+        return static_cast<T*>(
+            ::operator new(n * sizeof(T), std::align_val_t(particle_state_alignment)));
+      }
+
+      void deallocate(T* ptr, std::size_t)
+      {
+        ::operator delete(ptr, std::align_val_t(particle_state_alignment));
+      }
+
+      template <typename U>
+      bool operator==(const CacheLineAlignedAllocator<U>&) const
+      {
+        return true;
+      }
+
+      template <typename U>
+      bool operator!=(const CacheLineAlignedAllocator<U>&) const
+      {
+        return false;
+      }
+    };
+  }  // namespace Internal
+
+  /*!
+   * \brief view on a particle state of all particles stored in a particle container
+   *
+   * A state view is resolved once from the particle container, e.g., at the beginning of an
+   * evaluation, and afterwards provides access to the state of a particle without any lookup of
+   * the state. The values of all particles are stored contiguously, i.e., the state of the
+   * particle at index i is located at data() + i * dim(). This allows to process the state of all
+   * particles in a single (vectorizable) loop over [data(), data() + num_values()).
+   *
+   * \note A state view is invalidated if the size of the particle container is changed, e.g., by
+   *       adding particles. A view of a state that is not stored in the container is empty.
+   */
+  class ParticleStateView
+  {
+   public:
+    //! construct an empty view
+    ParticleStateView() = default;
+
+    ParticleStateView(double* data, int dim, int size) : data_(data), dim_(dim), size_(size) {}
+
+    //! return false if the state is not stored in the particle container
+    explicit operator bool() const { return data_ != nullptr; }
+
+    //! return pointer to state of particle at index
+    double* operator[](int index) const { return data_ + index * dim_; }
+
+    //! return pointer to state of first particle
+    double* data() const { return data_; }
+
+    //! return dimension of particle state
+    int dim() const { return dim_; }
+
+    //! return number of particles
+    int size() const { return size_; }
+
+    //! return number of values of all particles
+    int num_values() const { return size_ * dim_; }
+
+    //! iterators over the values of all particles
+    double* begin() const { return data_; }
+    double* end() const { return data_ + num_values(); }
+
+   private:
+    double* data_ = nullptr;
+
+    int dim_ = 0;
+
+    int size_ = 0;
+  };
+
   /*!
    * \brief smart particle container class
    *
@@ -30,6 +126,11 @@ namespace PARTICLEENGINE
    * avoiding both expensive memory reallocations and memory fragmentation. Fast access to particle
    * states is provided.
    *
+   * All particle states are stored in a single contiguous block of memory. The values of each
+   * state are stored contiguously for all particles in a section of that block that is aligned to
+   * the size of a cache line. The offset of each state section is determined once during setup,
+   * such that a state is accessed without any lookup.
+   *
    * \author Sebastian Fuchs \date 03/2018
    */
   class ParticleContainer final
@@ -178,9 +279,7 @@ namespace PARTICLEENGINE
     inline int get_state_dim(ParticleState state)
     {
 #ifdef FOUR_C_ENABLE_ASSERTIONS
-      if (not storedstates_.count(state))
-        FOUR_C_THROW(
-            "particle state '%s' not stored in container!", enum_to_state_name(state).c_str());
+      check_stored_state(state);
 #endif
 
       return statedim_[state];
@@ -208,16 +307,14 @@ namespace PARTICLEENGINE
     inline double* get_ptr_to_state(ParticleState state, int index)
     {
 #ifdef FOUR_C_ENABLE_ASSERTIONS
-      if (not storedstates_.count(state))
-        FOUR_C_THROW(
-            "particle state '%s' not stored in container!", enum_to_state_name(state).c_str());
+      check_stored_state(state);
 
       if (index < 0 or index > (particlestored_ - 1))
         FOUR_C_THROW(
             "can not return pointer to state of particle as index %d out of bounds!", index);
 #endif
 
-      return &((states_[state])[index * statedim_[state]]);
+      return state_data(state) + index * statedim_[state];
     };
 
     /*!
@@ -245,11 +342,51 @@ namespace PARTICLEENGINE
             "can not return pointer to state of particle as index %d out of bounds!", index);
 #endif
 
-      if (storedstates_.count(state)) return &((states_[state])[index * statedim_[state]]);
+      if (have_stored_state(state)) return state_data(state) + index * statedim_[state];
 
       return nullptr;
     };
 
+    /*!
+     * \brief get view on state of all particles
+     *
+     * The returned view provides access to the state of all particles stored in the container
+     * without any further lookup. It is meant to be resolved once, e.g., at the beginning of an
+     * evaluation, instead of calling get_ptr_to_state() for each particle.
+     *
+     * \note Throws an error in the debug version in case the requested state is not stored in the
+     *       particle container.
+     *
+     * \param[in] state particle state
+     *
+     * \return view on particle state
+     */
+    inline ParticleStateView get_state_view(ParticleState state)
+    {
+#ifdef FOUR_C_ENABLE_ASSERTIONS
+      check_stored_state(state);
+#endif
+
+      return ParticleStateView(state_data(state), statedim_[state], particlestored_);
+    };
+
+    /*!
+     * \brief conditionally get view on state of all particles
+     *
+     * In case the state is not stored in the particle container, an empty view is returned.
+     *
+     * \param[in] state particle state
+     *
+     * \return view on particle state or empty view
+     */
+    inline ParticleStateView cond_get_state_view(ParticleState state)
+    {
+      if (have_stored_state(state))
+        return ParticleStateView(state_data(state), statedim_[state], particlestored_);
+
+      return ParticleStateView();
+    };
+
     /*!
      * \brief get pointer to global id of a particle at index
      *
@@ -286,12 +423,11 @@ namespace PARTICLEENGINE
     inline void scale_state(double fac, ParticleState state)
     {
 #ifdef FOUR_C_ENABLE_ASSERTIONS
-      if (not storedstates_.count(state))
-        FOUR_C_THROW(
-            "particle state '%s' not stored in container!", enum_to_state_name(state).c_str());
+      check_stored_state(state);
 #endif
 
-      for (int i = 0; i < (particlestored_ * statedim_[state]); ++i) (states_[state])[i] *= fac;
+      double* values = state_data(state);
+      for (int i = 0; i < (particlestored_ * statedim_[state]); ++i) values[i] *= fac;
     };
 
     /*!
@@ -307,20 +443,17 @@ namespace PARTICLEENGINE
     inline void update_state(double facA, ParticleState stateA, double facB, ParticleState stateB)
     {
 #ifdef FOUR_C_ENABLE_ASSERTIONS
-      if (not storedstates_.count(stateA))
-        FOUR_C_THROW(
-            "particle state '%s' not stored in container!", enum_to_state_name(stateA).c_str());
-
-      if (not storedstates_.count(stateB))
-        FOUR_C_THROW(
-            "particle state '%s' not stored in container!", enum_to_state_name(stateB).c_str());
+      check_stored_state(stateA);
+      check_stored_state(stateB);
 
       if (statedim_[stateA] != statedim_[stateB])
         FOUR_C_THROW("dimensions of states do not match!");
 #endif
 
+      double* valuesA = state_data(stateA);
+      const double* valuesB = state_data(stateB);
       for (int i = 0; i < (particlestored_ * statedim_[stateA]); ++i)
-        (states_[stateA])[i] = facA * (states_[stateA])[i] + facB * (states_[stateB])[i];
+        valuesA[i] = facA * valuesA[i] + facB * valuesB[i];
     };
 
     /*!
@@ -334,17 +467,16 @@ namespace PARTICLEENGINE
     inline void set_state(std::vector<double> val, ParticleState state)
     {
 #ifdef FOUR_C_ENABLE_ASSERTIONS
-      if (not storedstates_.count(state))
-        FOUR_C_THROW(
-            "particle state '%s' not stored in container!", enum_to_state_name(state).c_str());
+      check_stored_state(state);
 
       if (statedim_[state] != static_cast<int>(val.size()))
         FOUR_C_THROW("dimensions of states do not match!");
 #endif
 
+      double* values = state_data(state);
       for (int i = 0; i < particlestored_; ++i)
         for (int dim = 0; dim < statedim_[state]; ++dim)
-          (states_[state])[i * statedim_[state] + dim] = val[dim];
+          values[i * statedim_[state] + dim] = val[dim];
     };
 
     /*!
@@ -357,12 +489,11 @@ namespace PARTICLEENGINE
     inline void clear_state(ParticleState state)
     {
 #ifdef FOUR_C_ENABLE_ASSERTIONS
-      if (not storedstates_.count(state))
-        FOUR_C_THROW(
-            "particle state '%s' not stored in container!", enum_to_state_name(state).c_str());
+      check_stored_state(state);
 #endif
 
-      for (int i = 0; i < (particlestored_ * statedim_[state]); ++i) (states_[state])[i] = 0.0;
+      double* values = state_data(state);
+      for (int i = 0; i < (particlestored_ * statedim_[state]); ++i) values[i] = 0.0;
     };
 
     //! @}
@@ -387,7 +518,10 @@ namespace PARTICLEENGINE
      *
      * \return flag indicating stored state
      */
-    inline bool have_stored_state(ParticleState state) const { return storedstates_.count(state); };
+    inline bool have_stored_state(ParticleState state) const
+    {
+      return state < statesvectorsize_ and stateoffset_[state] >= 0;
+    };
 
     /*!
      * \brief get size of particle container
@@ -430,6 +564,34 @@ namespace PARTICLEENGINE
     double get_max_value_of_state(ParticleState state) const;
 
    private:
+    //! get pointer to state of first particle
+    inline double* state_data(ParticleState state)
+    {
+      return statedata_.data() + stateoffset_[state];
+    };
+
+    //! get pointer to state of first particle
+    inline const double* state_data(ParticleState state) const
+    {
+      return statedata_.data() + stateoffset_[state];
+    };
+
+    //! throw an error in case the state is not stored in the container
+    inline void check_stored_state(ParticleState state) const
+    {
+      if (not have_stored_state(state))
+        FOUR_C_THROW(
+            "particle state '%s' not stored in container!", enum_to_state_name(state).c_str());
+    };
+
+    /*!
+     * \brief allocate memory for all particle states
+     *
+     * The memory for all stored states is (re-)allocated according to the current container size.
+     * The values of the particles stored in the container are kept.
+     */
+    void allocate_states();
+
     //! size of particles container
     int containersize_;
 
@@ -445,8 +607,11 @@ namespace PARTICLEENGINE
     //! global ids of stored particles
     std::vector<int> globalids_;
 
-    //! particle states in container indexed by particle state enum
-    std::vector<std::vector<double>> states_;
+    //! values of all particle states in container
+    std::vector<double, Internal::CacheLineAlignedAllocator<double>> statedata_;
+
+    //! offset of particle state in values of all states indexed by particle state enum (or -1)
+    std::vector<int> stateoffset_;
 
     //! particle state dimension indexed by particle state enum
     std::vector<int> statedim_;
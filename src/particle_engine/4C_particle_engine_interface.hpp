@@ -122,6 +122,16 @@ namespace PARTICLEENGINE
      */
     virtual const PotentialParticleNeighbors& get_potential_particle_neighbors() const = 0;
 
+    /*!
+     * \brief get number of builds of the potential particle neighbors
+     *
+     * Allows to detect a rebuild of the potential particle neighbors, which invalidates all local
+     * indices derived from them.
+     *
+     * \return number of builds of the potential particle neighbors
+     */
+    virtual int get_num_potential_particle_neighbors_builds() const = 0;
+
     /*!
      * \brief get reference to particles being communicated to target processors
      *
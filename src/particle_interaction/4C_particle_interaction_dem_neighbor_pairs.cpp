@@ -23,7 +23,8 @@ FOUR_C_NAMESPACE_OPEN
 /*---------------------------------------------------------------------------*
  | definitions                                                               |
  *---------------------------------------------------------------------------*/
-ParticleInteraction::DEMNeighborPairs::DEMNeighborPairs()
+ParticleInteraction::DEMNeighborPairs::DEMNeighborPairs(double verletskin)
+    : verletlist_(verletskin), verletlistadhesion_(verletskin)
 {
   // empty constructor
 }
@@ -43,6 +44,10 @@ void ParticleInteraction::DEMNeighborPairs::setup(
   // set particle container bundle
   particlecontainerbundle_ = particleengineinterface_->get_particle_container_bundle();
 
+  // setup verlet lists
+  verletlist_.setup(particleengineinterface);
+  verletlistadhesion_.setup(particleengineinterface);
+
   // set interface to particle wall handler
   particlewallinterface_ = particlewallinterface;
 }
@@ -73,9 +78,13 @@ void ParticleInteraction::DEMNeighborPairs::evaluate_particle_pairs()
   // clear particle pair data
   particlepairdata_.clear();
 
-  // iterate over potential particle neighbors
-  for (const auto& potentialneighbors :
-      particleengineinterface_->get_potential_particle_neighbors())
+  // get candidate particle pairs within interaction distance plus skin distance
+  const PARTICLEENGINE::PotentialParticleNeighbors& candidateparticlepairs =
+      verletlist_.get_candidate_particle_pairs(
+          [](double rad_i, double rad_j) { return rad_i + rad_j; });
+
+  // iterate over candidate particle pairs
+  for (const auto& potentialneighbors : candidateparticlepairs)
   {
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
@@ -364,9 +373,13 @@ void ParticleInteraction::DEMNeighborPairs::evaluate_particle_pairs_adhesion(
   // clear adhesion particle pair data
   particlepairadhesiondata_.clear();
 
-  // iterate over potential particle neighbors
-  for (const auto& potentialneighbors :
-      particleengineinterface_->get_potential_particle_neighbors())
+  // get candidate particle pairs within adhesion distance plus skin distance
+  const PARTICLEENGINE::PotentialParticleNeighbors& candidateparticlepairs =
+      verletlistadhesion_.get_candidate_particle_pairs(
+          [&](double rad_i, double rad_j) { return rad_i + rad_j + adhesion_distance; });
+
+  // iterate over candidate particle pairs
+  for (const auto& potentialneighbors : candidateparticlepairs)
   {
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
@@ -16,6 +16,7 @@
 #include "4C_particle_engine_enums.hpp"
 #include "4C_particle_engine_typedefs.hpp"
 #include "4C_particle_interaction_dem_neighbor_pair_struct.hpp"
+#include "4C_particle_interaction_verlet_list.hpp"
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -51,7 +52,7 @@ namespace ParticleInteraction
   {
    public:
     //! constructor
-    explicit DEMNeighborPairs();
+    explicit DEMNeighborPairs(double verletskin);
 
     //! init neighbor pair handler
     void init();
@@ -116,6 +117,12 @@ namespace ParticleInteraction
     //! adhesion particle-wall pair data with evaluated quantities
     DEMParticleWallPairData particlewallpairadhesiondata_;
 
+    //! verlet list of candidate particle pairs
+    VerletList verletlist_;
+
+    //! verlet list of candidate adhesion particle pairs
+    VerletList verletlistadhesion_;
+
     //! interface to particle engine
     std::shared_ptr<PARTICLEENGINE::ParticleEngineInterface> particleengineinterface_;
 
@@ -137,19 +137,22 @@ void ParticleInteraction::SPHDensityBase::sum_weighted_mass_self_contribution()
     PARTICLEENGINE::ParticleContainer* container_i =
         particlecontainerbundle_->get_specific_container(type_i, PARTICLEENGINE::Owned);
 
+    // get view on particle states
+    const PARTICLEENGINE::ParticleStateView rad =
+        container_i->get_state_view(PARTICLEENGINE::Radius);
+    const PARTICLEENGINE::ParticleStateView mass =
+        container_i->get_state_view(PARTICLEENGINE::Mass);
+    const PARTICLEENGINE::ParticleStateView denssum =
+        container_i->get_state_view(PARTICLEENGINE::DensitySum);
+
     // iterate over particles in container
-    for (int particle_i = 0; particle_i < container_i->particles_stored(); ++particle_i)
+    for (int particle_i = 0; particle_i < denssum.size(); ++particle_i)
     {
-      // get pointer to particle states
-      const double* rad_i = container_i->get_ptr_to_state(PARTICLEENGINE::Radius, particle_i);
-      const double* mass_i = container_i->get_ptr_to_state(PARTICLEENGINE::Mass, particle_i);
-      double* denssum_i = container_i->get_ptr_to_state(PARTICLEENGINE::DensitySum, particle_i);
-
       // evaluate kernel
-      const double Wii = kernel_->w0(rad_i[0]);
+      const double Wii = kernel_->w0(rad[particle_i][0]);
 
       // add self contribution
-      denssum_i[0] += Wii * mass_i[0];
+      denssum[particle_i][0] += Wii * mass[particle_i][0];
     }
   }
 }
@@ -159,41 +162,44 @@ void ParticleInteraction::SPHDensityBase::sum_weighted_mass_particle_contributio
   TEUCHOS_FUNC_TIME_MONITOR(
       "ParticleInteraction::SPHDensityBase::sum_weighted_mass_particle_contribution");
 
-  // iterate over particle pairs
-  for (auto& particlepair : neighborpairs_->get_ref_to_particle_pair_data())
-  {
-    // access values of local index tuples of particle i and j
-    PARTICLEENGINE::TypeEnum type_i;
-    PARTICLEENGINE::StatusEnum status_i;
-    int particle_i;
-    std::tie(type_i, status_i, particle_i) = particlepair.tuple_i_;
+  // iterate over particle pairs, pairs without common particle in parallel
+  neighborpairs_->for_each_particle_pair(
+      [&](const SPHParticlePair& particlepair)
+      {
+        // access values of local index tuples of particle i and j
+        PARTICLEENGINE::TypeEnum type_i;
+        PARTICLEENGINE::StatusEnum status_i;
+        int particle_i;
+        std::tie(type_i, status_i, particle_i) = particlepair.tuple_i_;
 
-    PARTICLEENGINE::TypeEnum type_j;
-    PARTICLEENGINE::StatusEnum status_j;
-    int particle_j;
-    std::tie(type_j, status_j, particle_j) = particlepair.tuple_j_;
+        PARTICLEENGINE::TypeEnum type_j;
+        PARTICLEENGINE::StatusEnum status_j;
+        int particle_j;
+        std::tie(type_j, status_j, particle_j) = particlepair.tuple_j_;
 
-    // get corresponding particle containers
-    PARTICLEENGINE::ParticleContainer* container_i =
-        particlecontainerbundle_->get_specific_container(type_i, status_i);
+        // get corresponding particle containers
+        PARTICLEENGINE::ParticleContainer* container_i =
+            particlecontainerbundle_->get_specific_container(type_i, status_i);
 
-    PARTICLEENGINE::ParticleContainer* container_j =
-        particlecontainerbundle_->get_specific_container(type_j, status_j);
+        PARTICLEENGINE::ParticleContainer* container_j =
+            particlecontainerbundle_->get_specific_container(type_j, status_j);
 
-    // get pointer to particle states
-    const double* mass_i = container_i->get_ptr_to_state(PARTICLEENGINE::Mass, particle_i);
-    double* denssum_i = container_i->cond_get_ptr_to_state(PARTICLEENGINE::DensitySum, particle_i);
+        // get pointer to particle states
+        const double* mass_i = container_i->get_ptr_to_state(PARTICLEENGINE::Mass, particle_i);
+        double* denssum_i =
+            container_i->cond_get_ptr_to_state(PARTICLEENGINE::DensitySum, particle_i);
 
-    const double* mass_j = container_j->get_ptr_to_state(PARTICLEENGINE::Mass, particle_j);
-    double* denssum_j = container_j->cond_get_ptr_to_state(PARTICLEENGINE::DensitySum, particle_j);
+        const double* mass_j = container_j->get_ptr_to_state(PARTICLEENGINE::Mass, particle_j);
+        double* denssum_j =
+            container_j->cond_get_ptr_to_state(PARTICLEENGINE::DensitySum, particle_j);
 
-    // sum contribution of neighboring particle j
-    if (denssum_i) denssum_i[0] += particlepair.Wij_ * mass_i[0];
+        // sum contribution of neighboring particle j
+        if (denssum_i) denssum_i[0] += particlepair.Wij_ * mass_i[0];
 
-    // sum contribution of neighboring particle i
-    if (denssum_j and status_j == PARTICLEENGINE::Owned)
-      denssum_j[0] += particlepair.Wji_ * mass_j[0];
-  }
+        // sum contribution of neighboring particle i
+        if (denssum_j and status_j == PARTICLEENGINE::Owned)
+          denssum_j[0] += particlepair.Wji_ * mass_j[0];
+      });
 }
 
 void ParticleInteraction::SPHDensityBase::sum_weighted_mass_particle_wall_contribution() const
@@ -303,20 +309,24 @@ void ParticleInteraction::SPHDensityBase::sum_colorfield_self_contribution() con
     PARTICLEENGINE::ParticleContainer* container_i =
         particlecontainerbundle_->get_specific_container(type_i, PARTICLEENGINE::Owned);
 
+    // get view on particle states
+    const PARTICLEENGINE::ParticleStateView rad =
+        container_i->get_state_view(PARTICLEENGINE::Radius);
+    const PARTICLEENGINE::ParticleStateView mass =
+        container_i->get_state_view(PARTICLEENGINE::Mass);
+    const PARTICLEENGINE::ParticleStateView dens =
+        container_i->get_state_view(PARTICLEENGINE::Density);
+    const PARTICLEENGINE::ParticleStateView colorfield =
+        container_i->get_state_view(PARTICLEENGINE::Colorfield);
+
     // iterate over particles in container
-    for (int particle_i = 0; particle_i < container_i->particles_stored(); ++particle_i)
+    for (int particle_i = 0; particle_i < colorfield.size(); ++particle_i)
     {
-      // get pointer to particle states
-      const double* rad_i = container_i->get_ptr_to_state(PARTICLEENGINE::Radius, particle_i);
-      const double* mass_i = container_i->get_ptr_to_state(PARTICLEENGINE::Mass, particle_i);
-      const double* dens_i = container_i->get_ptr_to_state(PARTICLEENGINE::Density, particle_i);
-      double* colorfield_i = container_i->get_ptr_to_state(PARTICLEENGINE::Colorfield, particle_i);
-
       // evaluate kernel
-      const double Wii = kernel_->w0(rad_i[0]);
+      const double Wii = kernel_->w0(rad[particle_i][0]);
 
       // add self contribution
-      colorfield_i[0] += (Wii / dens_i[0]) * mass_i[0];
+      colorfield[particle_i][0] += (Wii / dens[particle_i][0]) * mass[particle_i][0];
     }
   }
 }
@@ -326,60 +336,63 @@ void ParticleInteraction::SPHDensityBase::sum_colorfield_particle_contribution()
   TEUCHOS_FUNC_TIME_MONITOR(
       "ParticleInteraction::SPHDensityBase::sum_colorfield_particle_contribution");
 
-  // iterate over particle pairs
-  for (auto& particlepair : neighborpairs_->get_ref_to_particle_pair_data())
-  {
-    // access values of local index tuples of particle i and j
-    PARTICLEENGINE::TypeEnum type_i;
-    PARTICLEENGINE::StatusEnum status_i;
-    int particle_i;
-    std::tie(type_i, status_i, particle_i) = particlepair.tuple_i_;
+  // iterate over particle pairs, pairs without common particle in parallel
+  neighborpairs_->for_each_particle_pair(
+      [&](const SPHParticlePair& particlepair)
+      {
+        // access values of local index tuples of particle i and j
+        PARTICLEENGINE::TypeEnum type_i;
+        PARTICLEENGINE::StatusEnum status_i;
+        int particle_i;
+        std::tie(type_i, status_i, particle_i) = particlepair.tuple_i_;
 
-    PARTICLEENGINE::TypeEnum type_j;
-    PARTICLEENGINE::StatusEnum status_j;
-    int particle_j;
-    std::tie(type_j, status_j, particle_j) = particlepair.tuple_j_;
+        PARTICLEENGINE::TypeEnum type_j;
+        PARTICLEENGINE::StatusEnum status_j;
+        int particle_j;
+        std::tie(type_j, status_j, particle_j) = particlepair.tuple_j_;
 
-    // get corresponding particle containers
-    PARTICLEENGINE::ParticleContainer* container_i =
-        particlecontainerbundle_->get_specific_container(type_i, status_i);
+        // get corresponding particle containers
+        PARTICLEENGINE::ParticleContainer* container_i =
+            particlecontainerbundle_->get_specific_container(type_i, status_i);
 
-    PARTICLEENGINE::ParticleContainer* container_j =
-        particlecontainerbundle_->get_specific_container(type_j, status_j);
+        PARTICLEENGINE::ParticleContainer* container_j =
+            particlecontainerbundle_->get_specific_container(type_j, status_j);
 
-    // get material for particle types
-    const Mat::PAR::ParticleMaterialBase* material_i =
-        particlematerial_->get_ptr_to_particle_mat_parameter(type_i);
+        // get material for particle types
+        const Mat::PAR::ParticleMaterialBase* material_i =
+            particlematerial_->get_ptr_to_particle_mat_parameter(type_i);
 
-    const Mat::PAR::ParticleMaterialBase* material_j =
-        particlematerial_->get_ptr_to_particle_mat_parameter(type_j);
+        const Mat::PAR::ParticleMaterialBase* material_j =
+            particlematerial_->get_ptr_to_particle_mat_parameter(type_j);
 
-    // get pointer to particle states
-    const double* mass_i = container_i->get_ptr_to_state(PARTICLEENGINE::Mass, particle_i);
+        // get pointer to particle states
+        const double* mass_i = container_i->get_ptr_to_state(PARTICLEENGINE::Mass, particle_i);
 
-    const double* dens_i = container_i->have_stored_state(PARTICLEENGINE::Density)
-                               ? container_i->get_ptr_to_state(PARTICLEENGINE::Density, particle_i)
-                               : &(material_j->initDensity_);
+        const double* dens_i =
+            container_i->have_stored_state(PARTICLEENGINE::Density)
+                ? container_i->get_ptr_to_state(PARTICLEENGINE::Density, particle_i)
+                : &(material_j->initDensity_);
 
-    double* colorfield_i =
-        container_i->cond_get_ptr_to_state(PARTICLEENGINE::Colorfield, particle_i);
+        double* colorfield_i =
+            container_i->cond_get_ptr_to_state(PARTICLEENGINE::Colorfield, particle_i);
 
-    const double* mass_j = container_j->get_ptr_to_state(PARTICLEENGINE::Mass, particle_j);
+        const double* mass_j = container_j->get_ptr_to_state(PARTICLEENGINE::Mass, particle_j);
 
-    const double* dens_j = container_j->have_stored_state(PARTICLEENGINE::Density)
-                               ? container_j->get_ptr_to_state(PARTICLEENGINE::Density, particle_j)
-                               : &(material_i->initDensity_);
+        const double* dens_j =
+            container_j->have_stored_state(PARTICLEENGINE::Density)
+                ? container_j->get_ptr_to_state(PARTICLEENGINE::Density, particle_j)
+                : &(material_i->initDensity_);
 
-    double* colorfield_j =
-        container_j->cond_get_ptr_to_state(PARTICLEENGINE::Colorfield, particle_j);
+        double* colorfield_j =
+            container_j->cond_get_ptr_to_state(PARTICLEENGINE::Colorfield, particle_j);
 
-    // sum contribution of neighboring particle j
-    if (colorfield_i) colorfield_i[0] += (particlepair.Wij_ / dens_j[0]) * mass_j[0];
+        // sum contribution of neighboring particle j
+        if (colorfield_i) colorfield_i[0] += (particlepair.Wij_ / dens_j[0]) * mass_j[0];
 
-    // sum contribution of neighboring particle i
-    if (colorfield_j and status_j == PARTICLEENGINE::Owned)
-      colorfield_j[0] += (particlepair.Wji_ / dens_i[0]) * mass_i[0];
-  }
+        // sum contribution of neighboring particle i
+        if (colorfield_j and status_j == PARTICLEENGINE::Owned)
+          colorfield_j[0] += (particlepair.Wji_ / dens_i[0]) * mass_i[0];
+      });
 }
 
 void ParticleInteraction::SPHDensityBase::sum_colorfield_particle_wall_contribution() const
@@ -489,76 +502,81 @@ void ParticleInteraction::SPHDensityBase::continuity_equation_particle_contribut
   TEUCHOS_FUNC_TIME_MONITOR(
       "ParticleInteraction::SPHDensityBase::continuity_equation_particle_contribution");
 
-  // iterate over particle pairs
-  for (auto& particlepair : neighborpairs_->get_ref_to_particle_pair_data())
-  {
-    // access values of local index tuples of particle i and j
-    PARTICLEENGINE::TypeEnum type_i;
-    PARTICLEENGINE::StatusEnum status_i;
-    int particle_i;
-    std::tie(type_i, status_i, particle_i) = particlepair.tuple_i_;
+  // iterate over particle pairs, pairs without common particle in parallel
+  neighborpairs_->for_each_particle_pair(
+      [&](const SPHParticlePair& particlepair)
+      {
+        // access values of local index tuples of particle i and j
+        PARTICLEENGINE::TypeEnum type_i;
+        PARTICLEENGINE::StatusEnum status_i;
+        int particle_i;
+        std::tie(type_i, status_i, particle_i) = particlepair.tuple_i_;
 
-    PARTICLEENGINE::TypeEnum type_j;
-    PARTICLEENGINE::StatusEnum status_j;
-    int particle_j;
-    std::tie(type_j, status_j, particle_j) = particlepair.tuple_j_;
+        PARTICLEENGINE::TypeEnum type_j;
+        PARTICLEENGINE::StatusEnum status_j;
+        int particle_j;
+        std::tie(type_j, status_j, particle_j) = particlepair.tuple_j_;
 
-    // get corresponding particle containers
-    PARTICLEENGINE::ParticleContainer* container_i =
-        particlecontainerbundle_->get_specific_container(type_i, status_i);
+        // get corresponding particle containers
+        PARTICLEENGINE::ParticleContainer* container_i =
+            particlecontainerbundle_->get_specific_container(type_i, status_i);
 
-    PARTICLEENGINE::ParticleContainer* container_j =
-        particlecontainerbundle_->get_specific_container(type_j, status_j);
+        PARTICLEENGINE::ParticleContainer* container_j =
+            particlecontainerbundle_->get_specific_container(type_j, status_j);
 
-    // get material for particle types
-    const Mat::PAR::ParticleMaterialBase* material_i =
-        particlematerial_->get_ptr_to_particle_mat_parameter(type_i);
+        // get material for particle types
+        const Mat::PAR::ParticleMaterialBase* material_i =
+            particlematerial_->get_ptr_to_particle_mat_parameter(type_i);
 
-    const Mat::PAR::ParticleMaterialBase* material_j =
-        particlematerial_->get_ptr_to_particle_mat_parameter(type_j);
+        const Mat::PAR::ParticleMaterialBase* material_j =
+            particlematerial_->get_ptr_to_particle_mat_parameter(type_j);
 
-    // get pointer to particle states
-    const double* vel_i =
-        container_i->have_stored_state(PARTICLEENGINE::ModifiedVelocity)
-            ? container_i->get_ptr_to_state(PARTICLEENGINE::ModifiedVelocity, particle_i)
-            : container_i->get_ptr_to_state(PARTICLEENGINE::Velocity, particle_i);
+        // get pointer to particle states
+        const double* vel_i =
+            container_i->have_stored_state(PARTICLEENGINE::ModifiedVelocity)
+                ? container_i->get_ptr_to_state(PARTICLEENGINE::ModifiedVelocity, particle_i)
+                : container_i->get_ptr_to_state(PARTICLEENGINE::Velocity, particle_i);
 
-    const double* mass_i = container_i->get_ptr_to_state(PARTICLEENGINE::Mass, particle_i);
+        const double* mass_i = container_i->get_ptr_to_state(PARTICLEENGINE::Mass, particle_i);
 
-    const double* dens_i = container_i->have_stored_state(PARTICLEENGINE::Density)
-                               ? container_i->get_ptr_to_state(PARTICLEENGINE::Density, particle_i)
-                               : &(material_j->initDensity_);
+        const double* dens_i =
+            container_i->have_stored_state(PARTICLEENGINE::Density)
+                ? container_i->get_ptr_to_state(PARTICLEENGINE::Density, particle_i)
+                : &(material_j->initDensity_);
 
-    double* densdot_i = container_i->cond_get_ptr_to_state(PARTICLEENGINE::DensityDot, particle_i);
+        double* densdot_i =
+            container_i->cond_get_ptr_to_state(PARTICLEENGINE::DensityDot, particle_i);
 
-    const double* vel_j =
-        container_j->have_stored_state(PARTICLEENGINE::ModifiedVelocity)
-            ? container_j->get_ptr_to_state(PARTICLEENGINE::ModifiedVelocity, particle_j)
-            : container_j->get_ptr_to_state(PARTICLEENGINE::Velocity, particle_j);
+        const double* vel_j =
+            container_j->have_stored_state(PARTICLEENGINE::ModifiedVelocity)
+                ? container_j->get_ptr_to_state(PARTICLEENGINE::ModifiedVelocity, particle_j)
+                : container_j->get_ptr_to_state(PARTICLEENGINE::Velocity, particle_j);
 
-    const double* mass_j = container_j->get_ptr_to_state(PARTICLEENGINE::Mass, particle_j);
+        const double* mass_j = container_j->get_ptr_to_state(PARTICLEENGINE::Mass, particle_j);
 
-    const double* dens_j = container_j->have_stored_state(PARTICLEENGINE::Density)
-                               ? container_j->get_ptr_to_state(PARTICLEENGINE::Density, particle_j)
-                               : &(material_i->initDensity_);
+        const double* dens_j =
+            container_j->have_stored_state(PARTICLEENGINE::Density)
+                ? container_j->get_ptr_to_state(PARTICLEENGINE::Density, particle_j)
+                : &(material_i->initDensity_);
 
-    double* densdot_j = container_j->cond_get_ptr_to_state(PARTICLEENGINE::DensityDot, particle_j);
+        double* densdot_j =
+            container_j->cond_get_ptr_to_state(PARTICLEENGINE::DensityDot, particle_j);
 
-    // relative velocity (use modified velocities in case of transport velocity formulation)
-    double vel_ij[3];
-    Utils::vec_set(vel_ij, vel_i);
-    Utils::vec_sub(vel_ij, vel_j);
+        // relative velocity (use modified velocities in case of transport velocity formulation)
+        double vel_ij[3];
+        Utils::vec_set(vel_ij, vel_i);
+        Utils::vec_sub(vel_ij, vel_j);
 
-    const double e_ij_vel_ij = Utils::vec_dot(particlepair.e_ij_, vel_ij);
+        const double e_ij_vel_ij = Utils::vec_dot(particlepair.e_ij_, vel_ij);
 
-    // sum contribution of neighboring particle j
-    if (densdot_i)
-      densdot_i[0] += dens_i[0] * (mass_j[0] / dens_j[0]) * particlepair.dWdrij_ * e_ij_vel_ij;
+        // sum contribution of neighboring particle j
+        if (densdot_i)
+          densdot_i[0] += dens_i[0] * (mass_j[0] / dens_j[0]) * particlepair.dWdrij_ * e_ij_vel_ij;
 
-    // sum contribution of neighboring particle i
-    if (densdot_j and status_j == PARTICLEENGINE::Owned)
-      densdot_j[0] += dens_j[0] * (mass_i[0] / dens_i[0]) * particlepair.dWdrji_ * e_ij_vel_ij;
-  }
+        // sum contribution of neighboring particle i
+        if (densdot_j and status_j == PARTICLEENGINE::Owned)
+          densdot_j[0] += dens_j[0] * (mass_i[0] / dens_i[0]) * particlepair.dWdrji_ * e_ij_vel_ij;
+      });
 }
 
 void ParticleInteraction::SPHDensityBase::continuity_equation_particle_wall_contribution() const
@@ -239,171 +239,184 @@ void ParticleInteraction::SPHMomentum::setup_particle_interaction_writer()
 }
 
 void ParticleInteraction::SPHMomentum::momentum_equation_particle_contribution() const
+{
+  // evaluate with the kernel type known at compile time
+  visit_kernel(
+      *kernel_, [this](const auto& kernel) { momentum_equation_particle_contribution(kernel); });
+}
+
+template <typename Kernel>
+void ParticleInteraction::SPHMomentum::momentum_equation_particle_contribution(
+    const Kernel& kernel) const
 {
   TEUCHOS_FUNC_TIME_MONITOR(
       "ParticleInteraction::SPHMomentum::momentum_equation_particle_contribution");
 
-  // get relevant particle pair indices
-  std::vector<int> relindices;
-  neighborpairs_->get_relevant_particle_pair_indices_for_equal_combination(
-      allfluidtypes_, relindices);
-
-  // iterate over relevant particle pairs
-  for (const int particlepairindex : relindices)
-  {
-    const SPHParticlePair& particlepair =
-        neighborpairs_->get_ref_to_particle_pair_data()[particlepairindex];
-
-    // access values of local index tuples of particle i and j
-    PARTICLEENGINE::TypeEnum type_i;
-    PARTICLEENGINE::StatusEnum status_i;
-    int particle_i;
-    std::tie(type_i, status_i, particle_i) = particlepair.tuple_i_;
-
-    PARTICLEENGINE::TypeEnum type_j;
-    PARTICLEENGINE::StatusEnum status_j;
-    int particle_j;
-    std::tie(type_j, status_j, particle_j) = particlepair.tuple_j_;
-
-    // get corresponding particle containers
-    PARTICLEENGINE::ParticleContainer* container_i =
-        particlecontainerbundle_->get_specific_container(type_i, status_i);
-
-    PARTICLEENGINE::ParticleContainer* container_j =
-        particlecontainerbundle_->get_specific_container(type_j, status_j);
-
-    // get material for particle types
-    const Mat::PAR::ParticleMaterialSPHFluid* material_i = fluidmaterial_[type_i];
-    const Mat::PAR::ParticleMaterialSPHFluid* material_j = fluidmaterial_[type_j];
-
-    // get pointer to particle states
-    const double* rad_i = container_i->get_ptr_to_state(PARTICLEENGINE::Radius, particle_i);
-    const double* mass_i = container_i->get_ptr_to_state(PARTICLEENGINE::Mass, particle_i);
-    const double* dens_i = container_i->get_ptr_to_state(PARTICLEENGINE::Density, particle_i);
-    const double* press_i = container_i->get_ptr_to_state(PARTICLEENGINE::Pressure, particle_i);
-    const double* vel_i = container_i->get_ptr_to_state(PARTICLEENGINE::Velocity, particle_i);
-
-    double* acc_i = nullptr;
-    if (intfluidtypes_.count(type_i))
-      acc_i = container_i->get_ptr_to_state(PARTICLEENGINE::Acceleration, particle_i);
-
-    const double* mod_vel_i =
-        container_i->cond_get_ptr_to_state(PARTICLEENGINE::ModifiedVelocity, particle_i);
-    double* mod_acc_i =
-        container_i->cond_get_ptr_to_state(PARTICLEENGINE::ModifiedAcceleration, particle_i);
-
-    // get pointer to particle states
-    const double* rad_j = container_j->get_ptr_to_state(PARTICLEENGINE::Radius, particle_j);
-    const double* mass_j = container_j->get_ptr_to_state(PARTICLEENGINE::Mass, particle_j);
-    const double* dens_j = container_j->get_ptr_to_state(PARTICLEENGINE::Density, particle_j);
-    const double* press_j = container_j->get_ptr_to_state(PARTICLEENGINE::Pressure, particle_j);
-    const double* vel_j = container_j->get_ptr_to_state(PARTICLEENGINE::Velocity, particle_j);
-
-    double* acc_j = nullptr;
-    if (intfluidtypes_.count(type_j) and status_j == PARTICLEENGINE::Owned)
-      acc_j = container_j->get_ptr_to_state(PARTICLEENGINE::Acceleration, particle_j);
-
-    const double* mod_vel_j =
-        container_j->cond_get_ptr_to_state(PARTICLEENGINE::ModifiedVelocity, particle_j);
-
-    double* mod_acc_j = nullptr;
-    if (status_j == PARTICLEENGINE::Owned)
-      mod_acc_j =
-          container_j->cond_get_ptr_to_state(PARTICLEENGINE::ModifiedAcceleration, particle_j);
+  // iterate over relevant particle pairs, pairs without common particle in parallel
+  neighborpairs_->for_each_particle_pair_for_equal_combination(allfluidtypes_,
+      [&](const SPHParticlePair& particlepair)
+      {
+        // access values of local index tuples of particle i and j
+        PARTICLEENGINE::TypeEnum type_i;
+        PARTICLEENGINE::StatusEnum status_i;
+        int particle_i;
+        std::tie(type_i, status_i, particle_i) = particlepair.tuple_i_;
+
+        PARTICLEENGINE::TypeEnum type_j;
+        PARTICLEENGINE::StatusEnum status_j;
+        int particle_j;
+        std::tie(type_j, status_j, particle_j) = particlepair.tuple_j_;
+
+        // get corresponding particle containers
+        PARTICLEENGINE::ParticleContainer* container_i =
+            particlecontainerbundle_->get_specific_container(type_i, status_i);
+
+        PARTICLEENGINE::ParticleContainer* container_j =
+            particlecontainerbundle_->get_specific_container(type_j, status_j);
+
+        // get material for particle types
+        const Mat::PAR::ParticleMaterialSPHFluid* material_i = fluidmaterial_[type_i];
+        const Mat::PAR::ParticleMaterialSPHFluid* material_j = fluidmaterial_[type_j];
+
+        // get pointer to particle states
+        const double* rad_i = container_i->get_ptr_to_state(PARTICLEENGINE::Radius, particle_i);
+        const double* mass_i = container_i->get_ptr_to_state(PARTICLEENGINE::Mass, particle_i);
+        const double* dens_i = container_i->get_ptr_to_state(PARTICLEENGINE::Density, particle_i);
+        const double* press_i = container_i->get_ptr_to_state(PARTICLEENGINE::Pressure, particle_i);
+        const double* vel_i = container_i->get_ptr_to_state(PARTICLEENGINE::Velocity, particle_i);
+
+        double* acc_i = nullptr;
+        if (intfluidtypes_.count(type_i))
+          acc_i = container_i->get_ptr_to_state(PARTICLEENGINE::Acceleration, particle_i);
+
+        const double* mod_vel_i =
+            container_i->cond_get_ptr_to_state(PARTICLEENGINE::ModifiedVelocity, particle_i);
+        double* mod_acc_i =
+            container_i->cond_get_ptr_to_state(PARTICLEENGINE::ModifiedAcceleration, particle_i);
+
+        // get pointer to particle states
+        const double* rad_j = container_j->get_ptr_to_state(PARTICLEENGINE::Radius, particle_j);
+        const double* mass_j = container_j->get_ptr_to_state(PARTICLEENGINE::Mass, particle_j);
+        const double* dens_j = container_j->get_ptr_to_state(PARTICLEENGINE::Density, particle_j);
+        const double* press_j = container_j->get_ptr_to_state(PARTICLEENGINE::Pressure, particle_j);
+        const double* vel_j = container_j->get_ptr_to_state(PARTICLEENGINE::Velocity, particle_j);
+
+        double* acc_j = nullptr;
+        if (intfluidtypes_.count(type_j) and status_j == PARTICLEENGINE::Owned)
+          acc_j = container_j->get_ptr_to_state(PARTICLEENGINE::Acceleration, particle_j);
+
+        const double* mod_vel_j =
+            container_j->cond_get_ptr_to_state(PARTICLEENGINE::ModifiedVelocity, particle_j);
+
+        double* mod_acc_j = nullptr;
+        if (status_j == PARTICLEENGINE::Owned)
+          mod_acc_j =
+              container_j->cond_get_ptr_to_state(PARTICLEENGINE::ModifiedAcceleration, particle_j);
 
-    // evaluate specific coefficient
-    double speccoeff_ij(0.0);
-    double speccoeff_ji(0.0);
-    momentumformulation_->specific_coefficient(dens_i, dens_j, mass_i, mass_j, particlepair.dWdrij_,
-        particlepair.dWdrji_, &speccoeff_ij, &speccoeff_ji);
+        // evaluate specific coefficient
+        double speccoeff_ij(0.0);
+        double speccoeff_ji(0.0);
+        momentumformulation_->specific_coefficient(dens_i, dens_j, mass_i, mass_j,
+            particlepair.dWdrij_, particlepair.dWdrji_, &speccoeff_ij, &speccoeff_ji);
 
-    // evaluate pressure gradient
-    momentumformulation_->pressure_gradient(dens_i, dens_j, press_i, press_j, speccoeff_ij,
-        speccoeff_ji, particlepair.e_ij_, acc_i, acc_j);
+        // evaluate pressure gradient
+        momentumformulation_->pressure_gradient(dens_i, dens_j, press_i, press_j, speccoeff_ij,
+            speccoeff_ji, particlepair.e_ij_, acc_i, acc_j);
 
-    // evaluate shear forces
-    {
-      // get factor from kernel space dimension
-      int kernelfac = 0;
-      kernel_->kernel_space_dimension(kernelfac);
-      kernelfac += 2;
+        // evaluate shear forces
+        {
+          // get factor from kernel space dimension
+          int kernelfac = 0;
+          kernel.kernel_space_dimension(kernelfac);
+          kernelfac += 2;
 
-      // evaluate shear forces
-      momentumformulation_->shear_forces(dens_i, dens_j, vel_i, vel_j, kernelfac,
-          material_i->dynamicViscosity_, material_j->dynamicViscosity_, material_i->bulkViscosity_,
-          material_j->bulkViscosity_, particlepair.absdist_, speccoeff_ij, speccoeff_ji,
-          particlepair.e_ij_, acc_i, acc_j);
-    }
+          // evaluate shear forces
+          momentumformulation_->shear_forces(dens_i, dens_j, vel_i, vel_j, kernelfac,
+              material_i->dynamicViscosity_, material_j->dynamicViscosity_,
+              material_i->bulkViscosity_, material_j->bulkViscosity_, particlepair.absdist_,
+              speccoeff_ij, speccoeff_ji, particlepair.e_ij_, acc_i, acc_j);
+        }
 
-    // apply transport velocity formulation
-    if (transportvelocityformulation_ ==
-        Inpar::PARTICLE::TransportVelocityFormulation::StandardTransportVelocity)
-    {
-      // evaluate background pressure (standard formulation)
-      momentumformulation_->standard_background_pressure(dens_i, dens_j,
-          material_i->backgroundPressure_, material_j->backgroundPressure_, speccoeff_ij,
-          speccoeff_ji, particlepair.e_ij_, mod_acc_i, mod_acc_j);
+        // apply transport velocity formulation
+        if (transportvelocityformulation_ ==
+            Inpar::PARTICLE::TransportVelocityFormulation::StandardTransportVelocity)
+        {
+          // evaluate background pressure (standard formulation)
+          momentumformulation_->standard_background_pressure(dens_i, dens_j,
+              material_i->backgroundPressure_, material_j->backgroundPressure_, speccoeff_ij,
+              speccoeff_ji, particlepair.e_ij_, mod_acc_i, mod_acc_j);
 
-      // evaluate convection of momentum with relative velocity
-      momentumformulation_->modified_velocity_contribution(dens_i, dens_j, vel_i, vel_j, mod_vel_i,
-          mod_vel_j, speccoeff_ij, speccoeff_ji, particlepair.e_ij_, acc_i, acc_j);
-    }
-    else if (transportvelocityformulation_ ==
-             Inpar::PARTICLE::TransportVelocityFormulation::GeneralizedTransportVelocity)
-    {
-      // modified first derivative of kernel
-      const double mod_dWdrij =
-          (mod_acc_i) ? kernel_->d_wdrij(particlepair.absdist_, kernel_->smoothing_length(rad_i[0]))
-                      : 0.0;
-      const double mod_dWdrji =
-          (mod_acc_j) ? kernel_->d_wdrij(particlepair.absdist_, kernel_->smoothing_length(rad_j[0]))
-                      : 0.0;
+          // evaluate convection of momentum with relative velocity
+          momentumformulation_->modified_velocity_contribution(dens_i, dens_j, vel_i, vel_j,
+              mod_vel_i, mod_vel_j, speccoeff_ij, speccoeff_ji, particlepair.e_ij_, acc_i, acc_j);
+        }
+        else if (transportvelocityformulation_ ==
+                 Inpar::PARTICLE::TransportVelocityFormulation::GeneralizedTransportVelocity)
+        {
+          // modified first derivative of kernel
+          const double mod_dWdrij =
+              (mod_acc_i)
+                  ? kernel.d_wdrij(particlepair.absdist_, kernel.smoothing_length(rad_i[0]))
+                  : 0.0;
+          const double mod_dWdrji =
+              (mod_acc_j)
+                  ? kernel.d_wdrij(particlepair.absdist_, kernel.smoothing_length(rad_j[0]))
+                  : 0.0;
 
-      // modified background pressure
-      const double mod_bg_press_i =
-          (mod_acc_i) ? std::min(std::abs(10.0 * press_i[0]), material_i->backgroundPressure_)
-                      : 0.0;
-      const double mod_bg_press_j =
-          (mod_acc_j) ? std::min(std::abs(10.0 * press_j[0]), material_j->backgroundPressure_)
-                      : 0.0;
+          // modified background pressure
+          const double mod_bg_press_i =
+              (mod_acc_i) ? std::min(std::abs(10.0 * press_i[0]), material_i->backgroundPressure_)
+                          : 0.0;
+          const double mod_bg_press_j =
+              (mod_acc_j) ? std::min(std::abs(10.0 * press_j[0]), material_j->backgroundPressure_)
+                          : 0.0;
 
-      // evaluate background pressure (generalized formulation)
-      momentumformulation_->generalized_background_pressure(dens_i, dens_j, mass_i, mass_j,
-          mod_bg_press_i, mod_bg_press_j, mod_dWdrij, mod_dWdrji, particlepair.e_ij_, mod_acc_i,
-          mod_acc_j);
+          // evaluate background pressure (generalized formulation)
+          momentumformulation_->generalized_background_pressure(dens_i, dens_j, mass_i, mass_j,
+              mod_bg_press_i, mod_bg_press_j, mod_dWdrij, mod_dWdrji, particlepair.e_ij_,
+              mod_acc_i, mod_acc_j);
 
-      // evaluate convection of momentum with relative velocity
-      momentumformulation_->modified_velocity_contribution(dens_i, dens_j, vel_i, vel_j, mod_vel_i,
-          mod_vel_j, speccoeff_ij, speccoeff_ji, particlepair.e_ij_, acc_i, acc_j);
-    }
+          // evaluate convection of momentum with relative velocity
+          momentumformulation_->modified_velocity_contribution(dens_i, dens_j, vel_i, vel_j,
+              mod_vel_i, mod_vel_j, speccoeff_ij, speccoeff_ji, particlepair.e_ij_, acc_i, acc_j);
+        }
 
-    // evaluate artificial viscosity
-    if (material_i->artificialViscosity_ > 0.0 or material_j->artificialViscosity_ > 0.0)
-    {
-      // particle averaged smoothing length
-      const double h_ij =
-          0.5 * (kernel_->smoothing_length(rad_i[0]) + kernel_->smoothing_length(rad_j[0]));
+        // evaluate artificial viscosity
+        if (material_i->artificialViscosity_ > 0.0 or material_j->artificialViscosity_ > 0.0)
+        {
+          // particle averaged smoothing length
+          const double h_ij =
+              0.5 * (kernel.smoothing_length(rad_i[0]) + kernel.smoothing_length(rad_j[0]));
 
-      // get speed of sound
-      const double c_i = material_i->speed_of_sound();
-      const double c_j = (type_i == type_j) ? c_i : material_j->speed_of_sound();
+          // get speed of sound
+          const double c_i = material_i->speed_of_sound();
+          const double c_j = (type_i == type_j) ? c_i : material_j->speed_of_sound();
 
-      // particle averaged speed of sound
-      const double c_ij = 0.5 * (c_i + c_j);
+          // particle averaged speed of sound
+          const double c_ij = 0.5 * (c_i + c_j);
 
-      // particle averaged density
-      const double dens_ij = 0.5 * (dens_i[0] + dens_j[0]);
+          // particle averaged density
+          const double dens_ij = 0.5 * (dens_i[0] + dens_j[0]);
 
-      // evaluate artificial viscosity
-      artificialviscosity_->artificial_viscosity(vel_i, vel_j, mass_i, mass_j,
-          material_i->artificialViscosity_, material_j->artificialViscosity_, particlepair.dWdrij_,
-          particlepair.dWdrji_, dens_ij, h_ij, c_ij, particlepair.absdist_, particlepair.e_ij_,
-          acc_i, acc_j);
-    }
-  }
+          // evaluate artificial viscosity
+          artificialviscosity_->artificial_viscosity(vel_i, vel_j, mass_i, mass_j,
+              material_i->artificialViscosity_, material_j->artificialViscosity_,
+              particlepair.dWdrij_, particlepair.dWdrji_, dens_ij, h_ij, c_ij,
+              particlepair.absdist_, particlepair.e_ij_, acc_i, acc_j);
+        }
+      });
 }
 
 void ParticleInteraction::SPHMomentum::momentum_equation_particle_boundary_contribution() const
+{
+  // evaluate with the kernel type known at compile time
+  visit_kernel(*kernel_,
+      [this](const auto& kernel) { momentum_equation_particle_boundary_contribution(kernel); });
+}
+
+template <typename Kernel>
+void ParticleInteraction::SPHMomentum::momentum_equation_particle_boundary_contribution(
+    const Kernel& kernel) const
 {
   TEUCHOS_FUNC_TIME_MONITOR(
       "ParticleInteraction::SPHMomentum::momentum_equation_particle_boundary_contribution");
@@ -515,7 +528,7 @@ void ParticleInteraction::SPHMomentum::momentum_equation_particle_boundary_contr
     {
       // get factor from kernel space dimension
       int kernelfac = 0;
-      kernel_->kernel_space_dimension(kernelfac);
+      kernel.kernel_space_dimension(kernelfac);
       kernelfac += 2;
 
       // evaluate shear forces
@@ -540,7 +553,7 @@ void ParticleInteraction::SPHMomentum::momentum_equation_particle_boundary_contr
              Inpar::PARTICLE::TransportVelocityFormulation::GeneralizedTransportVelocity)
     {
       // modified first derivative of kernel
-      const double mod_dWdrij = kernel_->d_wdrij(absdist, kernel_->smoothing_length(rad_i[0]));
+      const double mod_dWdrij = kernel.d_wdrij(absdist, kernel.smoothing_length(rad_i[0]));
 
       // modified background pressure
       const double mod_bg_press_i =
@@ -560,7 +573,7 @@ void ParticleInteraction::SPHMomentum::momentum_equation_particle_boundary_contr
         material_i->artificialViscosity_ > 0.0)
     {
       // get smoothing length
-      const double h_i = kernel_->smoothing_length(rad_i[0]);
+      const double h_i = kernel.smoothing_length(rad_i[0]);
 
       // get speed of sound
       const double c_i = material_i->speed_of_sound();
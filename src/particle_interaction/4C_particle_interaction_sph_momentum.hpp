@@ -109,9 +109,17 @@ namespace ParticleInteraction
     //! momentum equation (particle contribution)
     void momentum_equation_particle_contribution() const;
 
+    //! momentum equation (particle contribution) with kernel of final type
+    template <typename Kernel>
+    void momentum_equation_particle_contribution(const Kernel& kernel) const;
+
     //! momentum equation (particle-boundary contribution)
     void momentum_equation_particle_boundary_contribution() const;
 
+    //! momentum equation (particle-boundary contribution) with kernel of final type
+    template <typename Kernel>
+    void momentum_equation_particle_boundary_contribution(const Kernel& kernel) const;
+
     //! momentum equation (particle-wall contribution)
     void momentum_equation_particle_wall_contribution() const;
 
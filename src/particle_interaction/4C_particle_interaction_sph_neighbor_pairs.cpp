@@ -18,12 +18,18 @@
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
  | definitions                                                               |
  *---------------------------------------------------------------------------*/
-ParticleInteraction::SPHNeighborPairs::SPHNeighborPairs()
+ParticleInteraction::SPHNeighborPairs::SPHNeighborPairs(double verletskin)
+    : verletlist_(verletskin)
 {
   // empty constructor
 }
@@ -44,6 +50,9 @@ void ParticleInteraction::SPHNeighborPairs::setup(
   // set particle container bundle
   particlecontainerbundle_ = particleengineinterface_->get_particle_container_bundle();
 
+  // setup verlet list
+  verletlist_.setup(particleengineinterface);
+
   // set interface to particle wall handler
   particlewallinterface_ = particlewallinterface;
 
@@ -129,8 +138,13 @@ void ParticleInteraction::SPHNeighborPairs::evaluate_particle_pairs()
   // index of particle pairs
   int particlepairindex = 0;
 
-  // iterate over potential particle neighbors
-  for (auto& potentialneighbors : particleengineinterface_->get_potential_particle_neighbors())
+  // get candidate particle pairs within interaction distance plus skin distance
+  const PARTICLEENGINE::PotentialParticleNeighbors& candidateparticlepairs =
+      verletlist_.get_candidate_particle_pairs(
+          [](double rad_i, double rad_j) { return std::min(rad_i, rad_j); });
+
+  // iterate over candidate particle pairs
+  for (const auto& potentialneighbors : candidateparticlepairs)
   {
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
@@ -198,40 +212,175 @@ void ParticleInteraction::SPHNeighborPairs::evaluate_particle_pairs()
 
       // versor from particle j to i
       Utils::vec_set_scale(particlepair.e_ij_, -1.0 / absdist, r_ji);
+    }
+  }
 
-      // particle j within support radius of particle i
-      if (absdist < rad_i[0])
-      {
-        // evaluate kernel
-        particlepair.Wij_ = kernel_->w(absdist, rad_i[0]);
+  // evaluate kernel with the kernel type known at compile time
+  visit_kernel(*kernel_, [this](const auto& kernel) { evaluate_particle_pair_kernels(kernel); });
 
-        // evaluate first derivative of kernel
-        particlepair.dWdrij_ = kernel_->d_wdrij(absdist, rad_i[0]);
-      }
+  // color particle pairs for parallel evaluation
+  if (Core::Utils::max_threads() > 1) color_particle_pairs();
+}
 
-      // particle i within support radius of owned particle j
-      if (absdist < rad_j[0])
+template <typename Kernel>
+void ParticleInteraction::SPHNeighborPairs::evaluate_particle_pair_kernels(const Kernel& kernel)
+{
+  // every particle pair only writes to itself
+  Core::Utils::parallel_for(
+      static_cast<int>(particlepairdata_.size()), Core::Utils::max_threads(),
+      [&](int particlepairindex)
       {
-        // equal support radius for particle i and j
-        if (rad_i[0] == rad_j[0])
+        SPHParticlePair& particlepair = particlepairdata_[particlepairindex];
+
+        // access values of local index tuples of particle i and j
+        PARTICLEENGINE::TypeEnum type_i;
+        PARTICLEENGINE::StatusEnum status_i;
+        int particle_i;
+        std::tie(type_i, status_i, particle_i) = particlepair.tuple_i_;
+
+        PARTICLEENGINE::TypeEnum type_j;
+        PARTICLEENGINE::StatusEnum status_j;
+        int particle_j;
+        std::tie(type_j, status_j, particle_j) = particlepair.tuple_j_;
+
+        // get pointer to particle states
+        const double* rad_i =
+            particlecontainerbundle_->get_specific_container(type_i, status_i)
+                ->get_ptr_to_state(PARTICLEENGINE::Radius, particle_i);
+
+        const double* rad_j =
+            particlecontainerbundle_->get_specific_container(type_j, status_j)
+                ->get_ptr_to_state(PARTICLEENGINE::Radius, particle_j);
+
+        const double absdist = particlepair.absdist_;
+
+        // particle j within support radius of particle i
+        if (absdist < rad_i[0])
         {
           // evaluate kernel
-          particlepair.Wji_ = particlepair.Wij_;
+          particlepair.Wij_ = kernel.w(absdist, rad_i[0]);
 
           // evaluate first derivative of kernel
-          particlepair.dWdrji_ = particlepair.dWdrij_;
+          particlepair.dWdrij_ = kernel.d_wdrij(absdist, rad_i[0]);
         }
-        else
+
+        // particle i within support radius of owned particle j
+        if (absdist < rad_j[0])
         {
-          // evaluate kernel
-          particlepair.Wji_ = kernel_->w(absdist, rad_j[0]);
+          // equal support radius for particle i and j
+          if (rad_i[0] == rad_j[0])
+          {
+            // evaluate kernel
+            particlepair.Wji_ = particlepair.Wij_;
 
-          // evaluate first derivative of kernel
-          particlepair.dWdrji_ = kernel_->d_wdrij(absdist, rad_j[0]);
+            // evaluate first derivative of kernel
+            particlepair.dWdrji_ = particlepair.dWdrij_;
+          }
+          else
+          {
+            // evaluate kernel
+            particlepair.Wji_ = kernel.w(absdist, rad_j[0]);
+
+            // evaluate first derivative of kernel
+            particlepair.dWdrji_ = kernel.d_wdrij(absdist, rad_j[0]);
+          }
         }
-      }
+      },
+      256);
+}
+
+void ParticleInteraction::SPHNeighborPairs::color_particle_pairs()
+{
+  TEUCHOS_FUNC_TIME_MONITOR("ParticleInteraction::SPHNeighborPairs::color_particle_pairs");
+
+  // offset of particles of each type and status in a consecutive numbering
+  std::vector<std::array<int, 2>> offset(indexofparticlepairs_.size(), {0, 0});
+  int numparticles = 0;
+  for (const auto& type : particlecontainerbundle_->get_particle_types())
+  {
+    for (const auto& status : {PARTICLEENGINE::Owned, PARTICLEENGINE::Ghosted})
+    {
+      offset[type][status] = numparticles;
+      numparticles +=
+          particlecontainerbundle_->get_specific_container(type, status)->particles_stored();
+    }
+  }
+
+  auto consecutive_index = [&](const PARTICLEENGINE::LocalIndexTuple& tuple)
+  { return offset[std::get<0>(tuple)][std::get<1>(tuple)] + std::get<2>(tuple); };
+
+  // greedy coloring needs at most 2 * (max number of pairs of a particle) - 1 colors
+  std::vector<int> numpairsofparticle(numparticles, 0);
+  for (const SPHParticlePair& particlepair : particlepairdata_)
+  {
+    ++numpairsofparticle[consecutive_index(particlepair.tuple_i_)];
+    ++numpairsofparticle[consecutive_index(particlepair.tuple_j_)];
+  }
+  const int maxnumpairs =
+      numparticles ? *std::max_element(numpairsofparticle.begin(), numpairsofparticle.end()) : 0;
+  const int numwords = (2 * maxnumpairs + 63) / 64;
+
+  // bit set of colors already used by pairs of each particle
+  std::vector<std::uint64_t> usedcolors(static_cast<std::size_t>(numparticles) * numwords, 0);
+
+  particlepaircolor_.resize(particlepairdata_.size());
+  numparticlepaircolors_ = 0;
+
+  for (std::size_t particlepairindex = 0; particlepairindex < particlepairdata_.size();
+      ++particlepairindex)
+  {
+    std::uint64_t* usedcolors_i =
+        &usedcolors[consecutive_index(particlepairdata_[particlepairindex].tuple_i_) * numwords];
+    std::uint64_t* usedcolors_j =
+        &usedcolors[consecutive_index(particlepairdata_[particlepairindex].tuple_j_) * numwords];
+
+    // smallest color used by neither particle
+    int color = 0;
+    for (int word = 0; word < numwords; ++word)
+    {
+      const std::uint64_t freecolors = ~(usedcolors_i[word] | usedcolors_j[word]);
+      if (freecolors == 0) continue;
+
+      int bit = 0;
+      while (not((freecolors >> bit) & 1)) ++bit;
+
+      color = 64 * word + bit;
+      usedcolors_i[word] |= (std::uint64_t(1) << bit);
+      usedcolors_j[word] |= (std::uint64_t(1) << bit);
+      break;
     }
+
+    particlepaircolor_[particlepairindex] = color;
+    numparticlepaircolors_ = std::max(numparticlepaircolors_, color + 1);
   }
+
+  // count particle pairs of each color and combination of particle types
+  offsetofcoloredparticlepairs_.assign(color_type_index(numparticlepaircolors_, 0, 0) + 1, 0);
+  for (const auto& type_i : particlecontainerbundle_->get_particle_types())
+    for (const auto& type_j : particlecontainerbundle_->get_particle_types())
+      for (const int particlepairindex : indexofparticlepairs_[type_i][type_j])
+      {
+        const int index = color_type_index(particlepaircolor_[particlepairindex], type_i, type_j);
+        ++offsetofcoloredparticlepairs_[index + 1];
+      }
+
+  std::partial_sum(offsetofcoloredparticlepairs_.begin(), offsetofcoloredparticlepairs_.end(),
+      offsetofcoloredparticlepairs_.begin());
+
+  // sort particle pairs by color and combination of particle types keeping their order otherwise
+  coloredparticlepairs_.resize(particlepairdata_.size());
+  for (const auto& type_i : particlecontainerbundle_->get_particle_types())
+    for (const auto& type_j : particlecontainerbundle_->get_particle_types())
+      for (const int particlepairindex : indexofparticlepairs_[type_i][type_j])
+      {
+        const int index = color_type_index(particlepaircolor_[particlepairindex], type_i, type_j);
+        coloredparticlepairs_[offsetofcoloredparticlepairs_[index]++] = particlepairindex;
+      }
+
+  // restore offsets shifted to the end of each range while sorting
+  std::copy_backward(offsetofcoloredparticlepairs_.begin(), offsetofcoloredparticlepairs_.end() - 1,
+      offsetofcoloredparticlepairs_.end());
+  offsetofcoloredparticlepairs_[0] = 0;
 }
 
 void ParticleInteraction::SPHNeighborPairs::evaluate_particle_wall_pairs()
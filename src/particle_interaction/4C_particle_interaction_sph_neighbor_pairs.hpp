@@ -16,6 +16,10 @@
 #include "4C_particle_engine_enums.hpp"
 #include "4C_particle_engine_typedefs.hpp"
 #include "4C_particle_interaction_sph_neighbor_pair_struct.hpp"
+#include "4C_particle_interaction_verlet_list.hpp"
+#include "4C_utils_shared_memory_parallel.hpp"
+
+#include <set>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -58,7 +62,7 @@ namespace ParticleInteraction
   {
    public:
     //! constructor
-    explicit SPHNeighborPairs();
+    explicit SPHNeighborPairs(double verletskin);
 
     //! init neighbor pair handler
     void init();
@@ -81,6 +85,12 @@ namespace ParticleInteraction
       return particlewallpairdata_;
     };
 
+    //! get reference to color of particle pairs (only evaluated with more than one thread)
+    inline const std::vector<int>& get_ref_to_particle_pair_color() const
+    {
+      return particlepaircolor_;
+    };
+
     //! get relevant particle pair indices for disjoint combination of particle types
     void get_relevant_particle_pair_indices_for_disjoint_combination(
         const std::set<PARTICLEENGINE::TypeEnum>& types_a,
@@ -97,10 +107,97 @@ namespace ParticleInteraction
     //! evaluate neighbor pairs
     void evaluate_neighbor_pairs();
 
+    /*!
+     * \brief call a function for all particle pairs
+     *
+     * With more than one thread, the particle pairs are processed one color at a time and the
+     * pairs of one color in parallel. Since no two pairs of one color share a particle, the
+     * function may add to the states of both particles of a pair without synchronization.
+     * Otherwise, the particle pairs are processed serially in the order of the pair data.
+     *
+     * \param[in] function function called with each particle pair
+     */
+    template <typename Function>
+    void for_each_particle_pair(Function&& function) const
+    {
+      const int numthreads = Core::Utils::max_threads();
+
+      if (numthreads == 1)
+      {
+        for (const SPHParticlePair& particlepair : particlepairdata_) function(particlepair);
+        return;
+      }
+
+      for (int color = 0; color < numparticlepaircolors_; ++color)
+        for_each_colored_particle_pair(
+            offsetofcoloredparticlepairs_[color_type_index(color, 0, 0)],
+            offsetofcoloredparticlepairs_[color_type_index(color + 1, 0, 0)], numthreads, function);
+    }
+
+    /*!
+     * \brief call a function for particle pairs of an equal combination of particle types
+     *
+     * Same as above for the particle pairs in the order of
+     * get_relevant_particle_pair_indices_for_equal_combination().
+     *
+     * \param[in] types_a  particle types of both particles of a pair
+     * \param[in] function function called with each particle pair
+     */
+    template <typename Function>
+    void for_each_particle_pair_for_equal_combination(
+        const std::set<PARTICLEENGINE::TypeEnum>& types_a, Function&& function) const
+    {
+      const int numthreads = Core::Utils::max_threads();
+
+      if (numthreads == 1)
+      {
+        for (const auto& type_i : types_a)
+          for (const auto& type_j : types_a)
+            for (const int particlepairindex : indexofparticlepairs_[type_i][type_j])
+              function(particlepairdata_[particlepairindex]);
+        return;
+      }
+
+      for (int color = 0; color < numparticlepaircolors_; ++color)
+        for (const auto& type_i : types_a)
+          for (const auto& type_j : types_a)
+          {
+            const int index = color_type_index(color, type_i, type_j);
+            for_each_colored_particle_pair(offsetofcoloredparticlepairs_[index],
+                offsetofcoloredparticlepairs_[index + 1], numthreads, function);
+          }
+    }
+
    private:
     //! evaluate particle pairs
     void evaluate_particle_pairs();
 
+    //! evaluate kernel and first derivative of kernel of particle pairs
+    template <typename Kernel>
+    void evaluate_particle_pair_kernels(const Kernel& kernel);
+
+    //! color particle pairs such that no two pairs of one color share a particle
+    void color_particle_pairs();
+
+    //! index of a color and combination of particle types in the offset of colored pairs
+    inline int color_type_index(int color, int type_i, int type_j) const
+    {
+      const int typevectorsize = static_cast<int>(indexofparticlepairs_.size());
+      return (color * typevectorsize + type_i) * typevectorsize + type_j;
+    }
+
+    //! call a function for the colored particle pairs in [begin, end) in parallel
+    template <typename Function>
+    void for_each_colored_particle_pair(
+        int begin, int end, int numthreads, Function& function) const
+    {
+      if (begin == end) return;
+
+      Core::Utils::parallel_for(
+          end - begin, numthreads,
+          [&](int i) { function(particlepairdata_[coloredparticlepairs_[begin + i]]); }, 64);
+    }
+
     //! evaluate particle-wall pairs
     void evaluate_particle_wall_pairs();
 
@@ -113,9 +210,24 @@ namespace ParticleInteraction
     //! index of particle pairs for each type
     SPHIndexOfParticlePairs indexofparticlepairs_;
 
+    //! color of particle pairs (only with more than one thread)
+    std::vector<int> particlepaircolor_;
+
+    //! number of colors of particle pairs
+    int numparticlepaircolors_ = 0;
+
+    //! index of particle pairs sorted by color and combination of particle types
+    std::vector<int> coloredparticlepairs_;
+
+    //! offset of each color and combination of particle types in colored particle pairs
+    std::vector<int> offsetofcoloredparticlepairs_;
+
     //! index of particle-wall pairs for each type
     SPHIndexOfParticleWallPairs indexofparticlewallpairs_;
 
+    //! verlet list of candidate particle pairs
+    VerletList verletlist_;
+
     //! interface to particle engine
     std::shared_ptr<PARTICLEENGINE::ParticleEngineInterface> particleengineinterface_;
 
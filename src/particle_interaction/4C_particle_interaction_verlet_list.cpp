@@ -0,0 +1,189 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_particle_interaction_verlet_list.hpp"
+
+#include "4C_particle_engine_container.hpp"
+#include "4C_particle_engine_interface.hpp"
+#include "4C_particle_interaction_utils.hpp"
+
+#include <Teuchos_TimeMonitor.hpp>
+
+FOUR_C_NAMESPACE_OPEN
+
+/*---------------------------------------------------------------------------*
+ | definitions                                                               |
+ *---------------------------------------------------------------------------*/
+ParticleInteraction::VerletList::VerletList(double skin)
+    : skin_(skin), numpotentialneighborsbuilds_(-1)
+{
+  // empty constructor
+}
+
+void ParticleInteraction::VerletList::setup(
+    const std::shared_ptr<PARTICLEENGINE::ParticleEngineInterface> particleengineinterface)
+{
+  // set interface to particle engine
+  particleengineinterface_ = particleengineinterface;
+
+  // set particle container bundle
+  particlecontainerbundle_ = particleengineinterface_->get_particle_container_bundle();
+
+  // determine size of vectors indexed by particle types
+  const int typevectorsize = *(--particlecontainerbundle_->get_particle_types().end()) + 1;
+
+  // allocate memory to hold reference positions for each type and status
+  referencepositions_.resize(typevectorsize, std::vector<std::vector<double>>(2));
+}
+
+const PARTICLEENGINE::PotentialParticleNeighbors&
+ParticleInteraction::VerletList::get_candidate_particle_pairs(
+    const InteractionDistance& interactiondistance)
+{
+  // get reference to potential particle neighbors (includes validity check)
+  const PARTICLEENGINE::PotentialParticleNeighbors& potentialneighbors =
+      particleengineinterface_->get_potential_particle_neighbors();
+
+  // no verlet list without skin distance
+  if (not(skin_ > 0.0)) return potentialneighbors;
+
+  if (rebuild_needed()) build(interactiondistance);
+
+  return candidateparticlepairs_;
+}
+
+bool ParticleInteraction::VerletList::rebuild_needed() const
+{
+  // local indices changed with a rebuild of the potential particle neighbors
+  if (numpotentialneighborsbuilds_ !=
+      particleengineinterface_->get_num_potential_particle_neighbors_builds())
+    return true;
+
+  // allowed position increment, such that no pair can approach by more than the skin distance
+  const double allowedpositionincrement = 0.5 * skin_;
+
+  // position increment of particle
+  double positionincrement[3];
+
+  // iterate over particle types
+  for (const auto& type : particlecontainerbundle_->get_particle_types())
+  {
+    // iterate over particle statuses
+    for (const auto& status : {PARTICLEENGINE::Owned, PARTICLEENGINE::Ghosted})
+    {
+      // get container of particles of current particle type and status
+      PARTICLEENGINE::ParticleContainer* container =
+          particlecontainerbundle_->get_specific_container(type, status);
+
+      // get number of particles stored in container
+      const int particlestored = container->particles_stored();
+
+      // get reference positions of particles
+      const std::vector<double>& refpos = referencepositions_[type][status];
+
+      // get particle state dimension
+      const int statedim = container->get_state_dim(PARTICLEENGINE::Position);
+
+      // number of particles changed
+      if (static_cast<int>(refpos.size()) != particlestored * statedim) return true;
+
+      // iterate over particles of current type and status
+      for (int i = 0; i < particlestored; ++i)
+      {
+        // get pointer to particle states
+        const double* pos = container->get_ptr_to_state(PARTICLEENGINE::Position, i);
+
+        // position increment of particle considering periodic boundaries
+        particleengineinterface_->distance_between_particles(
+            pos, &refpos[i * statedim], positionincrement);
+
+        if (Utils::vec_norm_two(positionincrement) > allowedpositionincrement) return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+void ParticleInteraction::VerletList::build(const InteractionDistance& interactiondistance)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("ParticleInteraction::VerletList::build");
+
+  // clear candidate particle pairs
+  candidateparticlepairs_.clear();
+
+  // iterate over potential particle neighbors
+  for (const auto& potentialneighbors :
+      particleengineinterface_->get_potential_particle_neighbors())
+  {
+    // access values of local index tuples of particle i and j
+    PARTICLEENGINE::TypeEnum type_i;
+    PARTICLEENGINE::StatusEnum status_i;
+    int particle_i;
+    std::tie(type_i, status_i, particle_i) = potentialneighbors.first;
+
+    PARTICLEENGINE::TypeEnum type_j;
+    PARTICLEENGINE::StatusEnum status_j;
+    int particle_j;
+    std::tie(type_j, status_j, particle_j) = potentialneighbors.second;
+
+    // get corresponding particle containers
+    PARTICLEENGINE::ParticleContainer* container_i =
+        particlecontainerbundle_->get_specific_container(type_i, status_i);
+
+    PARTICLEENGINE::ParticleContainer* container_j =
+        particlecontainerbundle_->get_specific_container(type_j, status_j);
+
+    // get pointer to particle states
+    const double* pos_i = container_i->get_ptr_to_state(PARTICLEENGINE::Position, particle_i);
+    const double* rad_i = container_i->get_ptr_to_state(PARTICLEENGINE::Radius, particle_i);
+
+    const double* pos_j = container_j->get_ptr_to_state(PARTICLEENGINE::Position, particle_j);
+    const double* rad_j = container_j->get_ptr_to_state(PARTICLEENGINE::Radius, particle_j);
+
+    // vector from particle i to j
+    double r_ji[3];
+
+    // distance between particles considering periodic boundaries
+    particleengineinterface_->distance_between_particles(pos_i, pos_j, r_ji);
+
+    // particles within interaction distance plus skin distance
+    if (Utils::vec_norm_two(r_ji) < interactiondistance(rad_i[0], rad_j[0]) + skin_)
+      candidateparticlepairs_.push_back(potentialneighbors);
+  }
+
+  // store reference positions of particles
+  for (const auto& type : particlecontainerbundle_->get_particle_types())
+  {
+    for (const auto& status : {PARTICLEENGINE::Owned, PARTICLEENGINE::Ghosted})
+    {
+      // get container of particles of current particle type and status
+      PARTICLEENGINE::ParticleContainer* container =
+          particlecontainerbundle_->get_specific_container(type, status);
+
+      // get number of particles stored in container
+      const int particlestored = container->particles_stored();
+
+      // get particle state dimension
+      const int statedim = container->get_state_dim(PARTICLEENGINE::Position);
+
+      std::vector<double>& refpos = referencepositions_[type][status];
+      refpos.resize(particlestored * statedim);
+
+      if (particlestored == 0) continue;
+
+      const double* pos = container->get_ptr_to_state(PARTICLEENGINE::Position, 0);
+      std::copy(pos, pos + particlestored * statedim, refpos.begin());
+    }
+  }
+
+  // store number of builds of potential particle neighbors
+  numpotentialneighborsbuilds_ =
+      particleengineinterface_->get_num_potential_particle_neighbors_builds();
+}
+
+FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,96 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_PARTICLE_INTERACTION_VERLET_LIST_HPP
+#define FOUR_C_PARTICLE_INTERACTION_VERLET_LIST_HPP
+
+/*---------------------------------------------------------------------------*
+ | headers                                                                   |
+ *---------------------------------------------------------------------------*/
+#include "4C_config.hpp"
+
+#include "4C_particle_engine_enums.hpp"
+#include "4C_particle_engine_typedefs.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+/*---------------------------------------------------------------------------*
+ | forward declarations                                                      |
+ *---------------------------------------------------------------------------*/
+namespace PARTICLEENGINE
+{
+  class ParticleEngineInterface;
+  class ParticleContainerBundle;
+}  // namespace PARTICLEENGINE
+
+/*---------------------------------------------------------------------------*
+ | class declarations                                                        |
+ *---------------------------------------------------------------------------*/
+namespace ParticleInteraction
+{
+  /*!
+   * \brief Verlet list of candidate particle pairs
+   *
+   * The candidate particle pairs are the potential particle neighbors with a distance smaller than
+   * their interaction distance plus a skin distance. The candidates are kept as long as the
+   * potential particle neighbors are not rebuilt and no particle moved more than half of the skin
+   * distance since the last build, such that no pair within interaction distance can be missed.
+   * Without a positive skin distance the potential particle neighbors are returned directly.
+   */
+  class VerletList final
+  {
+   public:
+    //! function returning the interaction distance of a pair given the radii of both particles
+    using InteractionDistance = std::function<double(double rad_i, double rad_j)>;
+
+    //! constructor
+    explicit VerletList(double skin);
+
+    //! setup verlet list
+    void setup(
+        const std::shared_ptr<PARTICLEENGINE::ParticleEngineInterface> particleengineinterface);
+
+    //! get candidate particle pairs, rebuilt if necessary
+    const PARTICLEENGINE::PotentialParticleNeighbors& get_candidate_particle_pairs(
+        const InteractionDistance& interactiondistance);
+
+   private:
+    //! check if the candidate particle pairs need to be rebuilt
+    bool rebuild_needed() const;
+
+    //! build candidate particle pairs and store reference positions
+    void build(const InteractionDistance& interactiondistance);
+
+    //! skin distance
+    const double skin_;
+
+    //! candidate particle pairs
+    PARTICLEENGINE::PotentialParticleNeighbors candidateparticlepairs_;
+
+    //! positions of (owned and ghosted) particles at last build indexed by type and status
+    std::vector<std::vector<std::vector<double>>> referencepositions_;
+
+    //! number of builds of potential particle neighbors at last build
+    int numpotentialneighborsbuilds_;
+
+    //! interface to particle engine
+    std::shared_ptr<PARTICLEENGINE::ParticleEngineInterface> particleengineinterface_;
+
+    //! particle container bundle
+    PARTICLEENGINE::ParticleContainerBundleShrdPtr particlecontainerbundle_;
+  };
+
+}  // namespace ParticleInteraction
+
+/*---------------------------------------------------------------------------*/
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -21,6 +21,7 @@
 
 #include <Epetra_MpiComm.h>
 
+#include <algorithm>
 #include <stack>
 
 FOUR_C_NAMESPACE_OPEN
@@ -34,11 +35,18 @@ FOUR_C_NAMESPACE_OPEN
  * the Constructor of PostProblem
  *----------------------------------------------------------------------*/
 PostProblem::PostProblem(Teuchos::CommandLineProcessor& CLP, int argc, char** argv)
-    : start_(0), end_(-1), step_(1), mortar_(false)
+    : start_(0), end_(-1), step_(1), mortar_(false), finalize_mpi_(false)
 {
   using namespace FourC;
 
-  MPI_Init(&argc, &argv);
+  // MPI is only set up here if the filter is not run within an environment that already did so
+  int mpi_initialized = 0;
+  MPI_Initialized(&mpi_initialized);
+  if (not mpi_initialized)
+  {
+    MPI_Init(&argc, &argv);
+    finalize_mpi_ = true;
+  }
 
   global_legacy_module_callbacks().RegisterParObjectTypes();
 
@@ -177,7 +185,7 @@ PostProblem::PostProblem(Teuchos::CommandLineProcessor& CLP, int argc, char** ar
 PostProblem::~PostProblem()
 {
   destroy_map(&control_table_);
-  MPI_Finalize();
+  if (finalize_mpi_) MPI_Finalize();
 }
 
 
@@ -678,8 +686,85 @@ int PostProblem::get_max_nodeid(const std::string& fieldname)
  *----------------------------------------------------------------------*/
 PostField::PostField(std::shared_ptr<Core::FE::Discretization> dis, PostProblem* problem,
     std::string field_name, const int numnd, const int numele)
-    : dis_(dis), problem_(problem), field_name_(field_name), numnd_(numnd), numele_(numele)
+    : dis_(dis),
+      problem_(problem),
+      field_name_(field_name),
+      numnd_(numnd),
+      numele_(numele),
+      result_index_built_(false)
+{
+}
+
+
+/*----------------------------------------------------------------------*
+ * walks the control file once and records the positions of all result
+ * blocks of this field in the slice together with the position of the
+ * block that defines their result files
+ *----------------------------------------------------------------------*/
+void PostField::build_result_index()
+{
+  result_positions_.clear();
+  result_file_positions_.clear();
+  result_positions_by_group_.clear();
+
+  int filepos = -1;
+  for (int i = 0; i < problem_->num_results(); ++i)
+  {
+    MAP* map = (*problem_->result_groups())[problem_->num_results() - 1 - i];
+    if (field_name_ != map_read_string(map, "field")) continue;
+
+    // same rules as in PostResult::next_result()
+    if (map_symbol_count(map, "result_file") > 0) filepos = i;
+
+    const int step = map_read_int(map, "step");
+    if ((step >= problem_->start()) && ((step <= problem_->end()) || (problem_->end() == -1)) &&
+        ((step - problem_->start()) % problem_->step() == 0))
+    {
+      result_positions_.push_back(i);
+      result_file_positions_.push_back(filepos);
+    }
+  }
+
+  result_index_built_ = true;
+}
+
+
+/*----------------------------------------------------------------------*
+ * returns the control file positions of all result blocks of this field
+ * in the slice that contain the result vector >groupname<
+ *----------------------------------------------------------------------*/
+const std::vector<int>& PostField::result_positions(const std::string& groupname)
+{
+  if (not result_index_built_) build_result_index();
+  if (groupname.empty()) return result_positions_;
+
+  auto cached = result_positions_by_group_.find(groupname);
+  if (cached != result_positions_by_group_.end()) return cached->second;
+
+  std::vector<int>& positions = result_positions_by_group_[groupname];
+  for (const int pos : result_positions_)
+  {
+    MAP* map = (*problem_->result_groups())[problem_->num_results() - 1 - pos];
+    if (map_has_map(map, groupname.c_str())) positions.push_back(pos);
+  }
+  return positions;
+}
+
+
+/*----------------------------------------------------------------------*
+ * returns the position of the block defining the result files that are
+ * valid for the result block at position pos
+ *----------------------------------------------------------------------*/
+int PostField::result_file_position(const int pos)
 {
+  if (not result_index_built_) build_result_index();
+
+  auto it = std::lower_bound(result_positions_.begin(), result_positions_.end(), pos);
+  if (it == result_positions_.end() or *it != pos)
+    FOUR_C_THROW("Result block %d is not a result of field '%s' in the slice", pos,
+        field_name_.c_str());
+
+  return result_file_positions_[it - result_positions_.begin()];
 }
 
 
@@ -688,7 +773,11 @@ PostField::PostField(std::shared_ptr<Core::FE::Discretization> dis, PostProblem*
  * The Constructor of PostResult
  *----------------------------------------------------------------------*/
 PostResult::PostResult(PostField* field)
-    : field_(field), pos_(-1), group_(nullptr), file_((field->problem()->input_dir()))
+    : field_(field),
+      pos_(-1),
+      group_(nullptr),
+      filepos_(-1),
+      file_((field->problem()->input_dir()))
 {
 }
 
@@ -793,6 +882,7 @@ int PostResult::next_result()
       {
         close_result_files();
         open_result_files(map);
+        filepos_ = i;
       }
 
       /*
@@ -834,6 +924,35 @@ int PostResult::next_result(const std::string& groupname)
 }
 
 
+/*----------------------------------------------------------------------*
+ * goes directly to the index-th result block in the slice that contains
+ * written result values specified by a given groupname. Returns 1 when
+ * the result block exists, otherwise returns 0
+ *----------------------------------------------------------------------*/
+int PostResult::goto_result(const int index, const std::string& groupname)
+{
+  const std::vector<int>& positions = field_->result_positions(groupname);
+  if (index < 0 or index >= static_cast<int>(positions.size())) return 0;
+
+  PostProblem* problem = field_->problem();
+  const int pos = positions[index];
+
+  // only reopen the result files if the block lives in different ones
+  const int filepos = field_->result_file_position(pos);
+  if (filepos != filepos_)
+  {
+    close_result_files();
+    if (filepos >= 0)
+      open_result_files((*problem->result_groups())[problem->num_results() - 1 - filepos]);
+    filepos_ = filepos;
+  }
+
+  pos_ = pos;
+  group_ = (*problem->result_groups())[problem->num_results() - 1 - pos];
+  return 1;
+}
+
+
 /*----------------------------------------------------------------------*/
 /*!
   \brief Tell whether a given result group belongs to this result.
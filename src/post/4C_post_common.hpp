@@ -22,6 +22,7 @@
 #include <Epetra_Map.h>
 #include <Teuchos_CommandLineProcessor.hpp>
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -57,7 +58,7 @@ class PostProblem
    */
   PostProblem(Teuchos::CommandLineProcessor& CLP, int argc, char** argv);
 
-  //! destructor
+  //! destructor (finalizes MPI if it has been initialized by the constructor)
   ~PostProblem();
 
   //@}
@@ -257,6 +258,9 @@ class PostProblem
 
   std::string input_dir_;
   std::shared_ptr<Epetra_Comm> comm_;
+
+  //! flag whether MPI has been initialized by this instance and has to be finalized again
+  bool finalize_mpi_;
 };
 
 
@@ -328,7 +332,35 @@ class PostField
 
   //@}
 
+  //@{ \name Result index
+
+  /*! \brief Get the control file positions of all result blocks of this field in the slice
+   *
+   *  The index is built with a single pass over the control file on first use and cached for each
+   *  group name, so that any result block can be reached without walking the control file again.
+   *
+   *  \param groupname [in] Name of result vector the blocks have to contain. An empty name
+   *                        selects all result blocks of this field.
+   *
+   *  \returns positions (in the order of next_result()) of the matching result blocks
+   */
+  const std::vector<int>& result_positions(const std::string& groupname);
+
+  /*! \brief Get the control file position of the result files valid for a result block
+   *
+   *  \param pos [in] control file position of a result block of this field in the slice
+   *
+   *  \returns position of the last result block of this field at or before pos that names new
+   *           result files, or -1 if there is none
+   */
+  int result_file_position(const int pos);
+
+  //@}
+
  private:
+  //! walk the control file once and record the result blocks of this field
+  void build_result_index();
+
   //! discretization of underlying field
   std::shared_ptr<Core::FE::Discretization> dis_;
 
@@ -346,6 +378,18 @@ class PostField
 
   //! Number of Elements
   int numele_;
+
+  //! flag whether the result index has been built
+  bool result_index_built_;
+
+  //! control file positions of all result blocks of this field in the slice
+  std::vector<int> result_positions_;
+
+  //! for each entry of result_positions_ the position of the block defining its result files
+  std::vector<int> result_file_positions_;
+
+  //! cached subsets of result_positions_ that contain a certain result vector
+  std::map<std::string, std::vector<int>> result_positions_by_group_;
 };
 
 
@@ -414,6 +458,19 @@ class PostResult
    */
   int next_result(const std::string& name);
 
+  /*! \brief Goes directly to the index-th result block in the slice containing the result
+   *  vector >name<
+   *
+   *  Uses the result index of the field, so the cost does not depend on index. Result files are
+   *  only reopened if the target block belongs to different files than the current one.
+   *
+   *  \param index [in] zero-based index among the result blocks that contain >name<
+   *  \param name [in] Name of result to be queried
+   *
+   *  \returns 1 if the result block exists, otherwise returns 0 and leaves the result unchanged
+   */
+  int goto_result(const int index, const std::string& name);
+
   /*! \brief Reads the data of the result vector 'name' from the current result block
    *
    *  \param name [in] result vector name inside the control file
@@ -477,6 +534,8 @@ class PostResult
   PostField* field_;
   int pos_;
   MAP* group_;
+  //! control file position of the block whose result files are currently open (-1 if none)
+  int filepos_;
   Core::IO::HDFReader file_;
 };
 
@@ -153,34 +153,12 @@ void PostVtkWriter::write_special_field(SpecialFieldInterface &special,
   for (unsigned int i = 0; i < fieldnames.size(); ++i)
     files[i] = Core::Utils::shared_ptr_from_ref(currentout_);
 
-  bool foundit = false;
-  PostResult activeresult(result.field());
-  while (activeresult.next_result(groupname))
-  {
-    if (map_has_map(activeresult.group(), groupname.c_str()))
-    {
-      foundit = true;
-      break;
-    }
-  }
-  // should always find the correct result
-  if (!foundit)
-    FOUR_C_THROW("Internal error when trying to identify output type %s", groupname.c_str());
-
   // jump to the correct location in the data vector. Some fields might only
   // be stored once, so need to catch that case as well
-  bool once = false;
-  for (int i = 0; i < timestep_; ++i)
-    if (not activeresult.next_result(groupname))
-    {
-      once = true;
-      break;
-    }
-  if (once)
-  {
-    activeresult = PostResult(field_);
-    activeresult.next_result(groupname);
-  }
+  PostResult activeresult(result.field());
+  if (not activeresult.goto_result(timestep_, groupname) and
+      not activeresult.goto_result(0, groupname))
+    FOUR_C_THROW("Internal error when trying to identify output type %s", groupname.c_str());
 
   std::map<std::string, std::vector<std::ofstream::pos_type>> resultfilepos;
   special(files, activeresult, resultfilepos, groupname, fieldnames);
@@ -245,20 +223,7 @@ void PostVtkWriter::write_result(const std::string groupname, const std::string
 
   // jump to the correct location in the data vector. Some fields might only
   // be stored once, so need to catch that case as well
-  bool once = false;
-  for (int i = 0; i < timestep_; ++i)
-    if (not result->next_result(groupname))
-    {
-      once = true;
-      break;
-    }
-
-  if (once)
-  {
-    // recreate PostResult, go one step and throw away the old one
-    result = std::make_shared<PostResult>(field_);
-    result->next_result(groupname);
-  }
+  if (not result->goto_result(timestep_, groupname)) result->goto_result(0, groupname);
   if (not(field_->problem()->spatial_approximation_type() ==
               Core::FE::ShapeFunctionType::polynomial or
           field_->problem()->spatial_approximation_type() == Core::FE::ShapeFunctionType::hdg or
@@ -136,19 +136,60 @@ void Discret::Elements::ScaTraEleCalcCardiacMonodomain<distype, probdim>::mat_my
   }
   else
   {
-    // get membrane potential at n+1 or n+alpha_F at integration point
-    const double phinp = my::scatravarmanager_->phinp(k);
-    // get reaction coefficient
-    advreamanager->add_to_rea_body_force(
-        -actmat->rea_coeff(phinp, my::scatraparatimint_->dt(), iquad), k);
-    advreamanager->add_to_rea_body_force_deriv_matrix(
-        -actmat->rea_coeff_deriv(phinp, my::scatraparatimint_->dt(), iquad), k, k);
+    if (iquad >= 0 and iquad < static_cast<int>(reacoeffs_.size()))
+    {
+      // get reaction coefficient evaluated for all integration points of the element
+      advreamanager->add_to_rea_body_force(-reacoeffs_[iquad], k);
+      advreamanager->add_to_rea_body_force_deriv_matrix(-reacoeffderivs_[iquad], k, k);
+    }
+    else
+    {
+      // get membrane potential at n+1 or n+alpha_F at integration point
+      const double phinp = my::scatravarmanager_->phinp(k);
+      // get reaction coefficient
+      advreamanager->add_to_rea_body_force(
+          -actmat->rea_coeff(phinp, my::scatraparatimint_->dt(), iquad), k);
+      advreamanager->add_to_rea_body_force_deriv_matrix(
+          -actmat->rea_coeff_deriv(phinp, my::scatraparatimint_->dt(), iquad), k, k);
+    }
   }
 
   return;
 }  // ScaTraEleCalcCardiacMonodomain<distype>::MatMyocard
 
 
+/*----------------------------------------------------------------------*
+ |  reaction coefficients at all integration points         (protected) |
+ *----------------------------------------------------------------------*/
+template <Core::FE::CellType distype, int probdim>
+void Discret::Elements::ScaTraEleCalcCardiacMonodomain<distype,
+    probdim>::evaluate_rea_coeffs_at_int_points(Core::Elements::Element* ele,
+    const Core::FE::IntPointsAndWeights<nsd_ele_>& intpoints)
+{
+  reacoeffs_.clear();
+  reacoeffderivs_.clear();
+
+  // only a single myocard material with implicit reaction term is evaluated at once
+  if (my::scatrapara_->semi_implicit() or my::numscal_ != 1 or
+      ele->material()->material_type() != Core::Materials::m_myocard)
+    return;
+
+  std::shared_ptr<Mat::Myocard> actmat = std::dynamic_pointer_cast<Mat::Myocard>(ele->material());
+  if (actmat->get_number_of_gp() < intpoints.ip().nquad) return;
+
+  // membrane potential at n+1 or n+alpha_F at all integration points
+  std::vector<double> phinp(intpoints.ip().nquad);
+  for (int iquad = 0; iquad < intpoints.ip().nquad; ++iquad)
+  {
+    my::eval_shape_func_and_derivs_at_int_point(intpoints, iquad);
+    phinp[iquad] = my::funct_.dot(my::ephinp_[0]);
+  }
+
+  actmat->rea_coeff_and_deriv_all_gp(
+      phinp, my::scatraparatimint_->dt(), reacoeffs_, reacoeffderivs_);
+}
+
+
 /*----------------------------------------------------------------------*
 |  calculate system matrix and rhs for ep                 hoermann 06/16|
 *----------------------------------------------------------------------*/
@@ -189,6 +230,9 @@ void Discret::Elements::ScaTraEleCalcCardiacMonodomain<distype, probdim>::sysmat
     const Core::FE::IntPointsAndWeights<nsd_ele_> intpoints(
         ScaTra::DisTypeToMatGaussRule<distype>::get_gauss_rule(deg));
 
+    // evaluate the ionic model at all integration points of the element at once
+    evaluate_rea_coeffs_at_int_points(ele, intpoints);
+
     // loop over integration points
     for (int iquad = 0; iquad < intpoints.ip().nquad; ++iquad)
     {
@@ -219,6 +263,10 @@ void Discret::Elements::ScaTraEleCalcCardiacMonodomain<distype, probdim>::sysmat
         advreac::calc_mat_react(emat, k, timefacfac, 0., 0., densnp[k], dummy, dummy);
       }
     }
+
+    // precomputed reaction coefficients are only valid for the current element
+    reacoeffs_.clear();
+    reacoeffderivs_.clear();
   }
 
   //----------------------------------------------------------------------
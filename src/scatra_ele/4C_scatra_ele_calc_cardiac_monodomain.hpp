@@ -85,12 +85,25 @@ namespace Discret
           const int iquad = -1        //!< id of current gauss point (default = -1)
       );
 
+      //! evaluate reaction coefficients and derivatives at all material integration points
+      void evaluate_rea_coeffs_at_int_points(
+          Core::Elements::Element* ele,                              ///< the current element
+          const Core::FE::IntPointsAndWeights<nsd_ele_>& intpoints  ///< material integration points
+      );
+
       //! calculate matrix and rhs for ep
       void sysmat(Core::Elements::Element* ele,       ///< the element whose matrix is calculated
           Core::LinAlg::SerialDenseMatrix& emat,      ///< element matrix to calculate
           Core::LinAlg::SerialDenseVector& erhs,      ///< element rhs to calculate
           Core::LinAlg::SerialDenseVector& subgrdiff  ///< subgrid-diff.-scaling vector
           ) override;
+
+     private:
+      //! reaction coefficients precomputed at the material integration points of the element
+      std::vector<double> reacoeffs_;
+
+      //! derivatives of the precomputed reaction coefficients
+      std::vector<double> reacoeffderivs_;
     };
 
   }  // namespace Elements
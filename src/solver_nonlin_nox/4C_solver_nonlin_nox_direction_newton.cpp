@@ -7,7 +7,9 @@
 
 #include "4C_solver_nonlin_nox_direction_newton.hpp"
 
+#include "4C_solver_nonlin_nox_constraint_group.hpp"
 #include "4C_solver_nonlin_nox_group.hpp"
+#include "4C_solver_nonlin_nox_solver_ptc.hpp"
 
 #include <NOX_GlobalData.H>
 #include <NOX_Utils.H>
@@ -21,7 +23,10 @@ NOX::Nln::Direction::Newton::Newton(
     const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& p)
     : ::NOX::Direction::Newton(gd, p), utils_(gd->getUtils())
 {
-  // empty constructor
+  Teuchos::ParameterList& p_reuse = p.sublist("Newton").sublist("Jacobian Reuse");
+  reuse_jacobian_ = p_reuse.get<bool>("Reuse Jacobian", false);
+  max_contraction_rate_ = p_reuse.get<double>("Max Contraction Rate", 0.5);
+  max_num_reuses_ = p_reuse.get<int>("Max Number of Reuses", 10);
 }
 
 /*----------------------------------------------------------------------------*
@@ -39,11 +44,23 @@ bool NOX::Nln::Direction::Newton::compute(::NOX::Abstract::Vector& dir,
     throw_error("compute", "dynamic_cast to nox_nln_group failed!");
   }
 
-  // Compute F and Jacobian at current solution at once.
-  status = nlnSoln->compute_f_and_jacobian();
+  // Compute F and Jacobian at current solution at once. The first iteration
+  // of each nonlinear solve always starts with a fresh jacobian.
+  if (reuse_jacobian_ and solver.getNumIterations() > 0)
+    status = compute_f_and_reused_jacobian(*nlnSoln, solver);
+  else
+  {
+    status = nlnSoln->compute_f_and_jacobian();
+    num_reuses_ = 0;
+  }
   if (status != ::NOX::Abstract::Group::Ok)
     throw_error("compute", "Unable to compute F and/or Jacobian at once");
 
+  // keep a copy of a freshly assembled jacobian for the following iterations
+  if (reuse_jacobian_ and num_reuses_ == 0) nlnSoln->store_jacobian();
+
+  normf_old_ = nlnSoln->getNormF();
+
   // ------------------------------------------------
   // call base class version
   // ------------------------------------------------
@@ -65,6 +82,40 @@ bool NOX::Nln::Direction::Newton::compute(::NOX::Abstract::Vector& dir,
   return false;
 }
 
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+::NOX::Abstract::Group::ReturnType NOX::Nln::Direction::Newton::compute_f_and_reused_jacobian(
+    NOX::Nln::Group& group, const ::NOX::Solver::Generic& solver)
+{
+  // the jacobian is modified in-place during the linear solve of these problems
+  if (dynamic_cast<NOX::Nln::CONSTRAINT::Group*>(&group) or
+      dynamic_cast<const NOX::Nln::Solver::PseudoTransient*>(&solver))
+    throw_error("compute_f_and_reused_jacobian",
+        "The jacobian reuse is not supported for constrained problems and "
+        "the pseudo transient continuation!");
+
+  ::NOX::Abstract::Group::ReturnType status = group.computeF();
+  if (status != ::NOX::Abstract::Group::Ok) return status;
+
+  const double contraction_rate = group.getNormF() / normf_old_;
+  if (num_reuses_ < max_num_reuses_ and contraction_rate <= max_contraction_rate_)
+  {
+    group.reuse_jacobian();
+    ++num_reuses_;
+  }
+  else
+  {
+    status = group.computeJacobian();
+    num_reuses_ = 0;
+  }
+
+  if (utils_->isPrintType(::NOX::Utils::Details))
+    utils_->out() << "NOX::Nln::Direction::Newton -- contraction rate = " << contraction_rate
+                  << (num_reuses_ > 0 ? ", jacobian reused\n" : ", jacobian recomputed\n");
+
+  return status;
+}
+
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 void NOX::Nln::Direction::Newton::throw_error(
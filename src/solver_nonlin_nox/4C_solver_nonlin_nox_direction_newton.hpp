@@ -32,12 +32,35 @@ namespace NOX
             const ::NOX::Solver::Generic& solver) override;
 
        private:
+        /*! \brief Compute F and keep the last jacobian as long as the iteration contracts
+         *
+         *  The jacobian is only reassembled if the ratio of the current and the previous
+         *  residual norm exceeds the maximal contraction rate or if the jacobian has already
+         *  been reused the maximal number of times (modified Newton with automatic refresh). */
+        ::NOX::Abstract::Group::ReturnType compute_f_and_reused_jacobian(
+            NOX::Nln::Group& group, const ::NOX::Solver::Generic& solver);
+
         // throw NOX error
         void throw_error(const std::string& functionName, const std::string& errorMsg);
 
        private:
         //! NOX_Utils pointer
         Teuchos::RCP<::NOX::Utils> utils_;
+
+        //! reuse the jacobian of previous iterations
+        bool reuse_jacobian_;
+
+        //! maximal ratio of two consecutive residual norms to reuse the jacobian
+        double max_contraction_rate_;
+
+        //! maximal number of consecutive iterations with the same jacobian
+        int max_num_reuses_;
+
+        //! number of consecutive iterations with the current jacobian
+        int num_reuses_ = 0;
+
+        //! residual norm of the previous iteration
+        double normf_old_ = 0.0;
       };
     }  // namespace Direction
   }    // namespace Nln
@@ -46,6 +46,7 @@ NOX::Nln::Group::Group(const NOX::Nln::Group& source, ::NOX::CopyType type)
       skipUpdateX_ = source.skipUpdateX_;
       corr_type_ = source.corr_type_;
       ev_ = source.ev_;
+      is_jacobian_reused_ = source.is_jacobian_reused_;
       break;
     }
     default:
@@ -78,6 +79,7 @@ Teuchos::RCP<::NOX::Abstract::Group> NOX::Nln::Group::clone(::NOX::CopyType type
   this->skipUpdateX_ = nln_src.skipUpdateX_;
   this->corr_type_ = nln_src.corr_type_;
   this->ev_ = nln_src.ev_;
+  this->is_jacobian_reused_ = nln_src.is_jacobian_reused_;
 
   return *this;
 }
@@ -88,6 +90,7 @@ void NOX::Nln::Group::resetIsValid()
 {
   ::NOX::Epetra::Group::resetIsValid();
   ev_.isvalid_ = false;
+  is_jacobian_reused_ = false;
   corr_type_ = NOX::Nln::CorrectionType::vague;
 }
 
@@ -209,6 +212,7 @@ void NOX::Nln::Group::set_skip_update_x(bool skipUpdateX) { skipUpdateX_ = skipU
 
     isValidRHS = true;
     isValidJacobian = true;
+    is_jacobian_reused_ = false;
 
     ret = ::NOX::Abstract::Group::Ok;
     {
@@ -229,6 +233,35 @@ void NOX::Nln::Group::set_skip_update_x(bool skipUpdateX) { skipUpdateX_ = skipU
   return ret;
 }
 
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void NOX::Nln::Group::store_jacobian()
+{
+  Teuchos::RCP<NOX::Nln::LinearSystem> nlnSharedLinearSystem =
+      Teuchos::rcp_dynamic_cast<NOX::Nln::LinearSystem>(sharedLinearSystem.getObject(this));
+
+  if (nlnSharedLinearSystem.is_null())
+    throw_error("store_jacobian", "Dynamic cast of the shared linear system failed!");
+
+  nlnSharedLinearSystem->store_jacobian();
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void NOX::Nln::Group::reuse_jacobian()
+{
+  Teuchos::RCP<NOX::Nln::LinearSystem> nlnSharedLinearSystem =
+      Teuchos::rcp_dynamic_cast<NOX::Nln::LinearSystem>(sharedLinearSystem.getObject(this));
+
+  if (nlnSharedLinearSystem.is_null())
+    throw_error("reuse_jacobian", "Dynamic cast of the shared linear system failed!");
+
+  nlnSharedLinearSystem->restore_jacobian();
+
+  isValidJacobian = true;
+  is_jacobian_reused_ = true;
+}
+
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 ::NOX::Abstract::Group::ReturnType NOX::Nln::Group::compute_element_volumes(
@@ -269,8 +302,12 @@ void NOX::Nln::Group::set_skip_update_x(bool skipUpdateX) { skipUpdateX_ = skipU
 {
   prePostOperatorPtr_->run_pre_apply_jacobian_inverse(input, result, xVector, *this);
 
+  // the factorization of a reused jacobian is still valid
+  p.set<bool>("Reuse Factorization", is_jacobian_reused_);
+
   ::NOX::Abstract::Group::ReturnType status =
       ::NOX::Epetra::Group::applyJacobianInverse(p, input, result);
+  p.set<bool>("Reuse Factorization", false);
 
   prePostOperatorPtr_->run_post_apply_jacobian_inverse(input, result, xVector, *this);
 
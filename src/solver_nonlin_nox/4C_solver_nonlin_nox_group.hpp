@@ -87,6 +87,19 @@ namespace NOX
       //! contact problems.
       virtual ::NOX::Abstract::Group::ReturnType compute_f_and_jacobian();
 
+      //! Keep a copy of the current jacobian for later reuse_jacobian() calls.
+      void store_jacobian();
+
+      /*! \brief Declare the jacobian of the last store_jacobian() call valid for the current
+       *  solution
+       *
+       *  The stored copy is written back into the jacobian of the shared linear system, since
+       *  computeF() may reset the latter. Reusing it for the current solution results in a
+       *  modified Newton direction. The caller is responsible for the jacobian still
+       *  being a meaningful approximation. The linear solver is allowed to reuse its
+       *  factorization in the following applyJacobianInverse() call. */
+      void reuse_jacobian();
+
       //! ToDo Move this into an extra interface
       //! @{
 
@@ -249,6 +262,9 @@ namespace NOX
 
       /// instance of the Eigenvalue container
       Eigenvalues ev_;
+
+      /// Is the current jacobian the reused one of a previous iteration?
+      bool is_jacobian_reused_ = false;
     };  // class Group
   }     // namespace Nln
 }  // namespace NOX
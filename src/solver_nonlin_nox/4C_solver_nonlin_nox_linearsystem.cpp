@@ -327,7 +327,7 @@ bool NOX::Nln::LinearSystem::applyJacobianInverse(Teuchos::ParameterList& linear
     if (iter == -10)
       throw_error("applyJacobianInverse", "\"Number of Nonlinear Iterations\" was not specified");
 
-    solver_params.refactor = true;
+    solver_params.refactor = not linearSolverParams.get<bool>("Reuse Factorization", false);
     solver_params.reset = iter == 0;
 
     auto matrix = Core::Utils::shared_ptr_from_ref(*linProblem.GetOperator());
@@ -662,6 +662,43 @@ bool NOX::Nln::LinearSystem::destroy_jacobian()
   return true;
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void NOX::Nln::LinearSystem::store_jacobian()
+{
+  switch (jacType_)
+  {
+    case LinSystem::LinalgBlockSparseMatrix:
+    {
+      typedef Core::LinAlg::BlockSparseMatrix<Core::LinAlg::DefaultBlockMatrixStrategy> linalg_bsm;
+      stored_jac_ptr_ =
+          Teuchos::rcp(dynamic_cast<linalg_bsm&>(jacobian()).clone(Core::LinAlg::Copy).release());
+      break;
+    }
+    case LinSystem::LinalgSparseMatrix:
+    {
+      stored_jac_ptr_ = Teuchos::make_rcp<Core::LinAlg::SparseMatrix>(
+          dynamic_cast<const Core::LinAlg::SparseMatrix&>(jacobian()), Core::LinAlg::Copy);
+      break;
+    }
+    default:
+    {
+      FOUR_C_THROW("Unsupported LinSystem::OperatorType: %d | %s", jacType_,
+          NOX::Nln::LinSystem::operator_type_to_string(jacType_).c_str());
+    }
+  }
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void NOX::Nln::LinearSystem::restore_jacobian()
+{
+  if (stored_jac_ptr_.is_null()) throw_error("restore_jacobian", "There is no stored jacobian!");
+
+  jacobian().add(*stored_jac_ptr_, false, 1.0, 0.0);
+  jacobian().complete();
+}
+
 /*----------------------------------------------------------------------*
  *----------------------------------------------------------------------*/
 const Core::LinAlg::SparseMatrix& NOX::Nln::LinearSystem::get_jacobian_block(
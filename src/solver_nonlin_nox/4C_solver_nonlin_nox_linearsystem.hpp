@@ -219,6 +219,15 @@ namespace NOX
       //! destroy the jacobian ptr
       bool destroy_jacobian();
 
+      //! keep a deep copy of the current jacobian
+      void store_jacobian();
+
+      /*! \brief overwrite the jacobian with the copy of the last store_jacobian() call
+       *
+       *  The jacobian may be reset by the evaluation of the right hand side, since it
+       *  only views the matrices of the underlying model. */
+      void restore_jacobian();
+
       //! compute the eigenvalues of the jacobian operator in serial mode
       /**
        *  \pre Not supported in parallel. The Jacobian matrix should be not too
@@ -384,6 +393,9 @@ namespace NOX
        *  Use the provided accessors to access this member. Direct access is prohibited
        *  due to the pointer management by changing states (e.g. XFEM). */
       Teuchos::RCP<Core::LinAlg::SparseOperator> jac_ptr_;
+
+      //! copy of the jacobian of the last store_jacobian() call
+      Teuchos::RCP<Core::LinAlg::SparseOperator> stored_jac_ptr_;
     };
   }  // namespace Nln
 }  // namespace NOX
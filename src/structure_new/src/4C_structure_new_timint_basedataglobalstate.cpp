@@ -637,7 +637,11 @@ std::shared_ptr<::NOX::Epetra::Vector> Solid::TimeInt::BaseDataGlobalState::crea
 Core::LinAlg::SparseOperator*
 Solid::TimeInt::BaseDataGlobalState::create_structural_stiffness_matrix_block()
 {
-  stiff_ = std::make_shared<Core::LinAlg::SparseMatrix>(*dof_row_map_view(), 81, true, true);
+  auto stiff = std::make_shared<Core::LinAlg::SparseMatrix>(*dof_row_map_view(), 81, true, true);
+
+  // the structural stiffness is reassembled on the saved graph in every iteration
+  stiff->enable_assembly_plans();
+  stiff_ = stiff;
 
   return stiff_.get();
 }
@@ -9,8 +9,19 @@
 #include "4C_cut_levelsetintersection.hpp"
 #include "4C_cut_mesh.hpp"
 #include "4C_cut_options.hpp"
+#include "4C_cut_volumecell.hpp"
 
+#ifdef FOUR_C_WITH_OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <iterator>
+#include <map>
+#include <sstream>
+#include <utility>
 
 #include "cut_test_utils.hpp"
 
@@ -1646,6 +1657,109 @@ void test_ls_hex8_between()
   }
 }
 
+namespace
+{
+  /*!
+   * Cut a block of 3x3x2 hex8 elements with a spherical level set using DirectDivergence on
+   * @p num_threads threads. Return the volume and the first moments of the Gauss rules of all
+   * volumecells, summed up per element and position.
+   */
+  std::map<std::pair<int, int>, std::array<double, 4>> ls_hex8_block_direct_divergence(
+      int num_threads)
+  {
+#ifdef FOUR_C_WITH_OPENMP
+    const int max_threads = omp_get_max_threads();
+    omp_set_num_threads(num_threads);
+#endif
+
+    Cut::LevelSetIntersection lsi;
+    lsi.get_options().init_for_cuttests();
+
+    const int nx = 3, ny = 3, nz = 2;
+    auto node_id = [&](int i, int j, int k) { return i + (nx + 1) * (j + (ny + 1) * k); };
+
+    for (int ek = 0; ek < nz; ++ek)
+      for (int ej = 0; ej < ny; ++ej)
+        for (int ei = 0; ei < nx; ++ei)
+        {
+          std::vector<int> nids(8);
+          std::vector<double> lsvs(8);
+          Core::LinAlg::SerialDenseMatrix xyze(3, 8);
+
+          static const int xpos[] = {0, 1, 1, 0};
+          static const int ypos[] = {0, 0, 1, 1};
+          for (int n = 0; n < 8; ++n)
+          {
+            const int i = ei + xpos[n % 4], j = ej + ypos[n % 4], k = ek + n / 4;
+            nids[n] = node_id(i, j, k);
+            xyze(0, n) = i;
+            xyze(1, n) = j;
+            xyze(2, n) = k;
+            lsvs[n] = std::sqrt((i - 1.4) * (i - 1.4) + (j - 1.6) * (j - 1.6) +
+                                (k - 1.1) * (k - 1.1)) -
+                      1.1;
+          }
+
+          lsi.add_element(ei + nx * (ej + ny * ek), nids, xyze, Core::FE::CellType::hex8, &lsvs[0]);
+        }
+
+    lsi.cut(true, false, Cut::VCellGaussPts_DirectDivergence);
+
+#ifdef FOUR_C_WITH_OPENMP
+    omp_set_num_threads(max_threads);
+#endif
+
+    std::map<std::pair<int, int>, std::array<double, 4>> moments;
+    for (int eid = 0; eid < nx * ny * nz; ++eid)
+    {
+      Cut::Element* e = lsi.normal_mesh().get_element(eid);
+      for (Cut::VolumeCell* vc : e->volume_cells())
+      {
+        std::array<double, 4>& m = moments[{eid, vc->position()}];
+        m[0] += vc->volume();
+
+        std::shared_ptr<Core::FE::GaussPoints> gp = vc->get_gauss_rule();
+        if (not gp) continue;
+        for (int q = 0; q < gp->num_points(); ++q)
+          for (int d = 0; d < 3; ++d) m[d + 1] += gp->weight(q) * gp->point(q)[d];
+      }
+    }
+    return moments;
+  }
+}  // namespace
+
+void test_ls_hex8_direct_divergence_threads()
+{
+  // The facets are triangulated serially in both runs, only the Gauss rules of the volumecells
+  // are computed concurrently. Both runs have to predict the same volumecells.
+  const auto serial = ls_hex8_block_direct_divergence(1);
+  const auto parallel = ls_hex8_block_direct_divergence(4);
+
+  if (serial.size() != parallel.size())
+    FOUR_C_THROW("serial and parallel DirectDivergence give different volumecells");
+
+  bool is_cut = false;
+  for (const auto& [key, m] : serial)
+  {
+    if (key.second != Cut::Point::outside) is_cut = true;
+    if (parallel.count(key) == 0)
+      FOUR_C_THROW("volumecell of element %d missing in parallel DirectDivergence", key.first);
+
+    const std::array<double, 4>& m_parallel = parallel.at(key);
+    for (int i = 0; i < 4; ++i)
+    {
+      if (std::abs(m[i] - m_parallel[i]) > 1e-12 * std::max(1.0, std::abs(m[i])))
+      {
+        std::stringstream str;
+        str << "serial and parallel DirectDivergence differ in element " << key.first
+            << ": moment " << i << " is " << m[i] << " vs. " << m_parallel[i];
+        FOUR_C_THROW(str.str());
+      }
+    }
+  }
+  if (not is_cut) FOUR_C_THROW("the level set does not cut the block");
+}
+
 void test_ls_hex8_experiment()
 {
   Cut::LevelSetIntersection lsi;
@@ -219,6 +219,7 @@ void test_ls_hex8_simple6();
 void test_ls_hex8_simple7();
 void test_ls_hex8_touch();
 void test_ls_hex8_between();
+void test_ls_hex8_direct_divergence_threads();
 void test_ls_hex8_experiment();
 void test_ls_hex8_experiment_magnus();
 void test_ls_mesh_hex8_simple();  // Same cut with LS and mesh
@@ -713,6 +714,7 @@ int main(int argc, char** argv)
   functable["ls_hex8_simple7"] = test_ls_hex8_simple7;
   functable["ls_hex8_touch"] = test_ls_hex8_touch;
   functable["ls_hex8_between"] = test_ls_hex8_between;
+  functable["ls_hex8_direct_divergence_threads"] = test_ls_hex8_direct_divergence_threads;
   functable["ls_hex8_experiment"] = test_ls_hex8_experiment;
   functable["ls_hex8_experiment_magnus"] = test_ls_hex8_experiment_magnus;
   functable["ls_mesh_hex8_simple"] = test_ls_mesh_hex8_simple;
@@ -959,6 +959,7 @@ four_c_test(TEST_FILE particle_dem_2d_tangentialcontact_linspringdamp.dat NP 2 R
 four_c_test(TEST_FILE particle_dem_2d_tangentialcontact_linspringdamp_dense.dat NP 3 RESTART_STEP 500)
 four_c_test(TEST_FILE particle_dem_3d_diffwallmat.dat NP 2 RESTART_STEP 150)
 four_c_test(TEST_FILE particle_dem_3d_normalcontact_linspringdamp.dat NP 2 RESTART_STEP 2000)
+four_c_test(TEST_FILE particle_dem_3d_normalcontact_linspringdamp_verletskin.dat NP 2 RESTART_STEP 2000)
 four_c_test(TEST_FILE particle_dem_3d_normalcontact_linspringdamp_walldiscretcond.dat NP 2 RESTART_STEP 150)
 four_c_test(TEST_FILE particle_dem_3d_tangentialcontact_linspringdamp_walldiscretcond.dat NP 2 RESTART_STEP 150)
 four_c_test(TEST_FILE particle_nointer_3d_nopbc_walldiscretcond_nonmoving.dat NP 3 RESTART_STEP 300)
@@ -988,6 +989,7 @@ four_c_test(TEST_FILE particle_sph_1d_pressurewave_boundary_densityintegration_q
 four_c_test(TEST_FILE particle_sph_1d_pressurewave_boundary_densitysummation_cubicspline_adami.dat NP 2 RESTART_STEP 2000)
 four_c_test(TEST_FILE particle_sph_1d_pressurewave_boundary_densitysummation_cubicspline_monaghan.dat NP 2 RESTART_STEP 2000)
 four_c_test(TEST_FILE particle_sph_1d_pressurewave_boundary_densitysummation_quinticspline_adami.dat NP 2 RESTART_STEP 2000)
+four_c_test(TEST_FILE particle_sph_1d_pressurewave_boundary_densitysummation_quinticspline_adami_verletskin.dat NP 2 RESTART_STEP 2000)
 four_c_test(TEST_FILE particle_sph_1d_pressurewave_boundary_densitysummation_quinticspline_monaghan.dat NP 2 RESTART_STEP 2000)
 four_c_test(TEST_FILE particle_sph_1d_thermalconduction_boundary_temperatureintegration_quinticspline.dat NP 2 RESTART_STEP 2000)
 four_c_test(TEST_FILE particle_sph_1d_thermalconduction_boundary_temperatureintegration_quinticspline_differentthermal.dat NP 2 RESTART_STEP 2000)
@@ -1485,6 +1487,7 @@ four_c_test(TEST_FILE sosh18_nln_cooks.dat)
 four_c_test(TEST_FILE sosh18_thin_nonlinear_pinched_hemisphere_disp.dat NP 2)
 four_c_test(TEST_FILE sosh18_thin_nonlinear_pinched_hemisphere_dsg.dat NP 2)
 four_c_test(TEST_FILE sosh8_cooks_nl.dat NP 2)
+four_c_test(TEST_FILE sosh8_cooks_nl_parallel_read.dat NP 3)
 four_c_test(TEST_FILE sosh8_eas_cfrp_tape_monitor_dbc.dat NP 3)
 four_c_test(TEST_FILE sosh8_freeflying_ruler.dat NP 2)
 four_c_test(TEST_FILE sosh8_freeflying_ruler_centrdiff_new.dat)
@@ -1622,6 +1625,7 @@ four_c_test(TEST_FILE structure_new_dynamics_statics_restart_input.dat structure
 four_c_test(TEST_FILE structure_new_nln_solver_singlestep_cube_linear.dat structure_new_nln_solver_singlestep_cube_linear_restart.dat NP 1 1 RESTART_STEP 1)
 four_c_test(TEST_FILE structure_solid_beam_element_gid_runtime_output.dat NP 2)
 four_c_test(TEST_FILE strufem_hex8_cantilever_nox.dat NP 2)
+four_c_test(TEST_FILE strufem_hex8_cantilever_nox_jacobian_reuse.dat NP 2)
 four_c_test(TEST_FILE strufem_hex8_eas_cantilever.dat NP 2)
 four_c_test(TEST_FILE strufem_sosh8_eas_cantilever.dat NP 2)
 four_c_test(TEST_FILE strufem_tet10_disp_cantilever.dat NP 2)
@@ -2014,6 +2018,15 @@ if (FOUR_C_WITH_MIRCO)
     four_c_test(TEST_FILE roughcontact2d_mirco_varying_roughness.dat NP 2 OMP_THREADS 2)
 endif (FOUR_C_WITH_MIRCO)
 
+if (FOUR_C_WITH_OPENMP)
+    four_c_test(TEST_FILE ale3d_solid_nln_threads.dat OMP_THREADS 2)
+    four_c_test(TEST_FILE meshtying3D_patch_lin_duallagr_threads.dat OMP_THREADS 2)
+endif (FOUR_C_WITH_OPENMP)
+
+if (HDF5_IS_PARALLEL)
+    four_c_test(TEST_FILE particle_dem_2d_tangentialcontact_linspringdamp_dense_sharedfile.dat particle_dem_2d_tangentialcontact_linspringdamp_dense_sharedfile.dat NP 3 2 RESTART_STEP 500)
+endif (HDF5_IS_PARALLEL)
+
 # Special test cases which do not use the standard four_c_test functionality
 
 # four_c_test_cut_test
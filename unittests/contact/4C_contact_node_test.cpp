@@ -0,0 +1,115 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_contact_node.hpp"
+
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  using DerivativeMaps = std::vector<Core::Gen::Pairedvector<int, double>>;
+
+  //! insert @p num_entries entries into every component of @p deriv
+  void fill(DerivativeMaps& deriv, int num_entries)
+  {
+    for (auto& component : deriv)
+      for (int i = 0; i < num_entries; ++i) component[10 * i] = 0.5 * i;
+  }
+
+  //! address of the first entry of every component of @p deriv
+  std::vector<const void*> storage(const DerivativeMaps& deriv)
+  {
+    std::vector<const void*> addresses;
+    for (const auto& component : deriv) addresses.push_back(&*component.begin());
+    return addresses;
+  }
+
+  //! check that @p deriv has 3 empty components which can hold @p capacity entries
+  void expect_cleared(const DerivativeMaps& deriv, std::size_t capacity)
+  {
+    ASSERT_EQ(deriv.size(), 3u);
+    for (const auto& component : deriv)
+    {
+      EXPECT_TRUE(component.empty());
+      EXPECT_EQ(component.size(), 0u);
+      EXPECT_GE(component.capacity(), capacity);
+    }
+  }
+
+  TEST(ContactNodeDataContainerTest, DerivNormalIsEmptyAfterClear)
+  {
+    CONTACT::NodeDataContainer data;
+    EXPECT_TRUE(data.get_deriv_n().empty());
+
+    data.reserve_deriv_normal(8);
+    for (DerivativeMaps* deriv :
+        {&data.get_deriv_n(), &data.get_deriv_txi(), &data.get_deriv_teta()})
+    {
+      expect_cleared(*deriv, 8);
+      fill(*deriv, 8);
+      for (const auto& component : *deriv) EXPECT_EQ(component.size(), 8u);
+    }
+
+    data.clear_deriv_normal();
+    for (const DerivativeMaps* deriv :
+        {&data.get_deriv_n(), &data.get_deriv_txi(), &data.get_deriv_teta()})
+      expect_cleared(*deriv, 8);
+  }
+
+  TEST(ContactNodeDataContainerTest, DerivNormalIsRefilledWithoutReallocation)
+  {
+    CONTACT::NodeDataContainer data;
+    data.reserve_deriv_normal(8);
+    fill(data.get_deriv_n(), 8);
+    const std::vector<const void*> first = storage(data.get_deriv_n());
+
+    for (int iteration = 0; iteration < 3; ++iteration)
+    {
+      data.clear_deriv_normal();
+      // a smaller capacity request must not shrink the storage
+      data.reserve_deriv_normal(4);
+      fill(data.get_deriv_n(), 8);
+
+      EXPECT_EQ(storage(data.get_deriv_n()), first);
+      for (const auto& component : data.get_deriv_n())
+      {
+        EXPECT_EQ(component.size(), 8u);
+        EXPECT_EQ(component.at(70), 3.5);
+      }
+    }
+
+    // a larger capacity request grows the storage and keeps the components empty
+    data.clear_deriv_normal();
+    data.reserve_deriv_normal(32);
+    expect_cleared(data.get_deriv_n(), 32);
+  }
+
+  TEST(ContactNodeDataContainerTest, DerivTangentIsRefilledWithoutReallocation)
+  {
+    CONTACT::NodeDataContainer data;
+    EXPECT_TRUE(data.get_deriv_tangent().empty());
+
+    data.reserve_deriv_tangent(6);
+    expect_cleared(data.get_deriv_tangent(), 6);
+    fill(data.get_deriv_tangent(), 6);
+    const std::vector<const void*> first = storage(data.get_deriv_tangent());
+
+    data.clear_deriv_tangent();
+    expect_cleared(data.get_deriv_tangent(), 6);
+
+    // the normal maps are independent of the tangent maps
+    EXPECT_TRUE(data.get_deriv_n().empty());
+
+    data.reserve_deriv_tangent(6);
+    fill(data.get_deriv_tangent(), 6);
+    EXPECT_EQ(storage(data.get_deriv_tangent()), first);
+  }
+}  // namespace
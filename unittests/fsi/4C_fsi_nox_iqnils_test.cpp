@@ -0,0 +1,212 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_fsi_nox_iqnils.hpp"
+
+#include <Epetra_Map.h>
+#include <Epetra_SerialComm.h>
+#include <Epetra_Vector.h>
+#include <NOX.H>
+#include <NOX_Epetra.H>
+#include <NOX_Epetra_Interface_Required.H>
+
+#include <utility>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  constexpr int n = 6;
+
+  /*!
+   * The linear fixed-point problem x = A x + b with an upper bidiagonal matrix A. Its residual
+   * F(x) = A x + b - x mimics one sweep over the fields of a partitioned scheme.
+   */
+  class LinearFixedPointProblem : public ::NOX::Epetra::Interface::Required
+  {
+   public:
+    LinearFixedPointProblem(double diagonal_shift, double diagonal_scale)
+    {
+      for (int i = 0; i < n; ++i) solution_[i] = 1.0 + 0.25 * i * i;
+      set_matrix(diagonal_shift, diagonal_scale);
+    }
+
+    //! change A but keep the solution
+    void set_matrix(double diagonal_shift, double diagonal_scale)
+    {
+      for (int i = 0; i < n; ++i) diagonal_[i] = diagonal_scale * (diagonal_shift + 0.5 * i);
+      set_solution(solution_);
+    }
+
+    //! choose b such that @p solution solves the problem
+    void set_solution(const std::vector<double>& solution)
+    {
+      solution_ = solution;
+      for (int i = 0; i < n; ++i) b_[i] = solution_[i] - apply_a(solution_.data(), i);
+    }
+
+    bool computeF(const Epetra_Vector& x, Epetra_Vector& F, const FillType) override
+    {
+      for (int i = 0; i < n; ++i) F[i] = apply_a(x.Values(), i) + b_[i] - x[i];
+      return true;
+    }
+
+    const std::vector<double>& solution() const { return solution_; }
+
+   private:
+    double apply_a(const double* x, int i) const
+    {
+      return diagonal_[i] * x[i] + (i + 1 < n ? off_diagonal_ * x[i + 1] : 0.0);
+    }
+
+    std::vector<double> diagonal_ = std::vector<double>(n);
+    const double off_diagonal_ = 0.3;
+    std::vector<double> b_ = std::vector<double>(n);
+    std::vector<double> solution_ = std::vector<double>(n);
+  };
+
+  //! hands out one direction object to all solvers, just like NOX::FSI::QuasiNewtonILSFactory
+  class FixedDirectionFactory : public ::NOX::Direction::UserDefinedFactory
+  {
+   public:
+    explicit FixedDirectionFactory(Teuchos::RCP<NOX::FSI::QuasiNewtonILS> direction)
+        : direction_(std::move(direction))
+    {
+    }
+
+    Teuchos::RCP<::NOX::Direction::Generic> buildDirection(
+        const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& params) const override
+    {
+      direction_->reset(gd, params);
+      return direction_;
+    }
+
+   private:
+    Teuchos::RCP<NOX::FSI::QuasiNewtonILS> direction_;
+  };
+
+  class QuasiNewtonILSTest : public ::testing::Test
+  {
+   protected:
+    void set_up_direction(int reuse_steps, int max_columns)
+    {
+      Teuchos::ParameterList& iqnparams = params_.sublist("Direction").sublist("IQN-ILS");
+      iqnparams.set("omega", 1.0);
+      iqnparams.set("reuse steps", reuse_steps);
+      iqnparams.set("max columns", max_columns);
+      iqnparams.set("filter tolerance", 1e-8);
+
+      direction_ = Teuchos::make_rcp<NOX::FSI::QuasiNewtonILS>(
+          Teuchos::make_rcp<::NOX::Utils>(), params_.sublist("Direction"));
+
+      params_.set("Nonlinear Solver", "Line Search Based");
+      params_.sublist("Printing").set("Output Information", ::NOX::Utils::Error);
+      params_.sublist("Direction").set("Method", "User Defined");
+      params_.sublist("Direction")
+          .set<Teuchos::RCP<::NOX::Direction::UserDefinedFactory>>(
+              "User Defined Direction Factory",
+              Teuchos::make_rcp<FixedDirectionFactory>(direction_));
+      params_.sublist("Line Search").set("Method", "Full Step");
+      params_.sublist("Line Search").sublist("Full Step").set("Full Step", 1.0);
+    }
+
+    //! solve one time step starting at @p initial_guess and return the number of iterations
+    int solve(
+        LinearFixedPointProblem& problem, const std::vector<double>& initial_guess, int max_iter)
+    {
+      Epetra_Vector x(map_);
+      for (int i = 0; i < n; ++i) x[i] = initial_guess[i];
+
+      auto interface = Teuchos::rcpFromRef(problem);
+      auto grp = Teuchos::make_rcp<::NOX::Epetra::Group>(
+          params_.sublist("Printing"), interface, ::NOX::Epetra::Vector(x));
+
+      auto combo = Teuchos::make_rcp<::NOX::StatusTest::Combo>(::NOX::StatusTest::Combo::OR);
+      combo->addStatusTest(Teuchos::make_rcp<::NOX::StatusTest::NormF>(1e-10));
+      combo->addStatusTest(Teuchos::make_rcp<::NOX::StatusTest::MaxIters>(max_iter));
+
+      Teuchos::RCP<::NOX::Solver::Generic> solver =
+          ::NOX::Solver::buildSolver(grp, combo, Teuchos::rcpFromRef(params_));
+      EXPECT_EQ(solver->solve(), ::NOX::StatusTest::Converged);
+
+      const auto& solution = dynamic_cast<const ::NOX::Epetra::Vector&>(
+          solver->getSolutionGroup().getX()).getEpetraVector();
+      for (int i = 0; i < n; ++i) EXPECT_NEAR(solution[i], problem.solution()[i], 1e-8);
+
+      return solver->getNumIterations();
+    }
+
+    Epetra_SerialComm comm_;
+    Epetra_Map map_{n, 0, comm_};
+    Teuchos::ParameterList params_;
+    Teuchos::RCP<NOX::FSI::QuasiNewtonILS> direction_;
+  };
+
+  TEST_F(QuasiNewtonILSTest, ConvergesWherePlainIterationDiverges)
+  {
+    // the spectral radius of A is 1.6, hence the plain fixed-point iteration diverges
+    LinearFixedPointProblem problem(-1.6, 1.0);
+    set_up_direction(0, 0);
+
+    // the least-squares model is exact for a linear problem once n secant pairs are known
+    const int iterations = solve(problem, std::vector<double>(n, 0.0), 20);
+    EXPECT_LE(iterations, n + 2);
+    EXPECT_LE(direction_->num_secant_pairs(), n);
+  }
+
+  TEST_F(QuasiNewtonILSTest, ReusedSecantPairsSpeedUpNextTimeStep)
+  {
+    LinearFixedPointProblem problem(-1.6, 1.0);
+    set_up_direction(1, 0);
+
+    const int first_iterations = solve(problem, std::vector<double>(n, 0.0), 20);
+
+    // the secant pairs of the previous time step already describe the inverse Jacobian
+    const std::vector<double> old_solution = problem.solution();
+    std::vector<double> new_solution = old_solution;
+    for (int i = 0; i < n; ++i) new_solution[i] += 0.1 * (i % 2 == 0 ? 1.0 : -1.0);
+    problem.set_solution(new_solution);
+
+    const int second_iterations = solve(problem, old_solution, 20);
+    EXPECT_LT(second_iterations, first_iterations);
+  }
+
+  TEST_F(QuasiNewtonILSTest, DependentSecantPairsAreFiltered)
+  {
+    LinearFixedPointProblem problem(-1.6, 1.0);
+    set_up_direction(1, 0);
+
+    solve(problem, std::vector<double>(n, 0.0), 20);
+    const int first_num_pairs = direction_->num_secant_pairs();
+
+    // with a changed Jacobian, the reused secant pairs are outdated and new ones are added
+    problem.set_matrix(-1.4, 1.0);
+    const int second_iterations = solve(problem, std::vector<double>(n, 0.0), 20);
+    ASSERT_GT(first_num_pairs + second_iterations - 1, n);
+
+    // in n dimensions at most n secant pairs are linearly independent, the others are removed
+    EXPECT_LE(direction_->num_secant_pairs(), n);
+  }
+
+  TEST_F(QuasiNewtonILSTest, HistoryIsTruncated)
+  {
+    // a contractive problem that converges with a short history as well
+    LinearFixedPointProblem problem(0.1, 0.2);
+    set_up_direction(0, 2);
+
+    const int iterations = solve(problem, std::vector<double>(n, 0.0), 100);
+    EXPECT_GT(iterations, 3);
+    EXPECT_EQ(direction_->num_secant_pairs(), 2);
+
+    // without reuse, the secant pairs of the previous time step are dropped for the next one
+    solve(problem, problem.solution(), 100);
+    EXPECT_EQ(direction_->num_secant_pairs(), 0);
+  }
+}  // namespace
@@ -0,0 +1,201 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_assemblestrategy.hpp"
+#include "4C_fem_general_element.hpp"
+#include "4C_fem_general_node.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io_gridgenerator.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_linalg_vector.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+#include "4C_utils_shared_memory_parallel.hpp"
+#include "4C_utils_singleton_owner.hpp"
+
+#include <Epetra_SerialComm.h>
+#include <Teuchos_ParameterList.hpp>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  /*!
+   * Element action that fills the element matrix and vector with values depending on the element
+   * id. All values are exactly representable and small, so their sums do not depend on the
+   * summation order.
+   */
+  void dummy_element_action(Core::Elements::Element& ele, Core::Elements::LocationArray&,
+      Core::LinAlg::SerialDenseMatrix& elemat1, Core::LinAlg::SerialDenseMatrix&,
+      Core::LinAlg::SerialDenseVector& elevec1, Core::LinAlg::SerialDenseVector&,
+      Core::LinAlg::SerialDenseVector&)
+  {
+    const double base = 1.0 + ele.id() % 7;
+    for (int i = 0; i < elemat1.numRows(); ++i)
+    {
+      for (int j = 0; j < elemat1.numCols(); ++j) elemat1(i, j) = base + 0.5 * i - 0.25 * j;
+      elevec1(i) = base - 0.125 * i;
+    }
+  }
+
+  //! assemble the dummy element action into a matrix with saved graph and a vector twice
+  void assemble_twice(Core::FE::Discretization& dis, Core::LinAlg::SparseMatrix& sysmat,
+      Core::LinAlg::Vector<double>& sysvec)
+  {
+    std::shared_ptr<Core::LinAlg::SparseMatrix> sysmat_ptr(&sysmat, [](auto*) {});
+    std::shared_ptr<Core::LinAlg::Vector<double>> sysvec_ptr(&sysvec, [](auto*) {});
+    Teuchos::ParameterList params;
+
+    // the first assembly goes into the unfilled matrix, the second one into the filled matrix
+    for (int pass = 0; pass < 2; ++pass)
+    {
+      sysmat.zero();
+      sysvec.PutScalar(0.0);
+
+      Core::FE::AssembleStrategy strategy(
+          0, 0, sysmat_ptr, nullptr, sysvec_ptr, nullptr, nullptr);
+      EXPECT_EQ(strategy.allows_concurrent_assembly(), pass == 1);
+      dis.evaluate(params, strategy, dummy_element_action);
+      sysmat.complete();
+    }
+  }
+
+  //! return all entries of a matrix sorted by global row and column id
+  std::map<std::pair<int, int>, double> matrix_entries(const Core::LinAlg::SparseMatrix& sysmat)
+  {
+    std::map<std::pair<int, int>, double> entries;
+    const Epetra_CrsMatrix& crs = *sysmat.epetra_matrix();
+    for (int lrow = 0; lrow < crs.NumMyRows(); ++lrow)
+    {
+      int length;
+      double* values;
+      int* indices;
+      crs.ExtractMyRowView(lrow, length, values, indices);
+      for (int k = 0; k < length; ++k)
+        entries[{crs.GRID(lrow), crs.GCID(indices[k])}] = values[k];
+    }
+    return entries;
+  }
+
+  class DiscretizationElementColorsTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      Core::IO::InputParameterContainer mat_stvenant;
+      mat_stvenant.add("YOUNG", 1.0);
+      mat_stvenant.add("NUE", 0.1);
+      mat_stvenant.add("DENS", 2.0);
+      Global::Problem::instance()->materials()->insert(
+          1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+
+      comm_ = std::make_shared<Epetra_SerialComm>();
+      Core::IO::cout.setup(false, false, false, Core::IO::standard, comm_, 0, 0, "dummyFilePrefix");
+      testdis_ = std::make_shared<Core::FE::Discretization>("dummy", comm_, 3);
+
+      Core::IO::GridGenerator::RectangularCuboidInputs inputData{};
+      inputData.bottom_corner_point_ = std::array<double, 3>{0.0, 0.0, 0.0};
+      inputData.top_corner_point_ = std::array<double, 3>{1.0, 2.0, 3.0};
+      inputData.interval_ = std::array<int, 3>{3, 4, 5};
+      inputData.node_gid_of_first_new_node_ = 0;
+      inputData.elementtype_ = "SOLID";
+      inputData.distype_ = "HEX8";
+      inputData.elearguments_ = "MAT 1 KINEM nonlinear";
+
+      Core::IO::GridGenerator::create_rectangular_cuboid_discretization(
+          *testdis_, inputData, true);
+      testdis_->fill_complete(true, false, false);
+    }
+
+    void TearDown() override { Core::IO::cout.close(); }
+
+    std::shared_ptr<Core::FE::Discretization> testdis_;
+    std::shared_ptr<Epetra_Comm> comm_;
+
+    Core::Utils::SingletonOwnerRegistry::ScopeGuard guard;
+  };
+
+  TEST_F(DiscretizationElementColorsTest, EveryElementHasExactlyOneColor)
+  {
+    const std::vector<std::vector<int>>& colors = testdis_->element_colors();
+
+    std::vector<int> num_colors_of_element(testdis_->num_my_col_elements(), 0);
+    for (const std::vector<int>& color : colors)
+      for (const int lid : color) ++num_colors_of_element[lid];
+
+    for (const int num : num_colors_of_element) EXPECT_EQ(num, 1);
+  }
+
+  TEST_F(DiscretizationElementColorsTest, ElementsOfOneColorShareNoNode)
+  {
+    const std::vector<std::vector<int>>& colors = testdis_->element_colors();
+
+    // a structured hex8 mesh needs eight colors, each node is shared by up to eight elements
+    EXPECT_GE(colors.size(), 8u);
+
+    for (const std::vector<int>& color : colors)
+    {
+      std::set<int> nodes_of_color;
+      for (const int lid : color)
+      {
+        const Core::Elements::Element& ele = *testdis_->l_col_element(lid);
+        for (int inode = 0; inode < ele.num_node(); ++inode)
+          EXPECT_TRUE(nodes_of_color.insert(ele.node_ids()[inode]).second)
+              << "node " << ele.node_ids()[inode] << " is shared within one color";
+      }
+    }
+  }
+
+  TEST_F(DiscretizationElementColorsTest, ColoringIsRebuiltAfterFillComplete)
+  {
+    EXPECT_FALSE(testdis_->element_colors().empty());
+
+    // fill_complete() resets the discretization and thus drops the coloring
+    testdis_->fill_complete(true, false, false);
+
+    std::size_t num_colored = 0;
+    for (const std::vector<int>& color : testdis_->element_colors()) num_colored += color.size();
+    EXPECT_EQ(num_colored, static_cast<std::size_t>(testdis_->num_my_col_elements()));
+  }
+
+  TEST_F(DiscretizationElementColorsTest, ThreadedAssemblyMatchesSerialAssembly)
+  {
+    const Epetra_Map& dofrowmap = *testdis_->dof_row_map();
+
+    Core::LinAlg::SparseMatrix serial_mat(dofrowmap, 81, false, true);
+    Core::LinAlg::Vector<double> serial_vec(dofrowmap, true);
+    testdis_->set_num_evaluation_threads(1);
+    assemble_twice(*testdis_, serial_mat, serial_vec);
+
+    // the first pass takes the locked path, the second pass the colored lock-free path
+    Core::LinAlg::SparseMatrix threaded_mat(dofrowmap, 81, false, true);
+    Core::LinAlg::Vector<double> threaded_vec(dofrowmap, true);
+    testdis_->set_num_evaluation_threads(std::max(2, Core::Utils::max_threads()));
+    assemble_twice(*testdis_, threaded_mat, threaded_vec);
+
+    const auto serial_entries = matrix_entries(serial_mat);
+    const auto threaded_entries = matrix_entries(threaded_mat);
+    ASSERT_EQ(serial_entries.size(), threaded_entries.size());
+    for (const auto& [index, value] : serial_entries)
+    {
+      ASSERT_EQ(threaded_entries.count(index), 1u);
+      EXPECT_EQ(threaded_entries.at(index), value);
+    }
+
+    for (int i = 0; i < serial_vec.MyLength(); ++i) EXPECT_EQ(threaded_vec[i], serial_vec[i]);
+  }
+}  // namespace
@@ -10,7 +10,9 @@
 #include "4C_linalg_fixedsizematrix.hpp"
 #include "4C_linalg_fixedsizematrix_tensor_products.hpp"
 #include "4C_mat_elast_coupanisoexpo.hpp"
+#include "4C_mat_elast_coupneohooke.hpp"
 #include "4C_mat_elast_isoneohooke.hpp"
+#include "4C_mat_elast_volsussmanbathe.hpp"
 #include "4C_mat_elasthyper_service.hpp"
 #include "4C_mat_material_factory.hpp"
 #include "4C_material_parameter_base.hpp"
@@ -154,4 +156,93 @@ namespace
     FOUR_C_EXPECT_NEAR(dPI, dPI_ref, 1.0e-4);
     FOUR_C_EXPECT_NEAR(ddPII, ddPII_ref, 1.0e-4);
   }
+
+  TEST_F(ElastHyperServiceTest, TestEvaluateInvariantDerivativesCompiledKernel)
+  {
+    // Create parameters of IsoNeoHooke and VolSussmanBathe material
+    Core::IO::InputParameterContainer iso_neo_hooke_data;
+    iso_neo_hooke_data.add("MUE", 1.3);
+    Core::IO::InputParameterContainer vol_sussman_bathe_data;
+    vol_sussman_bathe_data.add("KAPPA", 2.7);
+
+    auto iso_neo_hooke_params =
+        Mat::make_parameter(1, Core::Materials::MaterialType::mes_isoneohooke, iso_neo_hooke_data);
+    auto vol_sussman_bathe_params = Mat::make_parameter(
+        2, Core::Materials::MaterialType::mes_volsussmanbathe, vol_sussman_bathe_data);
+
+    // Create summand vector
+    std::vector<std::shared_ptr<Mat::Elastic::Summand>> potsum(0);
+    potsum.emplace_back(std::make_shared<Mat::Elastic::IsoNeoHooke>(
+        dynamic_cast<Mat::Elastic::PAR::IsoNeoHooke *>(iso_neo_hooke_params.get())));
+    potsum.emplace_back(std::make_shared<Mat::Elastic::VolSussmanBathe>(
+        dynamic_cast<Mat::Elastic::PAR::VolSussmanBathe *>(vol_sussman_bathe_params.get())));
+
+    // Read summand properties, the combination of summands is known
+    Mat::SummandProperties properties;
+    Mat::elast_hyper_properties(potsum, properties);
+    EXPECT_NE(properties.invariantDerivativesKernel, nullptr);
+
+    // the same properties evaluated with the generic loop over all summands
+    Mat::SummandProperties properties_generic;
+    properties_generic.update(properties);
+    properties_generic.invariantDerivativesKernel = nullptr;
+
+    Core::LinAlg::Matrix<3, 1> dPI(true);
+    Core::LinAlg::Matrix<6, 1> ddPII(true);
+    Mat::elast_hyper_evaluate_invariant_derivatives(prinv_, dPI, ddPII, potsum, properties, 0, 0);
+
+    Core::LinAlg::Matrix<3, 1> dPI_ref(true);
+    Core::LinAlg::Matrix<6, 1> ddPII_ref(true);
+    Mat::elast_hyper_evaluate_invariant_derivatives(
+        prinv_, dPI_ref, ddPII_ref, potsum, properties_generic, 0, 0);
+
+    FOUR_C_EXPECT_NEAR(dPI, dPI_ref, 1.0e-14);
+    FOUR_C_EXPECT_NEAR(ddPII, ddPII_ref, 1.0e-14);
+  }
+
+  TEST_F(ElastHyperServiceTest, TestEvaluateInvariantDerivativesCompiledKernelPrincipal)
+  {
+    // Create parameters of CoupNeoHooke and VolSussmanBathe material
+    Core::IO::InputParameterContainer coup_neo_hooke_data;
+    coup_neo_hooke_data.add("YOUNG", 210.0);
+    coup_neo_hooke_data.add("NUE", 0.3);
+    Core::IO::InputParameterContainer vol_sussman_bathe_data;
+    vol_sussman_bathe_data.add("KAPPA", 2.7);
+
+    auto coup_neo_hooke_params = Mat::make_parameter(
+        1, Core::Materials::MaterialType::mes_coupneohooke, coup_neo_hooke_data);
+    auto vol_sussman_bathe_params = Mat::make_parameter(
+        2, Core::Materials::MaterialType::mes_volsussmanbathe, vol_sussman_bathe_data);
+
+    // Create summand vector with a principal and a decoupled summand
+    std::vector<std::shared_ptr<Mat::Elastic::Summand>> potsum(0);
+    potsum.emplace_back(std::make_shared<Mat::Elastic::CoupNeoHooke>(
+        dynamic_cast<Mat::Elastic::PAR::CoupNeoHooke *>(coup_neo_hooke_params.get())));
+    potsum.emplace_back(std::make_shared<Mat::Elastic::VolSussmanBathe>(
+        dynamic_cast<Mat::Elastic::PAR::VolSussmanBathe *>(vol_sussman_bathe_params.get())));
+
+    // Read summand properties, the combination of summands is known
+    Mat::SummandProperties properties;
+    Mat::elast_hyper_properties(potsum, properties);
+    EXPECT_TRUE(properties.isoprinc);
+    EXPECT_TRUE(properties.isomod);
+    EXPECT_NE(properties.invariantDerivativesKernel, nullptr);
+
+    // the same properties evaluated with the generic loop over all summands
+    Mat::SummandProperties properties_generic;
+    properties_generic.update(properties);
+    properties_generic.invariantDerivativesKernel = nullptr;
+
+    Core::LinAlg::Matrix<3, 1> dPI(true);
+    Core::LinAlg::Matrix<6, 1> ddPII(true);
+    Mat::elast_hyper_evaluate_invariant_derivatives(prinv_, dPI, ddPII, potsum, properties, 0, 0);
+
+    Core::LinAlg::Matrix<3, 1> dPI_ref(true);
+    Core::LinAlg::Matrix<6, 1> ddPII_ref(true);
+    Mat::elast_hyper_evaluate_invariant_derivatives(
+        prinv_, dPI_ref, ddPII_ref, potsum, properties_generic, 0, 0);
+
+    FOUR_C_EXPECT_NEAR(dPI, dPI_ref, 1.0e-14);
+    FOUR_C_EXPECT_NEAR(ddPII, ddPII_ref, 1.0e-14);
+  }
 }  // namespace
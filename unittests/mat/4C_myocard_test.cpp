@@ -0,0 +1,100 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_mat_myocard.hpp"
+#include "4C_material_parameter_base.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  //! ionic model and membrane potentials at its Gauss points
+  struct MyocardModel
+  {
+    std::string model;
+    std::vector<double> phi;
+  };
+
+  class MyocardTest : public ::testing::TestWithParam<MyocardModel>
+  {
+   protected:
+    void SetUp() override
+    {
+      Core::IO::InputParameterContainer container;
+      container.add("DIFF1", 1.0e-4);
+      container.add("DIFF2", 1.0e-4);
+      container.add("PERTUBATION_DERIV", 1.0e-6);
+      container.add("MODEL", GetParam().model);
+      container.add("TISSUE", std::string("M"));
+      container.add("TIME_SCALE", 2.0);
+
+      parameters_myocard_ = std::make_shared<Mat::PAR::Myocard>(
+          Core::Mat::PAR::Parameter::Data{.parameters = container});
+
+      myocard_ = std::make_shared<Mat::Myocard>(parameters_myocard_.get());
+      myocard_->set_gp(static_cast<int>(GetParam().phi.size()));
+      myocard_->initialize();
+    }
+
+    //! time step size
+    const double dt_ = 0.1;
+
+    std::shared_ptr<Mat::PAR::Myocard> parameters_myocard_;
+
+    //! material class
+    std::shared_ptr<Mat::Myocard> myocard_;
+  };
+
+  TEST_P(MyocardTest, ReaCoeffAndDerivAllGpEqualPerGp)
+  {
+    const std::vector<double>& phi = GetParam().phi;
+    const int num_gp = static_cast<int>(phi.size());
+    ASSERT_EQ(myocard_->get_number_of_gp(), num_gp);
+
+    std::vector<double> reacoeff_gp(num_gp);
+    std::vector<double> reacoeffderiv_gp(num_gp);
+    for (int gp = 0; gp < num_gp; ++gp)
+    {
+      reacoeffderiv_gp[gp] = myocard_->rea_coeff_deriv(phi[gp], dt_, gp);
+      reacoeff_gp[gp] = myocard_->rea_coeff(phi[gp], dt_, gp);
+    }
+
+    std::vector<double> reacoeff;
+    std::vector<double> reacoeffderiv;
+    myocard_->rea_coeff_and_deriv_all_gp(phi, dt_, reacoeff, reacoeffderiv);
+
+    ASSERT_EQ(reacoeff.size(), phi.size());
+    ASSERT_EQ(reacoeffderiv.size(), phi.size());
+    for (int gp = 0; gp < num_gp; ++gp)
+    {
+      EXPECT_DOUBLE_EQ(reacoeff[gp], reacoeff_gp[gp]) << "Gauss point " << gp;
+      EXPECT_DOUBLE_EQ(reacoeffderiv[gp], reacoeffderiv_gp[gp]) << "Gauss point " << gp;
+    }
+
+    // the internal state afterwards corresponds to the unperturbed potentials
+    for (int k = 0; k < myocard_->get_number_of_internal_state_variables(); ++k)
+    {
+      for (int gp = 0; gp < num_gp; ++gp)
+      {
+        const double state = myocard_->get_internal_state(k, gp);
+        myocard_->rea_coeff(phi[gp], dt_, gp);
+        EXPECT_DOUBLE_EQ(state, myocard_->get_internal_state(k, gp)) << "Gauss point " << gp;
+      }
+    }
+  }
+
+  INSTANTIATE_TEST_SUITE_P(IonicModels, MyocardTest,
+      ::testing::Values(MyocardModel{"MV", {0.0, 0.05, 0.4, 0.9, 1.3}},
+          MyocardModel{"FHN", {0.0, 0.1, 0.5, 0.8}}, MyocardModel{"TNNP", {-60.0}}),
+      [](const ::testing::TestParamInfo<MyocardModel>& info) { return info.param.model; });
+}  // namespace
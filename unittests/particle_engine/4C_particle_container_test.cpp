@@ -10,6 +10,8 @@
 #include "4C_particle_engine_container.hpp"
 #include "4C_unittest_utils_assertions_test.hpp"
 
+#include <cstdint>
+
 
 namespace
 {
@@ -358,6 +360,47 @@ namespace
     EXPECT_EQ(currpos, nullptr);
   }
 
+  TEST_F(ParticleContainerTest, GetStateView)
+  {
+    PARTICLEENGINE::ParticleStateView pos = container_->get_state_view(PARTICLEENGINE::Position);
+    PARTICLEENGINE::ParticleStateView mass = container_->get_state_view(PARTICLEENGINE::Mass);
+
+    EXPECT_TRUE(pos);
+    EXPECT_EQ(pos.dim(), 3);
+    EXPECT_EQ(pos.size(), 3);
+    EXPECT_EQ(pos.num_values(), 9);
+    EXPECT_EQ(mass.num_values(), 3);
+
+    for (int index = 0; index < 3; ++index)
+    {
+      EXPECT_EQ(pos[index], container_->get_ptr_to_state(PARTICLEENGINE::Position, index));
+      EXPECT_EQ(mass[index], container_->get_ptr_to_state(PARTICLEENGINE::Mass, index));
+    }
+
+    // states of all particles are stored contiguously and aligned
+    std::vector<double> mass_reference = {0.12, 12.34, 0.5};
+    FOUR_C_EXPECT_ITERABLE_NEAR(mass.begin(), mass_reference.begin(), 3, 1e-14);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pos.data()) % 64, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mass.data()) % 64, 0);
+  }
+
+  TEST_F(ParticleContainerTest, CondGetStateViewNotStored)
+  {
+    EXPECT_FALSE(container_->cond_get_state_view(PARTICLEENGINE::Acceleration));
+    EXPECT_FALSE(container_->cond_get_state_view(PARTICLEENGINE::Density));
+    EXPECT_TRUE(container_->cond_get_state_view(PARTICLEENGINE::Velocity));
+  }
+
+  TEST_F(ParticleContainerTest, GetStateViewAfterResize)
+  {
+    container_->increase_container_size();
+
+    PARTICLEENGINE::ParticleStateView vel = container_->get_state_view(PARTICLEENGINE::Velocity);
+
+    std::vector<double> vel_reference = {0.23, 1.76, 3.89, 0.25, -21.5, 1.0, -7.35, -5.98, 1.11};
+    FOUR_C_EXPECT_ITERABLE_NEAR(vel.begin(), vel_reference.begin(), 9, 1e-14);
+  }
+
   TEST_F(ParticleContainerTest, GetPtrToGlobalID)
   {
     int globalid_reference(0);
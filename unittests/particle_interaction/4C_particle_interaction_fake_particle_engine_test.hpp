@@ -0,0 +1,206 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_PARTICLE_INTERACTION_FAKE_PARTICLE_ENGINE_TEST_HPP
+#define FOUR_C_PARTICLE_INTERACTION_FAKE_PARTICLE_ENGINE_TEST_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_particle_engine_container.hpp"
+#include "4C_particle_engine_container_bundle.hpp"
+#include "4C_particle_engine_interface.hpp"
+#include "4C_utils_exceptions.hpp"
+
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace TESTING
+{
+  /*!
+   * \brief Particle engine without binning and without periodic boundaries
+   *
+   * The particles are stored in a particle container bundle with the given states. The potential
+   * particle neighbors are all pairs of particles, just like the bin-based ones of a single bin.
+   * Only the methods needed by the neighbor pair handlers are implemented.
+   */
+  class FakeParticleEngine : public PARTICLEENGINE::ParticleEngineInterface
+  {
+   public:
+    explicit FakeParticleEngine(
+        const std::map<PARTICLEENGINE::ParticleType, std::set<PARTICLEENGINE::ParticleState>>&
+            particlestatestotypes)
+        : particlecontainerbundle_(std::make_shared<PARTICLEENGINE::ParticleContainerBundle>())
+    {
+      particlecontainerbundle_->init();
+      particlecontainerbundle_->setup(particlestatestotypes);
+    }
+
+    //! add an owned particle of @p type with the given states
+    void add_particle(
+        PARTICLEENGINE::ParticleType type, const PARTICLEENGINE::ParticleStates& states)
+    {
+      int index;
+      particlecontainerbundle_->get_specific_container(type, PARTICLEENGINE::Owned)
+          ->add_particle(index, numparticles_++, states);
+    }
+
+    //! build the potential particle neighbors as all pairs of particles
+    void build_potential_particle_neighbors()
+    {
+      std::vector<PARTICLEENGINE::LocalIndexTuple> particles;
+      for (const auto& type : particlecontainerbundle_->get_particle_types())
+      {
+        for (const auto& status : {PARTICLEENGINE::Owned, PARTICLEENGINE::Ghosted})
+        {
+          const int particlestored =
+              particlecontainerbundle_->get_specific_container(type, status)->particles_stored();
+          for (int i = 0; i < particlestored; ++i) particles.emplace_back(type, status, i);
+        }
+      }
+
+      potentialparticleneighbors_.clear();
+      for (std::size_t i = 0; i < particles.size(); ++i)
+        for (std::size_t j = i + 1; j < particles.size(); ++j)
+          potentialparticleneighbors_.emplace_back(particles[i], particles[j]);
+
+      ++numpotentialparticleneighborsbuilds_;
+    }
+
+    //! potential particle neighbors for direct modification
+    PARTICLEENGINE::PotentialParticleNeighbors& potential_particle_neighbors()
+    {
+      return potentialparticleneighbors_;
+    }
+
+    PARTICLEENGINE::ParticleContainerBundleShrdPtr get_particle_container_bundle() const override
+    {
+      return particlecontainerbundle_;
+    }
+
+    const PARTICLEENGINE::PotentialParticleNeighbors& get_potential_particle_neighbors()
+        const override
+    {
+      return potentialparticleneighbors_;
+    }
+
+    int get_num_potential_particle_neighbors_builds() const override
+    {
+      return numpotentialparticleneighborsbuilds_;
+    }
+
+    void distance_between_particles(
+        const double* pos_i, const double* pos_j, double* r_ji) const override
+    {
+      for (int dim = 0; dim < 3; ++dim) r_ji[dim] = pos_j[dim] - pos_i[dim];
+    }
+
+    bool have_periodic_boundary_conditions() const override { return false; }
+
+    bool have_periodic_boundary_conditions_in_spatial_direction(const int dim) const override
+    {
+      return false;
+    }
+
+    void free_unique_global_ids(std::vector<int>& freeuniquegids) override { not_implemented(); }
+
+    void get_unique_global_ids_for_all_particles(
+        std::vector<PARTICLEENGINE::ParticleObjShrdPtr>& particlestogetuniquegids) override
+    {
+      not_implemented();
+    }
+
+    void refresh_particles_of_specific_states_and_types(
+        const PARTICLEENGINE::StatesOfTypesToRefresh& particlestatestotypes) const override
+    {
+      // there are no ghosted particles to refresh
+    }
+
+    void hand_over_particles_to_be_removed(std::vector<std::set<int>>& particlestoremove) override
+    {
+      not_implemented();
+    }
+
+    void hand_over_particles_to_be_inserted(
+        std::vector<std::vector<std::pair<int, PARTICLEENGINE::ParticleObjShrdPtr>>>&
+            particlestoinsert) override
+    {
+      not_implemented();
+    }
+
+    const std::vector<std::vector<int>>& get_communicated_particle_targets() const override
+    {
+      not_implemented();
+    }
+
+    PARTICLEENGINE::LocalIndexTupleShrdPtr get_local_index_in_specific_container(
+        int globalid) const override
+    {
+      not_implemented();
+    }
+
+    std::shared_ptr<Core::IO::DiscretizationWriter> get_bin_discretization_writer() const override
+    {
+      not_implemented();
+    }
+
+    void relate_all_particles_to_all_procs(std::vector<int>& particlestoproc) const override
+    {
+      not_implemented();
+    }
+
+    void get_particles_within_radius(const double* position, const double radius,
+        std::vector<PARTICLEENGINE::LocalIndexTuple>& neighboringparticles) const override
+    {
+      not_implemented();
+    }
+
+    std::array<double, 3> bin_size() const override { not_implemented(); }
+
+    double min_bin_size() const override { not_implemented(); }
+
+    double length_of_binning_domain_in_a_spatial_direction(const int dim) const override
+    {
+      not_implemented();
+    }
+
+    Core::LinAlg::Matrix<3, 2> const& domain_bounding_box_corner_positions() const override
+    {
+      not_implemented();
+    }
+
+    int get_number_of_particles() const override { return numparticles_; }
+
+    int get_number_of_particles_of_specific_type(
+        const PARTICLEENGINE::ParticleType type) const override
+    {
+      return particlecontainerbundle_->get_specific_container(type, PARTICLEENGINE::Owned)
+          ->particles_stored();
+    }
+
+   private:
+    [[noreturn]] static void not_implemented()
+    {
+      FOUR_C_THROW("not implemented in the fake particle engine");
+    }
+
+    PARTICLEENGINE::ParticleContainerBundleShrdPtr particlecontainerbundle_;
+
+    PARTICLEENGINE::PotentialParticleNeighbors potentialparticleneighbors_;
+
+    int numpotentialparticleneighborsbuilds_ = 0;
+
+    int numparticles_ = 0;
+  };
+}  // namespace TESTING
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
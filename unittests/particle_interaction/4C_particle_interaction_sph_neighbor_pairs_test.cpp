@@ -0,0 +1,283 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_particle_interaction_sph_neighbor_pairs.hpp"
+
+#include "4C_global_data.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_particle_interaction_fake_particle_engine_test.hpp"
+#include "4C_particle_interaction_material_handler.hpp"
+#include "4C_particle_interaction_sph_density.hpp"
+#include "4C_particle_interaction_sph_kernel.hpp"
+#include "4C_particle_interaction_sph_momentum.hpp"
+#include "4C_utils_singleton_owner.hpp"
+
+#include <Teuchos_StandardParameterEntryValidators.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+
+#ifdef FOUR_C_WITH_OPENMP
+#include <omp.h>
+#endif
+
+namespace
+{
+  using namespace FourC;
+
+  //! add a string parameter with @p value as its only valid value
+  template <typename T>
+  void set_integral_parameter(Teuchos::ParameterList& params, const std::string& name,
+      const std::string& value, T enumvalue)
+  {
+    Teuchos::setStringToIntegralParameter<T>(
+        name, value, "", Teuchos::tuple<std::string>(value), Teuchos::tuple<T>(enumvalue), &params);
+  }
+
+  /*!
+   * A jittered lattice of fluid particles whose pair contributions are evaluated with one thread
+   * and with several threads. The threaded evaluation processes the pairs by color.
+   */
+  class SPHNeighborPairsTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+#ifndef FOUR_C_WITH_OPENMP
+      GTEST_SKIP() << "the particle pairs are only colored with more than one thread";
+#else
+      maxthreads_ = omp_get_max_threads();
+#endif
+
+      // parameters of smoothed particle hydrodynamics
+      set_integral_parameter(
+          params_sph_, "KERNEL_SPACE_DIM", "Kernel3D", Inpar::PARTICLE::Kernel3D);
+      set_integral_parameter(params_sph_, "MOMENTUMFORMULATION", "AdamiMomentumFormulation",
+          Inpar::PARTICLE::AdamiMomentumFormulation);
+      set_integral_parameter(params_sph_, "BOUNDARYPARTICLEINTERACTION", "NoSlipBoundaryParticle",
+          Inpar::PARTICLE::NoSlipBoundaryParticle);
+      set_integral_parameter(params_sph_, "TRANSPORTVELOCITYFORMULATION",
+          "GeneralizedTransportVelocity", Inpar::PARTICLE::GeneralizedTransportVelocity);
+      params_sph_.set("WRITE_PARTICLE_WALL_INTERACTION", false);
+
+      params_.set<std::string>("PHASE_TO_MATERIAL_ID", "phase1 1");
+
+      // fluid material
+      Core::IO::InputParameterContainer fluid;
+      fluid.add("INITRADIUS", radius_);
+      fluid.add("INITDENSITY", 1.0);
+      fluid.add("REFDENSFAC", 1.0);
+      fluid.add("EXPONENT", 7.0);
+      fluid.add("BACKGROUNDPRESSURE", 0.5);
+      fluid.add("BULK_MODULUS", 10.0);
+      fluid.add("DYNAMIC_VISCOSITY", 0.01);
+      fluid.add("BULK_VISCOSITY", 0.005);
+      fluid.add("ARTIFICIAL_VISCOSITY", 0.1);
+      fluid.add("INITTEMPERATURE", 0.0);
+      fluid.add("THERMALCAPACITY", 0.0);
+      fluid.add("THERMALCONDUCTIVITY", 0.0);
+      fluid.add("THERMALABSORPTIVITY", 0.0);
+
+      Global::Problem& problem = (*Global::Problem::instance());
+      problem.materials()->set_read_from_problem(0);
+      problem.materials()->insert(
+          1, Mat::make_parameter(1, Core::Materials::m_particle_sph_fluid, fluid));
+
+      // particles on a jittered lattice with random states
+      particleengine_ = std::make_shared<TESTING::FakeParticleEngine>(
+          std::map<PARTICLEENGINE::ParticleType, std::set<PARTICLEENGINE::ParticleState>>{
+              {PARTICLEENGINE::Phase1,
+                  {PARTICLEENGINE::Position, PARTICLEENGINE::Velocity,
+                      PARTICLEENGINE::Acceleration, PARTICLEENGINE::ModifiedVelocity,
+                      PARTICLEENGINE::ModifiedAcceleration, PARTICLEENGINE::Radius,
+                      PARTICLEENGINE::Mass, PARTICLEENGINE::Density, PARTICLEENGINE::Pressure,
+                      PARTICLEENGINE::DensitySum}}});
+
+      std::mt19937 generator(7);
+      std::uniform_real_distribution<double> jitter(-0.02, 0.02);
+      std::uniform_real_distribution<double> value(0.9, 1.1);
+      std::uniform_real_distribution<double> velocity(-0.1, 0.1);
+
+      for (int i = 0; i < 6; ++i)
+        for (int j = 0; j < 6; ++j)
+          for (int k = 0; k < 6; ++k)
+          {
+            PARTICLEENGINE::ParticleStates states(PARTICLEENGINE::DensitySum + 1);
+            states[PARTICLEENGINE::Position] = {0.1 * i + jitter(generator),
+                0.1 * j + jitter(generator), 0.1 * k + jitter(generator)};
+            states[PARTICLEENGINE::Velocity] = {
+                velocity(generator), velocity(generator), velocity(generator)};
+            states[PARTICLEENGINE::ModifiedVelocity] = {
+                velocity(generator), velocity(generator), velocity(generator)};
+            states[PARTICLEENGINE::Radius] = {radius_};
+            states[PARTICLEENGINE::Mass] = {1.0e-3 * value(generator)};
+            states[PARTICLEENGINE::Density] = {value(generator)};
+            states[PARTICLEENGINE::Pressure] = {0.1 * value(generator)};
+            particleengine_->add_particle(PARTICLEENGINE::Phase1, states);
+          }
+      particleengine_->build_potential_particle_neighbors();
+
+      // handlers of smoothed particle hydrodynamics
+      kernel_ = std::make_shared<ParticleInteraction::SPHKernelCubicSpline>(params_sph_);
+      kernel_->init();
+      kernel_->setup();
+
+      material_ = std::make_shared<ParticleInteraction::MaterialHandler>(params_);
+      material_->init();
+      material_->setup();
+
+      neighborpairs_ = std::make_shared<ParticleInteraction::SPHNeighborPairs>(0.0);
+      neighborpairs_->init();
+      neighborpairs_->setup(particleengine_, nullptr, kernel_);
+    }
+
+    void TearDown() override
+    {
+#ifdef FOUR_C_WITH_OPENMP
+      omp_set_num_threads(maxthreads_);
+#endif
+    }
+
+    //! evaluate the neighbor pairs with @p numthreads threads
+    void evaluate_neighbor_pairs(int numthreads)
+    {
+#ifdef FOUR_C_WITH_OPENMP
+      omp_set_num_threads(numthreads);
+#endif
+      neighborpairs_->evaluate_neighbor_pairs();
+    }
+
+    //! copy of a state of all particles
+    std::vector<double> state(PARTICLEENGINE::ParticleState state) const
+    {
+      PARTICLEENGINE::ParticleContainer* container =
+          particleengine_->get_particle_container_bundle()->get_specific_container(
+              PARTICLEENGINE::Phase1, PARTICLEENGINE::Owned);
+      const int size = container->particles_stored() * container->get_state_dim(state);
+      const double* values = container->get_ptr_to_state(state, 0);
+      return std::vector<double>(values, values + size);
+    }
+
+    //! clear a state of all particles
+    void clear_state(PARTICLEENGINE::ParticleState state) const
+    {
+      particleengine_->get_particle_container_bundle()
+          ->get_specific_container(PARTICLEENGINE::Phase1, PARTICLEENGINE::Owned)
+          ->clear_state(state);
+    }
+
+    //! compare states up to round-off due to the order of summation
+    static void expect_near(const std::vector<double>& actual, const std::vector<double>& expected)
+    {
+      ASSERT_EQ(actual.size(), expected.size());
+      double maxabs = 0.0;
+      for (const double value : expected) maxabs = std::max(maxabs, std::abs(value));
+      ASSERT_GT(maxabs, 0.0);
+      for (std::size_t i = 0; i < actual.size(); ++i)
+        EXPECT_NEAR(actual[i], expected[i], 1.0e-12 * maxabs) << "entry " << i;
+    }
+
+    const double radius_ = 0.25;
+
+    Teuchos::ParameterList params_;
+    Teuchos::ParameterList params_sph_;
+
+    int maxthreads_ = 1;
+
+    std::shared_ptr<TESTING::FakeParticleEngine> particleengine_;
+    std::shared_ptr<ParticleInteraction::SPHKernelBase> kernel_;
+    std::shared_ptr<ParticleInteraction::MaterialHandler> material_;
+    std::shared_ptr<ParticleInteraction::SPHNeighborPairs> neighborpairs_;
+
+    Core::Utils::SingletonOwnerRegistry::ScopeGuard guard_;
+  };
+
+  TEST_F(SPHNeighborPairsTest, NoTwoPairsOfOneColorShareAParticle)
+  {
+    evaluate_neighbor_pairs(4);
+
+    const auto& particlepairdata = neighborpairs_->get_ref_to_particle_pair_data();
+    const std::vector<int>& color = neighborpairs_->get_ref_to_particle_pair_color();
+    ASSERT_EQ(color.size(), particlepairdata.size());
+    ASSERT_GT(particlepairdata.size(), 1000u);
+
+    std::set<std::pair<int, int>> coloredparticles;
+    for (std::size_t particlepairindex = 0; particlepairindex < particlepairdata.size();
+        ++particlepairindex)
+    {
+      const int color_ij = color[particlepairindex];
+      EXPECT_TRUE(coloredparticles
+                      .emplace(color_ij, std::get<2>(particlepairdata[particlepairindex].tuple_i_))
+                      .second);
+      EXPECT_TRUE(coloredparticles
+                      .emplace(color_ij, std::get<2>(particlepairdata[particlepairindex].tuple_j_))
+                      .second);
+    }
+  }
+
+  TEST_F(SPHNeighborPairsTest, EveryPairIsVisitedOnce)
+  {
+    evaluate_neighbor_pairs(4);
+
+    const auto& particlepairdata = neighborpairs_->get_ref_to_particle_pair_data();
+
+    // every pair only writes to its own entry
+    std::vector<int> visits(particlepairdata.size(), 0);
+    const auto visit = [&](const ParticleInteraction::SPHParticlePair& particlepair)
+    { ++visits[&particlepair - particlepairdata.data()]; };
+
+    neighborpairs_->for_each_particle_pair(visit);
+    EXPECT_TRUE(std::all_of(visits.begin(), visits.end(), [](int n) { return n == 1; }));
+
+    neighborpairs_->for_each_particle_pair_for_equal_combination({PARTICLEENGINE::Phase1}, visit);
+    EXPECT_TRUE(std::all_of(visits.begin(), visits.end(), [](int n) { return n == 2; }));
+  }
+
+  TEST_F(SPHNeighborPairsTest, ThreadedDensityMatchesSerial)
+  {
+    ParticleInteraction::SPHDensitySummation density(params_sph_);
+    density.init();
+    density.setup(particleengine_, nullptr, kernel_, material_, nullptr, neighborpairs_, nullptr);
+
+    evaluate_neighbor_pairs(1);
+    density.compute_density();
+    const std::vector<double> serial = state(PARTICLEENGINE::Density);
+
+    evaluate_neighbor_pairs(4);
+    density.compute_density();
+    expect_near(state(PARTICLEENGINE::Density), serial);
+  }
+
+  TEST_F(SPHNeighborPairsTest, ThreadedMomentumMatchesSerial)
+  {
+    ParticleInteraction::SPHMomentum momentum(params_sph_);
+    momentum.init();
+    momentum.setup(particleengine_, nullptr, kernel_, material_, nullptr, nullptr, neighborpairs_,
+        nullptr);
+
+    evaluate_neighbor_pairs(1);
+    clear_state(PARTICLEENGINE::Acceleration);
+    clear_state(PARTICLEENGINE::ModifiedAcceleration);
+    momentum.add_acceleration_contribution();
+    const std::vector<double> serialacc = state(PARTICLEENGINE::Acceleration);
+    const std::vector<double> serialmodacc = state(PARTICLEENGINE::ModifiedAcceleration);
+
+    evaluate_neighbor_pairs(4);
+    clear_state(PARTICLEENGINE::Acceleration);
+    clear_state(PARTICLEENGINE::ModifiedAcceleration);
+    momentum.add_acceleration_contribution();
+    expect_near(state(PARTICLEENGINE::Acceleration), serialacc);
+    expect_near(state(PARTICLEENGINE::ModifiedAcceleration), serialmodacc);
+  }
+}  // namespace
@@ -0,0 +1,200 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_particle_interaction_verlet_list.hpp"
+
+#include "4C_particle_interaction_fake_particle_engine_test.hpp"
+#include "4C_particle_interaction_utils.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  using ParticlePair = std::pair<int, int>;
+
+  class VerletListTest : public ::testing::Test
+  {
+   protected:
+    VerletListTest()
+        : particleengine_(std::make_shared<TESTING::FakeParticleEngine>(
+              std::map<PARTICLEENGINE::ParticleType, std::set<PARTICLEENGINE::ParticleState>>{
+                  {PARTICLEENGINE::Phase1, {PARTICLEENGINE::Position, PARTICLEENGINE::Radius}}}))
+    {
+    }
+
+    //! add a particle at @p position with @p radius
+    void add_particle(const std::vector<double>& position, double radius)
+    {
+      PARTICLEENGINE::ParticleStates states(PARTICLEENGINE::Radius + 1);
+      states[PARTICLEENGINE::Position] = position;
+      states[PARTICLEENGINE::Radius] = {radius};
+      particleengine_->add_particle(PARTICLEENGINE::Phase1, states);
+    }
+
+    //! position of particle @p i
+    double* position(int i) const
+    {
+      return particleengine_->get_particle_container_bundle()
+          ->get_specific_container(PARTICLEENGINE::Phase1, PARTICLEENGINE::Owned)
+          ->get_ptr_to_state(PARTICLEENGINE::Position, i);
+    }
+
+    //! particle pairs of @p pairs within interaction distance
+    std::set<ParticlePair> interacting_pairs(
+        const PARTICLEENGINE::PotentialParticleNeighbors& pairs) const
+    {
+      std::set<ParticlePair> interacting;
+      for (const auto& [tuple_i, tuple_j] : pairs)
+      {
+        const int i = std::get<2>(tuple_i);
+        const int j = std::get<2>(tuple_j);
+        const double* pos_i = position(i);
+        const double* pos_j = position(j);
+
+        double r_ji[3];
+        particleengine_->distance_between_particles(pos_i, pos_j, r_ji);
+        const double cutoff = interaction_distance_(radius_, radius_);
+        if (ParticleInteraction::Utils::vec_norm_two(r_ji) < cutoff)
+          interacting.emplace(std::min(i, j), std::max(i, j));
+      }
+      return interacting;
+    }
+
+    //! particle pairs of @p pairs
+    static std::set<ParticlePair> all_pairs(const PARTICLEENGINE::PotentialParticleNeighbors& pairs)
+    {
+      std::set<ParticlePair> indices;
+      for (const auto& [tuple_i, tuple_j] : pairs)
+        indices.emplace(std::get<2>(tuple_i), std::get<2>(tuple_j));
+      return indices;
+    }
+
+    std::shared_ptr<TESTING::FakeParticleEngine> particleengine_;
+
+    const double radius_ = 0.1;
+
+    const ParticleInteraction::VerletList::InteractionDistance interaction_distance_ =
+        [](double rad_i, double rad_j) { return rad_i + rad_j; };
+  };
+
+  TEST_F(VerletListTest, SameInteractingPairsAsWithoutSkin)
+  {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> coordinate(0.0, 1.0);
+    std::uniform_real_distribution<double> increment(-0.02, 0.02);
+
+    const int numparticles = 60;
+    for (int i = 0; i < numparticles; ++i)
+      add_particle({coordinate(generator), coordinate(generator), coordinate(generator)}, radius_);
+    particleengine_->build_potential_particle_neighbors();
+
+    ParticleInteraction::VerletList verletlist(0.05);
+    verletlist.setup(particleengine_);
+
+    ParticleInteraction::VerletList noskin(0.0);
+    noskin.setup(particleengine_);
+
+    for (int step = 0; step < 20; ++step)
+    {
+      const auto& candidates = verletlist.get_candidate_particle_pairs(interaction_distance_);
+      const auto& potentialneighbors = noskin.get_candidate_particle_pairs(interaction_distance_);
+
+      // without skin the potential particle neighbors are used directly
+      EXPECT_EQ(&potentialneighbors, &particleengine_->get_potential_particle_neighbors());
+
+      // the skin only removes pairs that are far apart
+      EXPECT_LT(candidates.size(), potentialneighbors.size());
+      EXPECT_EQ(interacting_pairs(candidates), interacting_pairs(potentialneighbors))
+          << "step " << step;
+
+      for (int i = 0; i < numparticles; ++i)
+        for (int dim = 0; dim < 3; ++dim) position(i)[dim] += increment(generator);
+    }
+  }
+
+  TEST_F(VerletListTest, RebuildAfterMoveOfMoreThanHalfTheSkin)
+  {
+    const double skin = 0.1;
+    const double cutoff = interaction_distance_(radius_, radius_);
+
+    // a pair just outside of interaction distance plus skin
+    add_particle({0.0, 0.0, 0.0}, radius_);
+    add_particle({cutoff + skin + 0.01, 0.0, 0.0}, radius_);
+    particleengine_->build_potential_particle_neighbors();
+
+    ParticleInteraction::VerletList verletlist(skin);
+    verletlist.setup(particleengine_);
+    EXPECT_TRUE(verletlist.get_candidate_particle_pairs(interaction_distance_).empty());
+
+    // both particles move less than half the skin towards each other: the pair is still not
+    // within interaction distance, hence it is not needed and the list is kept
+    position(0)[0] += 0.4 * skin;
+    position(1)[0] -= 0.4 * skin;
+    EXPECT_TRUE(verletlist.get_candidate_particle_pairs(interaction_distance_).empty());
+
+    // one particle moves more than half the skin in total: the list is rebuilt
+    position(0)[0] += 0.2 * skin;
+    EXPECT_EQ(all_pairs(verletlist.get_candidate_particle_pairs(interaction_distance_)),
+        (std::set<ParticlePair>{{0, 1}}));
+  }
+
+  TEST_F(VerletListTest, RebuildAfterRebuildOfPotentialNeighbors)
+  {
+    add_particle({0.0, 0.0, 0.0}, radius_);
+    add_particle({0.1, 0.0, 0.0}, radius_);
+    add_particle({0.0, 0.1, 0.0}, radius_);
+    particleengine_->build_potential_particle_neighbors();
+
+    ParticleInteraction::VerletList verletlist(0.1);
+    verletlist.setup(particleengine_);
+    const std::set<ParticlePair> allpairs = {{0, 1}, {0, 2}, {1, 2}};
+    EXPECT_EQ(all_pairs(verletlist.get_candidate_particle_pairs(interaction_distance_)), allpairs);
+
+    // the candidates are kept as long as the potential neighbors are not rebuilt
+    particleengine_->potential_particle_neighbors().pop_back();
+    EXPECT_EQ(all_pairs(verletlist.get_candidate_particle_pairs(interaction_distance_)), allpairs);
+
+    // a rebuild of the potential neighbors invalidates the local indices of the candidates
+    particleengine_->build_potential_particle_neighbors();
+    particleengine_->potential_particle_neighbors().pop_back();
+    EXPECT_EQ(all_pairs(verletlist.get_candidate_particle_pairs(interaction_distance_)),
+        (std::set<ParticlePair>{{0, 1}, {0, 2}}));
+  }
+
+  TEST_F(VerletListTest, RebuildAfterChangedNumberOfParticles)
+  {
+    add_particle({0.0, 0.0, 0.0}, radius_);
+    add_particle({0.1, 0.0, 0.0}, radius_);
+    particleengine_->build_potential_particle_neighbors();
+
+    ParticleInteraction::VerletList verletlist(0.1);
+    verletlist.setup(particleengine_);
+    EXPECT_EQ(verletlist.get_candidate_particle_pairs(interaction_distance_).size(), 1u);
+
+    // the potential neighbors of the new particle are set up by hand without a rebuild
+    add_particle({0.0, 0.1, 0.0}, radius_);
+    const PARTICLEENGINE::LocalIndexTuple particle_2(
+        PARTICLEENGINE::Phase1, PARTICLEENGINE::Owned, 2);
+    for (int i = 0; i < 2; ++i)
+      particleengine_->potential_particle_neighbors().emplace_back(
+          PARTICLEENGINE::LocalIndexTuple(PARTICLEENGINE::Phase1, PARTICLEENGINE::Owned, i),
+          particle_2);
+
+    EXPECT_EQ(all_pairs(verletlist.get_candidate_particle_pairs(interaction_distance_)),
+        (std::set<ParticlePair>{{0, 1}, {0, 2}, {1, 2}}));
+  }
+}  // namespace
@@ -0,0 +1,193 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_post_common.hpp"
+
+#include <hdf5.h>
+#include <Teuchos_CommandLineProcessor.hpp>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  class PostResultTest : public ::testing::Test
+  {
+   protected:
+    /*!
+     * Write a control file with the results of a structure and a fluid field in steps 1 to 9.
+     * The structure starts new result files in steps 1, 4 and 7. Its displacements are written in
+     * every step, its stresses in odd steps and its material only once in step 1.
+     */
+    void SetUp() override
+    {
+      std::ofstream control(basename_ + ".control");
+      control << "# 4C output control file\n\n"
+              << "problem_type = \"Structure\"\n"
+              << "spatial_approximation = \"Polynomial\"\n"
+              << "ndim = 3\n\n"
+              << "field:\n"
+              << "    field = \"structure\"\n"
+              << "    time = 0\n"
+              << "    step = 0\n\n";
+
+      for (int step = 1; step <= 9; ++step)
+      {
+        std::vector<std::string> structure_vectors = {"displacement"};
+        if (step % 2 == 1) structure_vectors.emplace_back("stress");
+        if (step == 1) structure_vectors.emplace_back("material");
+
+        write_result(control, "structure", step, (step - 1) % 3 == 0, structure_vectors);
+        write_result(control, "fluid", step, step == 1, {"velocity"});
+      }
+    }
+
+    //! write a result block to @p control and create its result file if it starts a new one
+    void write_result(std::ofstream& control, const std::string& field, int step,
+        bool new_result_file, const std::vector<std::string>& vectors) const
+    {
+      control << "result:\n"
+              << "    field = \"" << field << "\"\n"
+              << "    time = " << 0.1 * step << "\n"
+              << "    step = " << step << "\n\n";
+
+      if (new_result_file)
+      {
+        const std::string filename = "post_common_test.result." + field + ".s" +
+                                     std::to_string(step);
+        control << "    result_file = \"" << filename << "\"\n\n";
+
+        const hid_t file =
+            H5Fcreate((directory_ + filename).c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+        ASSERT_GE(file, 0);
+        H5Fclose(file);
+      }
+
+      for (const std::string& vector : vectors)
+      {
+        const std::string path = "result/step" + std::to_string(step) + "/" + vector;
+        control << "    " << vector << ":\n"
+                << "        type = \"dof\"\n"
+                << "        columns = 1\n"
+                << "        values = \"" << path << ".values\"\n"
+                << "        ids = \"" << path << ".ids\"\n\n";
+      }
+    }
+
+    //! set up a filter for the slice of steps given by @p start, @p end and @p step
+    std::unique_ptr<PostProblem> make_problem(int start, int end, int step) const
+    {
+      std::vector<std::string> arguments = {"post_common_test",
+          "--file=" + basename_ + ".control", "--start=" + std::to_string(start),
+          "--end=" + std::to_string(end), "--step=" + std::to_string(step)};
+      std::vector<char*> argv;
+      for (std::string& argument : arguments) argv.push_back(argument.data());
+
+      Teuchos::CommandLineProcessor clp;
+      return std::make_unique<PostProblem>(clp, static_cast<int>(argv.size()), argv.data());
+    }
+
+    //! result blocks reached by successive calls of next_result(name)
+    static std::vector<MAP*> walk_results(PostField& field, const std::string& name)
+    {
+      std::vector<MAP*> groups;
+      PostResult result(&field);
+      while (result.next_result(name)) groups.push_back(result.group());
+      return groups;
+    }
+
+    const std::string directory_ = ::testing::TempDir();
+    const std::string basename_ = directory_ + "post_common_test";
+  };
+
+  TEST_F(PostResultTest, GotoResultReachesSameBlockAsNextResult)
+  {
+    // start, end and step of the slice and the expected number of blocks with displacements,
+    // stresses and material in it
+    const std::vector<std::tuple<int, int, int, std::vector<std::size_t>>> slices = {
+        {0, -1, 1, {9, 5, 1}}, {2, -1, 3, {3, 1, 0}}, {3, 8, 2, {3, 3, 0}}};
+    const std::vector<std::string> names = {"displacement", "stress", "material"};
+
+    for (const auto& [start, end, step, num_results] : slices)
+    {
+      std::unique_ptr<PostProblem> problem = make_problem(start, end, step);
+      PostField field(nullptr, problem.get(), "structure", 0, 0);
+
+      for (std::size_t i = 0; i < names.size(); ++i)
+      {
+        const std::string& name = names[i];
+        const std::vector<MAP*> expected = walk_results(field, name);
+        ASSERT_EQ(expected.size(), num_results[i]) << name << " in slice " << start;
+
+        const int num_expected = static_cast<int>(expected.size());
+
+        // jump backwards through the slice, such that earlier result files are reopened
+        PostResult result(&field);
+        for (int n = num_expected - 1; n >= 0; --n)
+        {
+          ASSERT_EQ(result.goto_result(n, name), 1);
+          EXPECT_EQ(result.group(), expected[n]) << name << " " << n << " in slice " << start;
+        }
+        EXPECT_EQ(result.goto_result(num_expected, name), 0);
+
+        // next_result() continues behind the block reached by goto_result()
+        for (int n = 0; n < num_expected; ++n)
+        {
+          PostResult jumped(&field);
+          ASSERT_EQ(jumped.goto_result(n, name), 1);
+          if (n + 1 < num_expected)
+          {
+            ASSERT_EQ(jumped.next_result(name), 1);
+            EXPECT_EQ(jumped.group(), expected[n + 1]) << name << " " << n << " in slice " << start;
+          }
+          else
+          {
+            EXPECT_EQ(jumped.next_result(name), 0);
+          }
+        }
+      }
+    }
+  }
+
+  TEST_F(PostResultTest, GotoResultOfVectorWrittenOnce)
+  {
+    {
+      std::unique_ptr<PostProblem> problem = make_problem(0, -1, 1);
+      PostField field(nullptr, problem.get(), "structure", 0, 0);
+
+      PostResult result(&field);
+      ASSERT_EQ(result.goto_result(4, "displacement"), 1);
+      EXPECT_EQ(result.step(), 5);
+
+      ASSERT_EQ(result.goto_result(0, "material"), 1);
+      EXPECT_EQ(result.step(), 1);
+      EXPECT_EQ(result.goto_result(1, "material"), 0);
+      EXPECT_EQ(result.step(), 1);
+    }
+
+    // the slice does not contain the step in which the material is written
+    {
+      std::unique_ptr<PostProblem> problem = make_problem(2, -1, 1);
+      PostField field(nullptr, problem.get(), "structure", 0, 0);
+
+      PostResult result(&field);
+      ASSERT_EQ(result.goto_result(0, "displacement"), 1);
+      EXPECT_EQ(result.step(), 2);
+
+      EXPECT_EQ(result.goto_result(0, "material"), 0);
+      EXPECT_EQ(result.step(), 2);
+      EXPECT_EQ(result.next_result("material"), 0);
+    }
+  }
+}  // namespace